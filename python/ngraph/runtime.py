@@ -73,6 +73,8 @@ class Computation(object):
         self.parameters = ng_function.get_parameters()
         self.results = ng_function.get_results()
         self.handle = self.runtime.backend.compile(self.function)
+        self.memory_attach = runtime.backend.is_supported_property(
+            Backend.Property.memory_attach)
 
         self.tensor_views = []  # type: List[Tensor]
         for parameter in self.parameters:
@@ -92,6 +94,9 @@ class Computation(object):
 
     def __call__(self, *input_values):  # type: (*NumericData) -> List[NumericData]
         """Run computation on input values and return result."""
+        if self.memory_attach:
+            return self._call_zero_copy(input_values)
+
         for tensor_view, value in zip(self.tensor_views, input_values):
             if not isinstance(value, np.ndarray):
                 value = np.array(value)
@@ -107,6 +112,52 @@ class Computation(object):
 
         return results
 
+    def _call_zero_copy(self, input_values):  # type: (List[NumericData]) -> List[NumericData]
+        """Run computation with tensors created over the input and result arrays.
+
+        Inputs which are C-contiguous arrays of the expected type are used in place, all other
+        inputs are converted once. Results are computed straight into newly allocated arrays.
+        """
+        backend = self.runtime.backend
+        input_views = []  # type: List[Tensor]
+        for tensor_view, value in zip(self.tensor_views, input_values):
+            value = Computation._get_contiguous_ndarray(value, tensor_view)
+            input_views.append(backend.create_tensor(tensor_view.element_type,
+                                                     tensor_view.shape, value))
+
+        results = []
+        result_views = []  # type: List[Tensor]
+        for result_view in self.result_views:
+            result = np.empty(result_view.shape, dtype=get_dtype(result_view.element_type))
+            results.append(result)
+            result_views.append(backend.create_tensor(result_view.element_type,
+                                                      result_view.shape, result))
+
+        self.handle.call(result_views, input_views)
+        return results
+
+    @staticmethod
+    def _get_contiguous_ndarray(value, tensor_view):
+        # type: (NumericData, Tensor) -> np.ndarray
+        if not isinstance(value, np.ndarray):
+            value = np.array(value)
+        tensor_view_dtype = get_dtype(tensor_view.element_type)
+        if list(tensor_view.shape) != list(value.shape):
+            if len(value.shape) > 0:
+                raise UserInputError("Provided tensor's shape: %s does not match the expected: %s.",
+                                     list(value.shape), list(tensor_view.shape))
+            value = np.full(tensor_view.shape, value, dtype=tensor_view_dtype)
+        if value.dtype != tensor_view_dtype:
+            log.warning(
+                'Attempting to write a %s value to a %s tensor. Will attempt type conversion.',
+                value.dtype,
+                tensor_view.element_type)
+            value = value.astype(tensor_view_dtype)
+        # The tensor only borrows the memory, so the array must stay writable for the backend
+        if not value.flags['C_CONTIGUOUS'] or not value.flags['WRITEABLE']:
+            value = np.array(value, order='C')
+        return value
+
     def serialize(self, indent=0):  # type: (int) -> str
         """Serialize function (compute graph) to a JSON string.
 
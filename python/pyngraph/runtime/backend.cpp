@@ -17,6 +17,9 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <stdexcept>
+#include <string>
+
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/tensor.hpp"
 #include "pyngraph/runtime/backend.hpp"
@@ -30,6 +33,124 @@ static std::shared_ptr<ngraph::runtime::Executable> compile(ngraph::runtime::Bac
     return self->compile(func, enable_performance_data);
 }
 
+// Drops the native byte order prefix and spells integer formats by their size, so that e.g. the
+// "l" NumPy reports for int64 on Linux compares equal to the "q" of py::format_descriptor
+static std::string normalize_format(std::string format, ssize_t itemsize)
+{
+    if (!format.empty() && (format[0] == '@' || format[0] == '='))
+    {
+        format.erase(0, 1);
+    }
+    if (format.size() == 1 && std::string("bBhHiIlLqQ").find(format[0]) != std::string::npos)
+    {
+        bool is_unsigned = (format[0] >= 'A' && format[0] <= 'Z');
+        switch (itemsize)
+        {
+        case 1: format = "b"; break;
+        case 2: format = "h"; break;
+        case 4: format = "i"; break;
+        case 8: format = "q"; break;
+        default: break;
+        }
+        if (is_unsigned)
+        {
+            format[0] = static_cast<char>(format[0] - 'a' + 'A');
+        }
+    }
+    return format;
+}
+
+template <typename T>
+static bool format_matches(const py::buffer_info& info)
+{
+    return normalize_format(info.format, info.itemsize) ==
+           normalize_format(py::format_descriptor<T>::format(), sizeof(T));
+}
+
+static bool format_matches(const py::buffer_info& info, const ngraph::element::Type& element_type)
+{
+    if (element_type == ngraph::element::boolean)
+    {
+        return format_matches<bool>(info);
+    }
+    else if (element_type == ngraph::element::f32)
+    {
+        return format_matches<float>(info);
+    }
+    else if (element_type == ngraph::element::f64)
+    {
+        return format_matches<double>(info);
+    }
+    else if (element_type == ngraph::element::i8)
+    {
+        return format_matches<int8_t>(info);
+    }
+    else if (element_type == ngraph::element::i16)
+    {
+        return format_matches<int16_t>(info);
+    }
+    else if (element_type == ngraph::element::i32)
+    {
+        return format_matches<int32_t>(info);
+    }
+    else if (element_type == ngraph::element::i64)
+    {
+        return format_matches<int64_t>(info);
+    }
+    else if (element_type == ngraph::element::u8)
+    {
+        return format_matches<uint8_t>(info);
+    }
+    else if (element_type == ngraph::element::u16)
+    {
+        return format_matches<uint16_t>(info);
+    }
+    else if (element_type == ngraph::element::u32)
+    {
+        return format_matches<uint32_t>(info);
+    }
+    else if (element_type == ngraph::element::u64)
+    {
+        return format_matches<uint64_t>(info);
+    }
+    throw std::invalid_argument("Unsupported tensor element type for the buffer protocol");
+}
+
+// Creates a tensor that uses the memory of a caller-owned buffer, e.g. a NumPy array, instead of
+// allocating its own. The buffer must stay alive as long as the tensor, see keep_alive below.
+static std::shared_ptr<ngraph::runtime::Tensor>
+    create_tensor_from_buffer(ngraph::runtime::Backend* self,
+                              const ngraph::element::Type& element_type,
+                              const ngraph::Shape& shape,
+                              py::buffer buffer)
+{
+    py::buffer_info info = buffer.request(true);
+    if (info.itemsize != static_cast<ssize_t>(element_type.size()))
+    {
+        throw std::invalid_argument("Buffer item size does not match the tensor element type");
+    }
+    if (!format_matches(info, element_type))
+    {
+        throw std::invalid_argument("Buffer format '" + info.format +
+                                    "' does not match the tensor element type " +
+                                    element_type.get_type_name());
+    }
+    if (info.size != static_cast<ssize_t>(ngraph::shape_size(shape)))
+    {
+        throw std::invalid_argument("Buffer size does not match the tensor shape");
+    }
+    ssize_t stride = info.itemsize;
+    for (ssize_t i = info.ndim; i-- > 0;)
+    {
+        if (info.shape[i] != 1 && info.strides[i] != stride)
+        {
+            throw std::invalid_argument("Buffer must be C-contiguous");
+        }
+        stride *= info.shape[i];
+    }
+    return self->create_tensor(element_type, shape, info.ptr);
+}
+
 static std::shared_ptr<ngraph::runtime::Backend> create(const std::string& type)
 {
     bool must_support_dynamic = false;
@@ -47,6 +168,11 @@ void regclass_pyngraph_runtime_Backend(py::module m)
                 (std::shared_ptr<ngraph::runtime::Tensor>(ngraph::runtime::Backend::*)(
                     const ngraph::element::Type&, const ngraph::Shape&)) &
                     ngraph::runtime::Backend::create_tensor);
+    backend.def("create_tensor", &create_tensor_from_buffer, py::keep_alive<0, 4>());
     backend.def("compile", &compile);
     backend.def("set_config", &ngraph::runtime::Backend::set_config);
+    backend.def("is_supported_property", &ngraph::runtime::Backend::is_supported_property);
+
+    py::enum_<ngraph::runtime::Backend::Property>(backend, "Property")
+        .value("memory_attach", ngraph::runtime::Backend::Property::memory_attach);
 }
@@ -14,10 +14,14 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <pybind11/buffer_info.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <vector>
+
 #include "ngraph/descriptor/tensor.hpp"
+#include "ngraph/shape.hpp"
 #include "ngraph/runtime/tensor.hpp"
 #include "pyngraph/runtime/tensor.hpp"
 
@@ -33,13 +37,88 @@ static void write_(ngraph::runtime::Tensor* self, void* p, size_t n)
     self->write(p, n);
 }
 
+template <typename T>
+py::buffer_info _get_buffer_info(ngraph::runtime::Tensor& t, void* data)
+{
+    ngraph::Shape shape = t.get_shape();
+    std::vector<ssize_t> byte_strides;
+    for (auto v : ngraph::row_major_strides(shape))
+    {
+        byte_strides.push_back(static_cast<ssize_t>(v) * sizeof(T));
+    }
+    return py::buffer_info(data,
+                           static_cast<ssize_t>(sizeof(T)),
+                           py::format_descriptor<T>::format(),
+                           static_cast<ssize_t>(shape.size()),
+                           std::vector<ssize_t>{shape.begin(), shape.end()},
+                           byte_strides);
+}
+
+// Exposes the tensor memory without a copy. Only tensors whose data lives in host memory, in
+// row-major order, can be viewed this way; everything else has to go through read/write.
+static py::buffer_info get_buffer_info(ngraph::runtime::Tensor& self)
+{
+    void* data = self.get_host_data_ptr();
+    if (data == nullptr)
+    {
+        throw py::buffer_error("Tensor data is not accessible from the host");
+    }
+    auto element_type = self.get_element_type();
+    if (element_type == ngraph::element::boolean)
+    {
+        return _get_buffer_info<char>(self, data);
+    }
+    else if (element_type == ngraph::element::f32)
+    {
+        return _get_buffer_info<float>(self, data);
+    }
+    else if (element_type == ngraph::element::f64)
+    {
+        return _get_buffer_info<double>(self, data);
+    }
+    else if (element_type == ngraph::element::i8)
+    {
+        return _get_buffer_info<int8_t>(self, data);
+    }
+    else if (element_type == ngraph::element::i16)
+    {
+        return _get_buffer_info<int16_t>(self, data);
+    }
+    else if (element_type == ngraph::element::i32)
+    {
+        return _get_buffer_info<int32_t>(self, data);
+    }
+    else if (element_type == ngraph::element::i64)
+    {
+        return _get_buffer_info<int64_t>(self, data);
+    }
+    else if (element_type == ngraph::element::u8)
+    {
+        return _get_buffer_info<uint8_t>(self, data);
+    }
+    else if (element_type == ngraph::element::u16)
+    {
+        return _get_buffer_info<uint16_t>(self, data);
+    }
+    else if (element_type == ngraph::element::u32)
+    {
+        return _get_buffer_info<uint32_t>(self, data);
+    }
+    else if (element_type == ngraph::element::u64)
+    {
+        return _get_buffer_info<uint64_t>(self, data);
+    }
+    throw py::buffer_error("Unsupported tensor element type for the buffer protocol");
+}
+
 void regclass_pyngraph_runtime_Tensor(py::module m)
 {
-    py::class_<ngraph::runtime::Tensor, std::shared_ptr<ngraph::runtime::Tensor>> tensor(m,
-                                                                                         "Tensor");
+    py::class_<ngraph::runtime::Tensor, std::shared_ptr<ngraph::runtime::Tensor>> tensor(
+        m, "Tensor", py::buffer_protocol());
     tensor.doc() = "ngraph.impl.runtime.Tensor wraps ngraph::runtime::Tensor";
     tensor.def("write", &write_);
     tensor.def("read", &read_);
+    tensor.def_buffer(&get_buffer_info);
 
     tensor.def_property_readonly("shape", &ngraph::runtime::Tensor::get_shape);
     tensor.def_property_readonly("element_count", &ngraph::runtime::Tensor::get_element_count);
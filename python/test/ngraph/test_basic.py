@@ -18,6 +18,8 @@ import pytest
 import json
 
 import ngraph as ng
+from ngraph.impl import Shape, Type
+from ngraph.impl.runtime import Backend
 from ngraph.exceptions import UserInputError
 
 import test
@@ -217,3 +219,59 @@ def test_backend_config():
     dummy_config = {'dummy_option': 'dummy_value'}
     # Expect no throw
     ng.runtime(backend_name=test.BACKEND_NAME).set_config(dummy_config)
+
+
+@pytest.mark.skip_on_gpu
+def test_tensor_buffer_protocol():
+    runtime = ng.runtime(backend_name=test.BACKEND_NAME)
+    backend = runtime.backend
+    if not backend.is_supported_property(Backend.Property.memory_attach):
+        pytest.skip('Backend does not support attached memory')
+
+    shape = [2, 3]
+    array = np.arange(6, dtype=np.float32).reshape(shape)
+    tensor = backend.create_tensor(Type.f32, Shape(shape), array)
+
+    view = np.array(tensor, copy=False)
+    assert view.shape == (2, 3)
+    assert view.dtype == np.float32
+    array[1, 2] = 42
+    assert view[1, 2] == 42
+
+    with pytest.raises(ValueError):
+        backend.create_tensor(Type.f32, Shape(shape), array.T)
+
+
+def test_tensor_buffer_protocol_checks_format():
+    runtime = ng.runtime(backend_name=test.BACKEND_NAME)
+    backend = runtime.backend
+    if not backend.is_supported_property(Backend.Property.memory_attach):
+        pytest.skip('Backend does not support attached memory')
+
+    shape = [2, 3]
+    with pytest.raises(ValueError):
+        backend.create_tensor(Type.f32, Shape(shape), np.zeros(shape, dtype=np.int32))
+    with pytest.raises(ValueError):
+        backend.create_tensor(Type.i64, Shape(shape), np.zeros(shape, dtype=np.uint64))
+
+    tensor = backend.create_tensor(Type.i64, Shape(shape), np.arange(6, dtype=np.int64).reshape(shape))
+    view = np.array(tensor, copy=False)
+    assert view.dtype == np.int64
+    assert view[1, 2] == 5
+
+
+@pytest.mark.skip_on_gpu
+def test_computation_reuses_input_arrays():
+    runtime = ng.runtime(backend_name=test.BACKEND_NAME)
+    shape = [2, 2]
+    parameter_a = ng.parameter(shape, dtype=np.float32, name='A')
+    parameter_b = ng.parameter(shape, dtype=np.float32, name='B')
+    computation = runtime.computation(parameter_a * parameter_b, parameter_a, parameter_b)
+
+    value_a = np.array([[1, 2], [3, 4]], dtype=np.float32)
+    value_b = np.array([[5, 6], [7, 8]], dtype=np.float64)
+    first = computation(value_a, value_b)[0]
+    second = computation(value_a.T, 2)[0]
+    assert np.allclose(first, np.array([[5, 12], [21, 32]], dtype=np.float32))
+    assert np.allclose(second, np.array([[2, 6], [4, 8]], dtype=np.float32))
+    assert first is not second
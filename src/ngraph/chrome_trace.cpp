@@ -14,10 +14,13 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <condition_variable>
 #include <iostream>
-#include <map>
+#include <memory>
 #include <sstream>
 #include <string>
+#include <unordered_set>
+#include <vector>
 
 #include "chrome_trace.hpp"
 #include "ngraph/env_util.hpp"
@@ -33,24 +36,320 @@ static bool read_tracing_env_var()
     return is_enabled;
 }
 
-mutex event::Manager::s_file_mutex;
 bool event::Manager::s_tracing_enabled = read_tracing_env_var();
 
+namespace
+{
+    // Names and categories point into the string table of the recording thread, so recording an
+    // event allocates nothing unless it has arguments
+    struct TraceEvent
+    {
+        // 'X' duration, 'N' object created, 'O' object snapshot, 'D' object destroyed
+        char phase;
+        size_t timestamp;
+        // Duration of 'X' events, object id otherwise
+        size_t value;
+        const string* name;
+        const string* category;
+        unique_ptr<string> args;
+    };
+
+    // Single producer, single consumer ring of the events recorded by one thread. Only the owning
+    // thread records and only the trace writer, under its mutex, drains.
+    //
+    // The strings of the thread are interned in a node based set. Inserting a string does not
+    // move the strings already there, so the writer can read them while the thread adds more.
+    class ThreadBuffer
+    {
+    public:
+        ThreadBuffer(size_t capacity)
+            : m_events(capacity)
+            , m_head(0)
+            , m_tail(0)
+        {
+            stringstream ss;
+            ss << "\"" << this_thread::get_id() << "\"";
+            m_thread_id = ss.str();
+        }
+
+        const string* intern(const string& s)
+        {
+            auto it = m_strings.find(s);
+            if (it == m_strings.end())
+            {
+                it = m_strings.insert(s).first;
+            }
+            return &*it;
+        }
+
+        bool push(TraceEvent&& event)
+        {
+            size_t head = m_head.load(memory_order_relaxed);
+            if (head - m_tail.load(memory_order_acquire) == m_events.size())
+            {
+                return false;
+            }
+            m_events[head % m_events.size()] = move(event);
+            m_head.store(head + 1, memory_order_release);
+            return true;
+        }
+
+        template <typename F>
+        void drain(F&& f)
+        {
+            size_t tail = m_tail.load(memory_order_relaxed);
+            size_t head = m_head.load(memory_order_acquire);
+            for (; tail != head; tail++)
+            {
+                TraceEvent& event = m_events[tail % m_events.size()];
+                f(event);
+                // Release the arguments now rather than when the slot is reused
+                event.args.reset();
+            }
+            m_tail.store(tail, memory_order_release);
+        }
+
+        const string& get_thread_id() const { return m_thread_id; }
+    private:
+        vector<TraceEvent> m_events;
+        atomic<size_t> m_head;
+        atomic<size_t> m_tail;
+        string m_thread_id;
+        unordered_set<string> m_strings;
+    };
+
+    class TraceWriter
+    {
+    public:
+        TraceWriter()
+            : m_buffer_size(getenv_int("NGRAPH_TRACE_BUFFER_SIZE", 16384))
+            , m_flush_interval(getenv_int("NGRAPH_TRACE_FLUSH_INTERVAL", 100))
+            , m_pid(to_string(getpid()))
+        {
+            if (m_buffer_size < 1)
+            {
+                m_buffer_size = 1;
+            }
+            // An interval of 0 would make the flusher spin while holding the mutex
+            if (m_flush_interval < 1)
+            {
+                m_flush_interval = 1;
+            }
+        }
+
+        ~TraceWriter() { close(); }
+        static TraceWriter& get()
+        {
+            static TraceWriter s_writer;
+            return s_writer;
+        }
+
+        ThreadBuffer& get_thread_buffer()
+        {
+            // The writer keeps a reference so that events of exited threads are still written
+            thread_local shared_ptr<ThreadBuffer> t_buffer;
+            if (!t_buffer)
+            {
+                t_buffer = make_shared<ThreadBuffer>(m_buffer_size);
+                lock_guard<mutex> lock(m_mutex);
+                m_buffers.push_back(t_buffer);
+                start_flusher_locked();
+            }
+            return *t_buffer;
+        }
+
+        void open(const string& path)
+        {
+            lock_guard<mutex> lock(m_mutex);
+            open_locked(path);
+            start_flusher_locked();
+        }
+
+        void flush()
+        {
+            lock_guard<mutex> lock(m_mutex);
+            flush_locked();
+        }
+
+        void close()
+        {
+            thread flusher;
+            {
+                lock_guard<mutex> lock(m_mutex);
+                // A flusher started after this point belongs to the next generation
+                m_generation++;
+                flusher = move(m_flusher);
+            }
+            m_stop_cv.notify_all();
+            if (flusher.joinable())
+            {
+                flusher.join();
+            }
+
+            lock_guard<mutex> lock(m_mutex);
+            flush_locked();
+            if (m_out.is_open())
+            {
+                m_out << "\n]\n";
+                m_out.close();
+            }
+            // The count is kept for get_dropped_event_count() until the next trace is opened
+            size_t dropped = m_dropped;
+            if (dropped > 0)
+            {
+                NGRAPH_WARN << "Event trace dropped " << dropped
+                            << " events, increase NGRAPH_TRACE_BUFFER_SIZE to keep them";
+            }
+        }
+
+        void drop() { m_dropped++; }
+        size_t get_dropped_count() const { return m_dropped; }
+    private:
+        void start_flusher_locked()
+        {
+            if (!m_flusher.joinable())
+            {
+                m_flusher = thread(&TraceWriter::flush_loop, this, m_generation);
+            }
+        }
+
+        void open_locked(const string& path)
+        {
+            if (m_out.is_open() == false)
+            {
+                m_out.open(path, ios_base::trunc);
+                m_out << "[\n";
+                m_first_event = true;
+                m_dropped = 0;
+            }
+        }
+
+        void flush_locked()
+        {
+            for (auto it = m_buffers.begin(); it != m_buffers.end();)
+            {
+                const string& tid = (*it)->get_thread_id();
+                (*it)->drain([&](const TraceEvent& event) { write_event(event, tid); });
+                // Only the writer still references the buffer of a thread that has exited
+                if (it->use_count() == 1)
+                {
+                    it = m_buffers.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+            if (m_out.is_open())
+            {
+                m_out.flush();
+            }
+        }
+
+        void write_event(const TraceEvent& event, const string& tid)
+        {
+            open_locked("runtime_event_trace.json");
+            if (!m_first_event)
+            {
+                m_out << ",\n";
+            }
+            m_first_event = false;
+
+            m_out << R"({"name":")" << *event.name << R"(",)";
+            if (event.phase == 'X')
+            {
+                m_out << R"("cat":")" << *event.category << R"(","ph":"X","pid":)" << m_pid
+                      << R"(,"tid":)" << tid << R"(,"ts":)" << event.timestamp << R"(,"dur":)"
+                      << event.value;
+            }
+            else
+            {
+                m_out << R"("ph":")" << event.phase << R"(","id":")" << event.value
+                      << R"(","ts":)" << event.timestamp << R"(,"pid":)" << m_pid
+                      << R"(,"tid":)" << tid;
+            }
+            if (event.args)
+            {
+                m_out << R"(,"args":)" << *event.args;
+            }
+            m_out << "}";
+        }
+
+        void flush_loop(size_t generation)
+        {
+            unique_lock<mutex> lock(m_mutex);
+            while (generation == m_generation)
+            {
+                m_stop_cv.wait_for(lock, chrono::milliseconds(m_flush_interval));
+                flush_locked();
+            }
+        }
+
+        int32_t m_buffer_size;
+        int32_t m_flush_interval;
+        string m_pid;
+        atomic<size_t> m_dropped{0};
+
+        // Protects the fields below and the output stream
+        mutex m_mutex;
+        condition_variable m_stop_cv;
+        vector<shared_ptr<ThreadBuffer>> m_buffers;
+        thread m_flusher;
+        size_t m_generation{0};
+        ofstream m_out;
+        bool m_first_event{true};
+    };
+
+    atomic<size_t> s_sampling_rate{[]() {
+        int32_t rate = getenv_int("NGRAPH_TRACE_SAMPLING_RATE", 1);
+        return static_cast<size_t>(rate < 1 ? 1 : rate);
+    }()};
+    atomic<size_t> s_call_count{0};
+
+    thread_local size_t t_call_depth = 0;
+    thread_local bool t_call_sampled = true;
+}
+
+void event::Manager::record(char phase,
+                            size_t timestamp,
+                            size_t value,
+                            const string* name,
+                            const string* category,
+                            const string& args)
+{
+    TraceWriter& writer = TraceWriter::get();
+    TraceEvent event{phase,
+                     timestamp,
+                     value,
+                     name,
+                     category,
+                     unique_ptr<string>(args.empty() ? nullptr : new string(args))};
+    if (!writer.get_thread_buffer().push(move(event)))
+    {
+        writer.drop();
+    }
+}
+
+const string* event::Manager::intern(const string& s)
+{
+    return TraceWriter::get().get_thread_buffer().intern(s);
+}
+
 event::Duration::Duration(const string& name, const string& category, const string& args)
 {
     if (Manager::is_tracing_enabled())
     {
         m_start = Manager::get_current_microseconds();
         m_stop = 0;
-        m_name = name;
-        m_category = category;
+        m_name = Manager::intern(name);
+        m_category = Manager::intern(category);
         m_args = args;
     }
 }
 
 void event::Duration::stop()
 {
-    if (Manager::is_tracing_enabled())
+    if (m_start != 0)
     {
         m_stop = Manager::get_current_microseconds();
     }
@@ -58,33 +357,12 @@ void event::Duration::stop()
 
 void event::Duration::write()
 {
-    if (Manager::is_tracing_enabled())
+    // Only a Duration started while tracing was enabled is written, and only once
+    if (m_start != 0 && !m_written)
     {
         size_t stop_time = (m_stop != 0 ? m_stop : Manager::get_current_microseconds());
-
-        lock_guard<mutex> lock(Manager::get_mutex());
-
-        ofstream& out = event::Manager::get_output_stream();
-        string str;
-        if (out.is_open() == false)
-        {
-            event::Manager::open();
-        }
-        else
-        {
-            str += ",\n";
-        }
-
-        str +=
-            R"({"name":")" + m_name + R"(","cat":")" + m_category + R"(","ph":"X","pid":)" +
-            Manager::get_process_id() + R"(,"tid":)" + Manager::get_thread_id() +
-            R"(,"ts":)" + to_string(m_start) + R"(,"dur":)" + to_string(stop_time - m_start);
-        if (!m_args.empty())
-        {
-            str += R"(,"args":)" + m_args;
-        }
-        str += "}";
-        out << str;
+        m_written = true;
+        Manager::record('X', m_start, stop_time - m_start, m_name, m_category, m_args);
     }
 }
 
@@ -92,117 +370,80 @@ event::Object::Object(const string& name, const string& args)
     : m_name{name}
     , m_id{static_cast<size_t>(chrono::high_resolution_clock::now().time_since_epoch().count())}
 {
+    // Outside of a SampledCall every event of the object is a call of its own
+    SampledCall call;
     if (Manager::is_tracing_enabled())
     {
-        lock_guard<mutex> lock(Manager::get_mutex());
-
-        ofstream& out = event::Manager::get_output_stream();
-        string str;
-        if (out.is_open() == false)
-        {
-            event::Manager::open();
-        }
-        else
-        {
-            str += ",\n";
-        }
-        str += R"({"name":")" + m_name + R"(","ph":"N","id":")" + to_string(m_id) +
-               R"(","ts":)" + to_string(Manager::get_current_microseconds()) +
-               R"(,"pid":)" + Manager::get_process_id() + R"(,"tid":)" + Manager::get_thread_id();
-        if (!args.empty())
-        {
-            str += R"(,"args":)" + args;
-        }
-        str += "}";
-
-        write_snapshot(out, args);
+        size_t now = Manager::get_current_microseconds();
+        const string* name = Manager::intern(m_name);
+        const string* category = Manager::intern("");
+        Manager::record('N', now, m_id, name, category, args);
+        Manager::record('O', now, m_id, name, category, args);
     }
 }
 
 void event::Object::snapshot(const string& args)
 {
+    SampledCall call;
     if (Manager::is_tracing_enabled())
     {
-        lock_guard<mutex> lock(Manager::get_mutex());
-
-        ofstream& out = event::Manager::get_output_stream();
-        if (out.is_open() == false)
-        {
-            event::Manager::open();
-        }
-        else
-        {
-            Manager::get_output_stream() << ",\n";
-        }
-        write_snapshot(out, args);
+        Manager::record('O',
+                        Manager::get_current_microseconds(),
+                        m_id,
+                        Manager::intern(m_name),
+                        Manager::intern(""),
+                        args);
     }
 }
 
-void event::Object::write_snapshot(ostream& out, const string& args)
+void event::Object::destroy()
 {
-    string str = R"({"name":")" + m_name + R"(","ph":"O","id":")" + to_string(m_id) +
-                 R"(","ts":)" + to_string(Manager::get_current_microseconds()) +
-                 R"(,"pid":)" + Manager::get_process_id() + R"(,"tid":)" + Manager::get_thread_id();
-    if (!args.empty())
+    SampledCall call;
+    if (Manager::is_tracing_enabled())
     {
-        str += R"(,"args":)" + args;
+        Manager::record('D',
+                        Manager::get_current_microseconds(),
+                        m_id,
+                        Manager::intern(m_name),
+                        Manager::intern(""),
+                        "");
     }
-    str += "}";
-    out << str;
 }
 
-void event::Object::destroy()
+event::SampledCall::SampledCall()
 {
-    if (Manager::is_tracing_enabled())
+    if (Manager::s_tracing_enabled)
     {
-        lock_guard<mutex> lock(Manager::get_mutex());
-
-        ofstream& out = event::Manager::get_output_stream();
-        if (out.is_open() == false)
-        {
-            event::Manager::open();
-        }
-        else
+        if (t_call_depth == 0)
         {
-            Manager::get_output_stream() << ",\n";
+            t_call_sampled = Manager::sample_call();
         }
-        string str = R"({"name":")" + m_name + R"(","ph":"D","id":")" + to_string(m_id) +
-                     R"(","ts":)" + to_string(Manager::get_current_microseconds()) +
-                     R"(,"pid":)" + Manager::get_process_id() + R"(,"tid":)" +
-                     Manager::get_thread_id() + "}";
+        t_call_depth++;
+        m_active = true;
     }
 }
 
-void event::Manager::open(const string& path)
+event::SampledCall::~SampledCall()
 {
-    ofstream& out = get_output_stream();
-    if (out.is_open() == false)
+    if (m_active)
     {
-        out.open(path, ios_base::trunc);
-        out << "[\n";
+        t_call_depth--;
     }
 }
 
-void event::Manager::close()
+void event::Manager::open(const string& path)
 {
-    ofstream& out = get_output_stream();
-    if (out.is_open())
-    {
-        out << "\n]\n";
-        out.close();
-    }
+    TraceWriter::get().open(path);
 }
 
-ofstream& event::Manager::get_output_stream()
+void event::Manager::close()
 {
-    static ofstream s_event_log;
-    return s_event_log;
+    TraceWriter::get().close();
 }
 
-const string& event::Manager::get_process_id()
+void event::Manager::flush()
 {
-    static const string s_pid = to_string(getpid());
-    return s_pid;
+    TraceWriter::get().flush();
 }
 
 void event::Manager::enable_event_tracing()
@@ -220,22 +461,28 @@ bool event::Manager::is_event_tracing_enabled()
     return s_tracing_enabled;
 }
 
-string event::Manager::get_thread_id()
+void event::Manager::set_sampling_rate(size_t rate)
 {
-    thread::id tid = this_thread::get_id();
-    static map<thread::id, string> tid_map;
-    auto it = tid_map.find(tid);
-    string rc;
-    if (it == tid_map.end())
-    {
-        stringstream ss;
-        ss << "\"" << tid << "\"";
-        rc = ss.str();
-        tid_map.insert({tid, rc});
-    }
-    else
-    {
-        rc = it->second;
-    }
-    return rc;
+    s_sampling_rate = (rate < 1 ? 1 : rate);
+}
+
+size_t event::Manager::get_sampling_rate()
+{
+    return s_sampling_rate;
+}
+
+size_t event::Manager::get_dropped_event_count()
+{
+    return TraceWriter::get().get_dropped_count();
+}
+
+bool event::Manager::is_tracing_enabled()
+{
+    return s_tracing_enabled && (t_call_depth == 0 || t_call_sampled);
+}
+
+bool event::Manager::sample_call()
+{
+    size_t rate = s_sampling_rate.load(memory_order_relaxed);
+    return rate == 1 || s_call_count.fetch_add(1, memory_order_relaxed) % rate == 0;
 }
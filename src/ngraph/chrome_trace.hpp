@@ -16,7 +16,9 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
+#include <cstddef>
 #include <fstream>
 #include <iostream>
 #include <mutex>
@@ -40,6 +42,7 @@ namespace ngraph
         class Duration;
         class Object;
         class Manager;
+        class SampledCall;
     }
 }
 
@@ -73,34 +76,76 @@ namespace ngraph
 //
 // More information about this is at:
 // http://dev.chromium.org/developers/how-tos/trace-event-profiling-tool
+//
+// Events are not written to the trace file by the thread recording them. Every thread appends its
+// events to its own fixed size ring buffer without taking a lock, and the buffers are drained to
+// the file by a background thread every NGRAPH_TRACE_FLUSH_INTERVAL milliseconds (default 100)
+// and by Manager::close(). NGRAPH_TRACE_BUFFER_SIZE sets the number of events a thread can buffer
+// (default 16384); events recorded while a buffer is full are dropped and counted.
+//
+// Setting NGRAPH_TRACE_SAMPLING_RATE to N, or calling Manager::set_sampling_rate(N), traces only
+// one of every N calls marked by a SampledCall. A Duration outside of any SampledCall is a call of
+// its own, and so are the events of an Object recorded outside of one.
 
-class ngraph::event::Manager
+class NGRAPH_API ngraph::event::Manager
 {
     friend class Duration;
     friend class Object;
+    friend class SampledCall;
 
 public:
     static void open(const std::string& path = "runtime_event_trace.json");
+    /// \brief Write all buffered events and close the trace file
     static void close();
-    static bool is_tracing_enabled() { return s_tracing_enabled; }
+    /// \brief Write all buffered events to the trace file
+    static void flush();
+    /// \brief True if events recorded now by the calling thread are written to the trace
+    ///
+    /// Does not take a sampling decision; inside a SampledCall this is the decision of the call.
+    static bool is_tracing_enabled();
     static void enable_event_tracing();
     static void disable_event_tracing();
     static bool is_event_tracing_enabled();
+    /// \brief Trace only one of every rate calls. A rate of 1 traces every call.
+    static void set_sampling_rate(size_t rate);
+    static size_t get_sampling_rate();
+    /// \brief Number of events dropped because the buffer of their thread was full
+    static size_t get_dropped_event_count();
 
 private:
-    static std::ofstream& get_output_stream();
-    static const std::string& get_process_id();
+    /// \brief Takes the sampling decision for a new outermost call
+    static bool sample_call();
     static size_t get_current_microseconds()
     {
         return std::chrono::high_resolution_clock::now().time_since_epoch().count() / 1000;
     }
-    static std::string get_thread_id();
-    static std::mutex& get_mutex() { return s_file_mutex; }
-    static std::ostream s_ostream;
-    static std::mutex s_file_mutex;
+    static void record(char phase,
+                       size_t timestamp,
+                       size_t value,
+                       const std::string* name,
+                       const std::string* category,
+                       const std::string& args);
+    /// \brief Returns the copy of s kept by the trace buffer of the calling thread
+    static const std::string* intern(const std::string& s);
     static bool s_tracing_enabled;
 };
 
+/// \brief Marks the extent of one call, for example of Executable::call, for trace sampling
+///
+/// Whether the call is traced is decided when the outermost SampledCall of a thread is created.
+/// Nested SampledCalls share the decision of the outermost one.
+class NGRAPH_API ngraph::event::SampledCall
+{
+public:
+    SampledCall();
+    ~SampledCall();
+    SampledCall(const SampledCall&) = delete;
+    SampledCall& operator=(const SampledCall&) = delete;
+
+private:
+    bool m_active{false};
+};
+
 class NGRAPH_API ngraph::event::Duration
 {
 public:
@@ -117,19 +162,23 @@ public:
     /// This funtion has an implicit stop() if stop() has not been previously called
     void write();
 
+    /// \brief replace the arguments recorded with the event, must be a JSON object
+    void set_args(const std::string& args) { m_args = args; }
     Duration(const Duration&) = delete;
     Duration& operator=(Duration const&) = delete;
 
 private:
-    std::string to_json() const;
+    // Events recorded while the Duration exists follow its sampling decision
+    SampledCall m_call;
     size_t m_start{0};
     size_t m_stop{0};
-    std::string m_name;
-    std::string m_category;
+    bool m_written{false};
+    const std::string* m_name{nullptr};
+    const std::string* m_category{nullptr};
     std::string m_args;
 };
 
-class ngraph::event::Object
+class NGRAPH_API ngraph::event::Object
 {
 public:
     Object(const std::string& name, const std::string& args);
@@ -137,7 +186,6 @@ public:
     void destroy();
 
 private:
-    void write_snapshot(std::ostream& out, const std::string& args);
     const std::string m_name;
     size_t m_id{0};
 };
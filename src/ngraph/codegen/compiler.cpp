@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <iostream>
+#include <sstream>
 #include <string>
 
 #include <clang/Basic/DiagnosticOptions.h>
@@ -34,14 +35,20 @@
 #include <clang/Lex/Preprocessor.h>
 #include <clang/Lex/PreprocessorOptions.h>
 #include <llvm/ADT/Statistic.h>
+#include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/Bitcode/BitcodeWriter.h>
+#include <llvm/Config/llvm-config.h>
 #include <llvm/ExecutionEngine/MCJIT.h> // forces JIT to link in
+#include <llvm/IR/LLVMContext.h>
 #include <llvm/IR/Module.h>
 #include <llvm/LinkAllPasses.h>
 #include <llvm/Option/Arg.h>
 #include <llvm/Option/ArgList.h>
 #include <llvm/Option/OptTable.h>
 #include <llvm/Support/ErrorHandling.h>
+#include <llvm/Support/Host.h>
 #include <llvm/Support/ManagedStatic.h>
+#include <llvm/Support/MemoryBuffer.h>
 #include <llvm/Support/Signals.h>
 #include <llvm/Support/TargetSelect.h>
 #include <llvm/Support/Timer.h>
@@ -52,6 +59,7 @@
 #include "ngraph/env_util.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/runtime/executable_cache.hpp"
 #include "ngraph/util.hpp"
 
 #if defined(__clang__)
@@ -133,6 +141,34 @@ void codegen::Compiler::add_header_search_path(const std::string& path)
 
 std::unique_ptr<codegen::Module> codegen::Compiler::compile(const std::string& source)
 {
+    // Skip clang entirely if this exact source was already compiled by an earlier process. The
+    // key covers everything that changes the generated bitcode besides the source itself.
+    auto cache = runtime::ExecutableCache::create_from_environment();
+    std::string key;
+    if (cache)
+    {
+        std::ostringstream id;
+        id << "codegen " << NGRAPH_VERSION << " " << LLVM_VERSION_STRING << " "
+           << llvm::sys::getHostCPUName().str() << " "
+           << getenv_bool("NGRAPH_COMPILER_DEBUGINFO_ENABLE") << "\n";
+        for (const std::string& path : m_header_search_paths)
+        {
+            id << path << "\n";
+        }
+        id << m_precompiled_header_source << "\n" << source;
+        key = runtime::ExecutableCache::compute_key(id.str());
+
+        std::string bitcode;
+        if (cache->read(key, bitcode))
+        {
+            if (auto module = load_cached_module(bitcode))
+            {
+                return module;
+            }
+            cache->remove(key);
+        }
+    }
+
     // lock_guard<mutex> lock(m_mutex);
     CompilerInfo& compiler_info = s_compiler_info[m_precompiled_header_source];
     if (!compiler_info.compiler)
@@ -145,9 +181,37 @@ std::unique_ptr<codegen::Module> codegen::Compiler::compile(const std::string& s
         compiler_info.compiler->set_precompiled_header_source(m_precompiled_header_source);
     }
     auto rc = compiler_info.compiler->compile(m_compiler_action, source);
+
+    if (cache && rc)
+    {
+        auto llvm_module = rc->take_module();
+        std::string bitcode;
+        llvm::raw_string_ostream out(bitcode);
+        llvm::WriteBitcodeToFile(*llvm_module, out);
+        out.flush();
+        cache->write(key, bitcode);
+        rc.reset(new codegen::Module(move(llvm_module)));
+    }
     return rc;
 }
 
+std::unique_ptr<codegen::Module> codegen::Compiler::load_cached_module(const std::string& bitcode)
+{
+    if (!m_context)
+    {
+        m_context.reset(new llvm::LLVMContext());
+    }
+    auto buffer = llvm::MemoryBuffer::getMemBuffer(bitcode, "cached_module", false);
+    auto module = llvm::parseBitcodeFile(buffer->getMemBufferRef(), *m_context);
+    if (!module)
+    {
+        NGRAPH_WARN << "Discarding unreadable cached module: "
+                    << llvm::toString(module.takeError());
+        return nullptr;
+    }
+    return std::unique_ptr<codegen::Module>(new codegen::Module(move(*module)));
+}
+
 static std::string GetExecutablePath(const char* Argv0)
 {
     // This just needs to be some symbol in the binary; C++ doesn't
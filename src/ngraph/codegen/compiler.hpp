@@ -38,6 +38,7 @@ namespace clang
 
 namespace llvm
 {
+    class LLVMContext;
     class Module;
 }
 
@@ -62,7 +63,11 @@ public:
     std::unique_ptr<ngraph::codegen::Module> compile(const std::string& source);
     std::unique_ptr<clang::CodeGenAction>& get_compiler_action() { return m_compiler_action; }
 private:
+    std::unique_ptr<ngraph::codegen::Module> load_cached_module(const std::string& bitcode);
+
     std::unique_ptr<clang::CodeGenAction> m_compiler_action;
+    // Owns modules loaded from the executable cache
+    std::unique_ptr<llvm::LLVMContext> m_context;
     std::shared_ptr<CompilerCore> m_compiler_core;
     std::string m_precompiled_header_source;
     std::vector<std::string> m_header_search_paths;
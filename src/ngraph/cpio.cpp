@@ -130,11 +130,21 @@ void cpio::Header::write(ostream& stream, const string& name, uint32_t size)
     write_u32(stream, 0);        // mtime
     write_u16(stream, namesize); // namesize
     write_u32(stream, size);     // filesize
-    stream.write(name.c_str(), namesize + (namesize % 2));
+    // The name is null terminated and padded to an even length
+    char padding[2] = {0, 0};
+    stream.write(name.c_str(), name.size());
+    stream.write(padding, 1 + (namesize % 2));
+}
+
+size_t cpio::Header::get_size(const string& name)
+{
+    size_t namesize = name.size() + 1;
+    return 26 + namesize + (namesize % 2);
 }
 
 cpio::Writer::Writer()
     : m_stream(nullptr)
+    , m_offset(0)
 {
 }
 
@@ -162,15 +172,44 @@ cpio::Writer::~Writer()
 void cpio::Writer::open(ostream& out)
 {
     m_stream = &out;
+    m_offset = 0;
 }
 
 void cpio::Writer::open(const string& filename)
 {
     m_stream = &m_my_stream;
     m_my_stream.open(filename, ios_base::binary | ios_base::out);
+    m_offset = 0;
+}
+
+void cpio::Writer::write(const string& record_name,
+                         const void* data,
+                         uint32_t size_in_bytes,
+                         size_t alignment)
+{
+    if (alignment > 1)
+    {
+        if (alignment % 2)
+        {
+            throw runtime_error("cpio alignment must be even");
+        }
+        size_t data_offset = m_offset + Header::get_size(record_name);
+        if (data_offset % alignment != 0)
+        {
+            // Records always start at even offsets, so the padding size is even and the padding
+            // record needs no trailing pad byte
+            size_t padding_offset = data_offset + Header::get_size("");
+            size_t padding_size = (alignment - padding_offset % alignment) % alignment;
+            vector<char> padding(padding_size, 0);
+            write_record("", padding.data(), static_cast<uint32_t>(padding_size));
+        }
+    }
+    write_record(record_name, data, size_in_bytes);
 }
 
-void cpio::Writer::write(const string& record_name, const void* data, uint32_t size_in_bytes)
+void cpio::Writer::write_record(const string& record_name,
+                                const void* data,
+                                uint32_t size_in_bytes)
 {
     if (m_stream)
     {
@@ -181,6 +220,7 @@ void cpio::Writer::write(const string& record_name, const void* data, uint32_t s
             char ch = 0;
             m_stream->write(&ch, 1);
         }
+        m_offset += Header::get_size(record_name) + size_in_bytes + (size_in_bytes % 2);
     }
     else
     {
@@ -254,7 +294,11 @@ const vector<cpio::FileInfo>& cpio::Reader::get_file_info()
             }
 
             size_t offset = m_stream->tellg();
-            m_file_info.emplace_back(file_name, header.filesize, offset);
+            // Unnamed files only pad the following file to its alignment
+            if (!file_name.empty())
+            {
+                m_file_info.emplace_back(file_name, header.filesize, offset);
+            }
 
             m_stream->seekg((header.filesize % 2) + header.filesize, ios_base::cur);
         }
@@ -286,7 +330,8 @@ bool cpio::Reader::read(const string& file_name, void* data, size_t size_in_byte
 vector<char> cpio::Reader::read(const FileInfo& info)
 {
     vector<char> buffer(info.get_size());
-    read(info.get_name(), buffer.data(), info.get_size());
+    m_stream->seekg(info.get_offset(), ios_base::beg);
+    m_stream->read(buffer.data(), buffer.size());
     return buffer;
 }
 
@@ -57,6 +57,8 @@ public:
 
     static Header read(std::istream&);
     static void write(std::ostream&, const std::string& name, uint32_t size);
+    /// \brief Size in bytes of the header and padded name of a record named name
+    static size_t get_size(const std::string& name);
 
 private:
 };
@@ -90,11 +92,25 @@ public:
 
     void open(std::ostream& out);
     void open(const std::string& filename);
-    void write(const std::string& file_name, const void* data, uint32_t size_in_bytes);
+    /// \brief Appends a file to the archive
+    /// \param file_name The name of the file
+    /// \param data The contents of the file
+    /// \param size_in_bytes The size of the file
+    /// \param alignment If greater than 1 the contents start at a multiple of alignment bytes
+    ///        from the start of the archive, so that a memory mapped archive can be used in
+    ///        place. Alignment is achieved by inserting an unnamed padding file, which readers
+    ///        skip. Must be even.
+    void write(const std::string& file_name,
+               const void* data,
+               uint32_t size_in_bytes,
+               size_t alignment = 1);
 
 private:
+    void write_record(const std::string& file_name, const void* data, uint32_t size_in_bytes);
+
     std::ostream* m_stream;
     std::ofstream m_my_stream;
+    size_t m_offset;
 };
 
 class NGRAPH_API ngraph::cpio::Reader
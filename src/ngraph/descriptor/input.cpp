@@ -32,6 +32,8 @@ descriptor::Input::Input(Node* node, size_t index, Output& output)
 {
     m_src_node = std::shared_ptr<Node>(output.get_node());
     output.add_input(this);
+    // Nodes get these inputs while they are constructed, so nothing uses them yet
+    Node::connect_topology(m_node, m_src_node.get(), false);
 }
 
 descriptor::Input::Input(Node* node, size_t index)
@@ -45,7 +47,7 @@ descriptor::Input::Input(Node* node, size_t index)
 
 descriptor::Input::~Input()
 {
-    remove_output();
+    release_output();
 }
 
 void descriptor::Input::replace_output(Output& new_output)
@@ -57,6 +59,8 @@ void descriptor::Input::replace_output(Output& new_output)
     new_output.add_input(this);
     m_output = &new_output;
     m_src_node = std::shared_ptr<Node>(new_output.get_node());
+    m_node->set_needs_validation();
+    Node::connect_topology(m_node, m_src_node.get(), true);
 
     if (getenv_bool("NGRAPH_ENABLE_REPLACE_CHECK"))
     {
@@ -73,6 +77,15 @@ void descriptor::Input::replace_output(std::shared_ptr<Node> node, size_t i)
 }
 
 void descriptor::Input::remove_output()
+{
+    if (m_output != nullptr)
+    {
+        release_output();
+        m_node->topology_changed();
+    }
+}
+
+void descriptor::Input::release_output()
 {
     if (m_output != nullptr)
     {
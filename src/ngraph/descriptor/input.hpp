@@ -104,6 +104,10 @@ namespace ngraph
             Input& operator=(const Input&) = default;
 
         protected:
+            // Disconnects the input while its node is destroyed. Unlike remove_output it leaves
+            // the topology version alone, a node being destroyed is not part of any graph.
+            void release_output();
+
             // owner of an argument node (in lieu of m_arguments)
             std::shared_ptr<Node> m_src_node;
             Node* m_node;   // The node we are an input for
@@ -20,6 +20,7 @@
 #include <dirent.h>
 #include <ftw.h>
 #include <sys/file.h>
+#include <sys/mman.h>
 #include <sys/time.h>
 #include <unistd.h>
 #endif
@@ -379,3 +380,42 @@ bool file_util::exists(const string& filename)
     struct stat buffer;
     return (stat(filename.c_str(), &buffer) == 0);
 }
+
+file_util::MappedFile::MappedFile(const string& path)
+    : m_data(nullptr)
+    , m_size(get_file_size(path))
+    , m_is_mapped(false)
+{
+#ifndef _WIN32
+    if (m_size > 0)
+    {
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd == -1)
+        {
+            throw runtime_error("Could not open file: \"" + path + "\"");
+        }
+        // A private mapping lets callers patch data in place without touching the file
+        void* p = mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (p != MAP_FAILED)
+        {
+            m_data = static_cast<char*>(p);
+            m_is_mapped = true;
+            return;
+        }
+        NGRAPH_DEBUG << "Could not map " << path << ", reading it instead";
+    }
+#endif
+    m_contents = read_file_contents(path);
+    m_data = m_contents.data();
+}
+
+file_util::MappedFile::~MappedFile()
+{
+#ifndef _WIN32
+    if (m_is_mapped)
+    {
+        munmap(m_data, m_size);
+    }
+#endif
+}
@@ -113,5 +113,32 @@ namespace ngraph
         /// \return true if the path exists, false otherwise
         NGRAPH_API
         bool exists(const std::string& path);
+
+        /// \brief A read-only view of the contents of a file.
+        ///
+        /// Where supported the file is memory mapped copy-on-write, so the pages are loaded on
+        /// first access and are shared with every other process that maps the same file.
+        /// Otherwise the contents are read into memory.
+        class NGRAPH_API MappedFile
+        {
+        public:
+            /// \brief Maps the file at path
+            /// \param path The path of the file to map
+            MappedFile(const std::string& path);
+            ~MappedFile();
+
+            MappedFile(const MappedFile&) = delete;
+            MappedFile& operator=(const MappedFile&) = delete;
+
+            char* data() const { return m_data; }
+            size_t size() const { return m_size; }
+            /// \return true if the contents are memory mapped rather than copied
+            bool is_mapped() const { return m_is_mapped; }
+        private:
+            char* m_data;
+            size_t m_size;
+            bool m_is_mapped;
+            std::vector<char> m_contents;
+        };
     }
 }
@@ -0,0 +1,156 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cmath>
+#include <limits>
+
+#include "external_data.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
+
+namespace ngraph
+{
+    namespace onnx_import
+    {
+        namespace
+        {
+            // Constants share the mapping only when their data is aligned like the buffers they
+            // would otherwise get, unaligned data is copied
+            constexpr size_t mapped_data_alignment = 64;
+
+            size_t parse_size(const std::string& tensor_name,
+                              const std::string& key,
+                              const std::string& value)
+            {
+                try
+                {
+                    std::size_t end;
+                    auto size = std::stoull(value, &end);
+                    if (end == value.size())
+                    {
+                        return size;
+                    }
+                }
+                catch (const std::exception&)
+                {
+                }
+                throw error::tensor::invalid_external_data{tensor_name,
+                                                           "bad " + key + " '" + value + "'"};
+            }
+
+            // Locations are relative to the model directory and may not leave it, so absolute
+            // paths, drive letters and ".." components are rejected
+            bool is_inside_model_dir(const std::string& location)
+            {
+                if (location.front() == '/' || location.front() == '\\' ||
+                    location.find(':') != std::string::npos)
+                {
+                    return false;
+                }
+                std::size_t begin = 0;
+                while (begin <= location.size())
+                {
+                    std::size_t end = location.find_first_of("/\\", begin);
+                    if (end == std::string::npos)
+                    {
+                        end = location.size();
+                    }
+                    if (location.compare(begin, end - begin, "..") == 0)
+                    {
+                        return false;
+                    }
+                    begin = end + 1;
+                }
+                return true;
+            }
+        }
+
+        std::shared_ptr<op::Constant>
+            ExternalDataFiles::get_ng_constant(const onnx::TensorProto& tensor,
+                                               const element::Type& type,
+                                               const Shape& shape)
+        {
+            std::string location;
+            std::size_t offset = 0;
+            std::size_t length = std::numeric_limits<std::size_t>::max();
+            for (const auto& entry : tensor.external_data())
+            {
+                if (entry.key() == "location")
+                {
+                    location = entry.value();
+                }
+                else if (entry.key() == "offset")
+                {
+                    offset = parse_size(tensor.name(), entry.key(), entry.value());
+                }
+                else if (entry.key() == "length")
+                {
+                    length = parse_size(tensor.name(), entry.key(), entry.value());
+                }
+            }
+            if (location.empty())
+            {
+                throw error::tensor::invalid_external_data{tensor.name(), "no location"};
+            }
+            if (!is_inside_model_dir(location))
+            {
+                throw error::tensor::invalid_external_data{
+                    tensor.name(), "location " + location + " is outside the model directory"};
+            }
+
+            std::size_t size = std::ceil(shape_size(shape) * type.bitwidth() / 8.f);
+            if (length != std::numeric_limits<std::size_t>::max() && length != size)
+            {
+                throw error::tensor::invalid_external_data{
+                    tensor.name(),
+                    "length " + std::to_string(length) + " does not match the " +
+                        std::to_string(size) + " bytes of the tensor"};
+            }
+
+            auto file = get_file(m_model_dir.empty() ? location
+                                                     : file_util::path_join(m_model_dir, location));
+            if (offset > file->size() || file->size() - offset < size)
+            {
+                throw error::tensor::invalid_external_data{
+                    tensor.name(), "data extends past the end of " + location};
+            }
+
+            char* data = file->data() + offset;
+            if (file->is_mapped() &&
+                reinterpret_cast<std::size_t>(data) % mapped_data_alignment == 0)
+            {
+                auto buffer =
+                    std::make_shared<runtime::SharedBuffer<std::shared_ptr<file_util::MappedFile>>>(
+                        data, size, file);
+                return std::make_shared<op::Constant>(type, shape, buffer);
+            }
+            return std::make_shared<op::Constant>(type, shape, data);
+        }
+
+        std::shared_ptr<file_util::MappedFile> ExternalDataFiles::get_file(const std::string& path)
+        {
+            auto it = m_files.find(path);
+            if (it == std::end(m_files))
+            {
+                if (!file_util::exists(path))
+                {
+                    throw ngraph_error{"Failure opening external data file: " + path};
+                }
+                it = m_files.emplace(path, std::make_shared<file_util::MappedFile>(path)).first;
+            }
+            return it->second;
+        }
+    }
+}
@@ -0,0 +1,77 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <onnx/onnx_pb.h>
+#include <string>
+
+#include "ngraph/except.hpp"
+#include "ngraph/file_util.hpp"
+#include "ngraph/op/constant.hpp"
+
+namespace ngraph
+{
+    namespace onnx_import
+    {
+        namespace error
+        {
+            namespace tensor
+            {
+                struct invalid_external_data : ngraph_error
+                {
+                    invalid_external_data(const std::string& tensor_name,
+                                          const std::string& reason)
+                        : ngraph_error{"invalid external data of tensor " + tensor_name + ": " +
+                                       reason}
+                    {
+                    }
+                };
+            }
+        }
+
+        /// \brief Data files referenced by tensors stored outside of the model
+        ///
+        /// Tensors with data_location EXTERNAL describe their data by a location relative to
+        /// the model file and an optional offset and length. Every data file is memory mapped
+        /// once, and the constants built from it share the mapping rather than copying it.
+        ///
+        /// More:
+        /// https://github.com/onnx/onnx/blob/master/docs/ExternalData.md
+        class ExternalDataFiles
+        {
+        public:
+            /// \param model_dir Directory that tensor locations are relative to
+            explicit ExternalDataFiles(const std::string& model_dir)
+                : m_model_dir{model_dir}
+            {
+            }
+
+            /// \brief Builds a Constant from a tensor whose data is stored in an external file
+            std::shared_ptr<op::Constant> get_ng_constant(const onnx::TensorProto& tensor,
+                                                          const element::Type& type,
+                                                          const Shape& shape);
+
+        private:
+            std::shared_ptr<file_util::MappedFile> get_file(const std::string& path);
+
+            std::string m_model_dir;
+            std::map<std::string, std::shared_ptr<file_util::MappedFile>> m_files;
+        };
+    }
+}
@@ -19,13 +19,15 @@
 #include "model.hpp"
 #include "ngraph/log.hpp"
 #include "ops_bridge.hpp"
+#include "tensor.hpp"
 
 namespace ngraph
 {
     namespace onnx_import
     {
-        Model::Model(const onnx::ModelProto& model_proto)
+        Model::Model(const onnx::ModelProto& model_proto, const std::string& model_dir)
             : m_model_proto{&model_proto}
+            , m_external_data{std::make_shared<ExternalDataFiles>(model_dir)}
         {
             // Walk through the elements of opset_import field and register operator sets
             // for each domain. An exception UnknownDomain() will raise if the domain is
@@ -92,6 +94,48 @@ namespace ngraph
             }
         }
 
+        void Model::preload_initializers(onnx::GraphProto& graph_proto)
+        {
+            for (auto& initializer : *graph_proto.mutable_initializer())
+            {
+                if (!initializer.has_name())
+                {
+                    continue;
+                }
+                m_preloaded[&initializer] =
+                    Tensor{initializer, m_external_data.get()}.get_ng_constant();
+                detail::tensor::release_data(initializer);
+            }
+            // Graphs held by node attributes build their initializers through the same model
+            for (auto& node : *graph_proto.mutable_node())
+            {
+                for (auto& attribute : *node.mutable_attribute())
+                {
+                    if (attribute.has_g())
+                    {
+                        preload_initializers(*attribute.mutable_g());
+                    }
+                    for (auto& graph : *attribute.mutable_graphs())
+                    {
+                        preload_initializers(graph);
+                    }
+                }
+            }
+        }
+
+        std::shared_ptr<op::Constant>
+            Model::get_initializer_constant(const onnx::TensorProto& initializer)
+        {
+            auto it = m_preloaded.find(&initializer);
+            if (it == std::end(m_preloaded))
+            {
+                return Tensor{initializer, m_external_data.get()}.get_ng_constant();
+            }
+            auto constant = std::move(it->second);
+            m_preloaded.erase(it);
+            return constant;
+        }
+
     } // namespace onnx_import
 
 } // namespace ngraph
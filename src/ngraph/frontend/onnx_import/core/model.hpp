@@ -16,11 +16,15 @@
 
 #pragma once
 
+#include <map>
+#include <memory>
 #include <onnx/onnx_pb.h>
 #include <ostream>
 #include <string>
 #include <unordered_map>
 
+#include "external_data.hpp"
+#include "ngraph/op/constant.hpp"
 #include "operator_set.hpp"
 
 namespace ngraph
@@ -31,7 +35,10 @@ namespace ngraph
         {
         public:
             Model() = delete;
-            explicit Model(const onnx::ModelProto& model_proto);
+            /// \param model_proto The model
+            /// \param model_dir The directory of the model file, external data locations are
+            ///        relative to it
+            explicit Model(const onnx::ModelProto& model_proto, const std::string& model_dir = "");
 
             Model(const Model&) = default;
             Model(Model&&) = default;
@@ -72,9 +79,24 @@ namespace ngraph
             ///
             void enable_opset_domain(const std::string& domain);
 
+            ExternalDataFiles* get_external_data() const { return m_external_data.get(); }
+            /// \brief Converts the initializers of graph_proto to constants ahead of the graph.
+            ///
+            /// The data of every initializer is released from the proto as soon as its constant
+            /// exists, so the weights of the model are never held twice during import. Subgraphs
+            /// stored in node attributes are visited as well.
+            void preload_initializers(onnx::GraphProto& graph_proto);
+
+            /// \brief Returns the constant holding the data of an initializer, either the one
+            ///        made by preload_initializers() or a new one.
+            std::shared_ptr<op::Constant>
+                get_initializer_constant(const onnx::TensorProto& initializer);
+
         private:
             const onnx::ModelProto* m_model_proto;
             std::unordered_map<std::string, OperatorSet> m_opset;
+            std::shared_ptr<ExternalDataFiles> m_external_data;
+            std::map<const onnx::TensorProto*, std::shared_ptr<op::Constant>> m_preloaded;
         };
 
         inline std::ostream& operator<<(std::ostream& outs, const Model& model)
@@ -20,6 +20,7 @@
 #include <utility>
 #include <vector>
 
+#include "external_data.hpp"
 #include "ngraph/op/constant.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
@@ -350,6 +351,24 @@ namespace ngraph
                     }
                     throw error::tensor::invalid_data_type{tensor.data_type()};
                 }
+
+                template <typename T>
+                inline void release_field(google::protobuf::RepeatedField<T>* field)
+                {
+                    // Clear() keeps the capacity, only swapping with an empty field frees it
+                    google::protobuf::RepeatedField<T>{}.Swap(field);
+                }
+
+                /// \brief Frees the memory holding the values of tensor
+                inline void release_data(onnx::TensorProto& tensor)
+                {
+                    delete tensor.release_raw_data();
+                    release_field(tensor.mutable_float_data());
+                    release_field(tensor.mutable_double_data());
+                    release_field(tensor.mutable_int32_data());
+                    release_field(tensor.mutable_int64_data());
+                    release_field(tensor.mutable_uint64_data());
+                }
             }
         }
 
@@ -377,9 +396,14 @@ namespace ngraph
             };
 
             Tensor() = delete;
-            explicit Tensor(const onnx::TensorProto& tensor)
+            /// \param tensor The tensor proto
+            /// \param external_data Resolves tensors stored outside of the model, may be null if
+            ///        the tensor is known to hold its data
+            explicit Tensor(const onnx::TensorProto& tensor,
+                            ExternalDataFiles* external_data = nullptr)
                 : m_tensor_proto{&tensor}
                 , m_shape{std::begin(tensor.dims()), std::end(tensor.dims())}
+                , m_external_data{external_data}
             {
                 if (m_shape == Shape{0})
                 {
@@ -404,6 +428,10 @@ namespace ngraph
                 {
                     throw error::tensor::segments_unsupported{};
                 }
+                if (has_external_data())
+                {
+                    return get_ng_constant()->template get_vector<T>();
+                }
                 return detail::tensor::get_data<T>(*m_tensor_proto);
             }
 
@@ -452,8 +480,23 @@ namespace ngraph
             }
 
             operator TensorProto_DataType() const { return m_tensor_proto->data_type(); }
+            bool has_external_data() const
+            {
+                return m_tensor_proto->data_location() == onnx::TensorProto_DataLocation_EXTERNAL;
+            }
+
             std::shared_ptr<ngraph::op::Constant> get_ng_constant() const
             {
+                if (has_external_data())
+                {
+                    if (m_external_data == nullptr)
+                    {
+                        throw error::tensor::invalid_external_data{
+                            get_name(), "external data is only supported for initializers"};
+                    }
+                    return m_external_data->get_ng_constant(
+                        *m_tensor_proto, get_ng_type(), m_shape);
+                }
                 switch (m_tensor_proto->data_type())
                 {
                 case onnx::TensorProto_DataType::TensorProto_DataType_BOOL:
@@ -488,11 +531,19 @@ namespace ngraph
             template <typename T>
             std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const
             {
+                // Raw data already has the layout of the constant, so copy it only once
+                if (m_tensor_proto->has_raw_data() && !m_tensor_proto->has_segment() &&
+                    m_tensor_proto->raw_data().size() == shape_size(m_shape) * sizeof(T))
+                {
+                    return std::make_shared<ngraph::op::Constant>(
+                        type, m_shape, m_tensor_proto->raw_data().data());
+                }
                 return std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
             }
 
             const onnx::TensorProto* m_tensor_proto;
             Shape m_shape;
+            ExternalDataFiles* m_external_data;
         };
 
         inline std::ostream& operator<<(std::ostream& outs, const Tensor& tensor)
@@ -22,6 +22,7 @@
 #include "core/graph.hpp"
 #include "core/model.hpp"
 #include "ngraph/except.hpp"
+#include "ngraph/file_util.hpp"
 #include "onnx.hpp"
 #include "ops_bridge.hpp"
 
@@ -52,7 +53,8 @@ namespace ngraph
             } // namespace error
         }     // namespace detail
 
-        std::shared_ptr<Function> import_onnx_model(std::istream& stream)
+        std::shared_ptr<Function> import_onnx_model(std::istream& stream,
+                                                    const std::string& model_dir)
         {
             onnx::ModelProto model_proto;
             // Try parsing input as a binary protobuf message
@@ -69,7 +71,8 @@ namespace ngraph
                 }
             }
 
-            Model model{model_proto};
+            Model model{model_proto, model_dir};
+            model.preload_initializers(*model_proto.mutable_graph());
             Graph graph{model_proto.graph(), model};
             auto function = std::make_shared<Function>(
                 graph.get_ng_outputs(), graph.get_ng_parameters(), graph.get_name());
@@ -87,7 +90,9 @@ namespace ngraph
             {
                 throw detail::error::file_open{file_path};
             }
-            return import_onnx_model(ifs);
+            // get_directory() returns a bare file name unchanged
+            auto model_dir = file_util::get_directory(file_path);
+            return import_onnx_model(ifs, model_dir == file_path ? "" : model_dir);
         }
 
         std::set<std::string> get_supported_operators(std::int64_t version,
@@ -17,6 +17,8 @@
 #include <algorithm>
 #include <list>
 #include <memory>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
@@ -85,13 +87,185 @@ void Function::validate_nodes_and_infer_types()
         // If we find a parameter make sure it is in the list of parameters of the function
         if (node->is_parameter())
         {
-            auto it = std::find(m_parameters.begin(), m_parameters.end(), node);
-            if (it == m_parameters.end())
+            check_parameter_is_declared(node);
+        }
+    }
+    m_validated_change_count = Node::get_change_count();
+}
+
+// True if one of results depends on node. Answers are kept in known, so the searches of one
+// validation visit each node at most once.
+static bool is_used_by_results(Node* node,
+                               const unordered_set<Node*>& results,
+                               unordered_map<Node*, bool>& known)
+{
+    auto it = known.find(node);
+    if (it != known.end())
+    {
+        return it->second;
+    }
+    struct Frame
+    {
+        Node* node;
+        vector<Node*> users;
+        size_t next;
+    };
+    vector<Frame> path;
+    auto push = [&](Node* n) {
+        // Stays false unless a result is found while n is on the path
+        known[n] = false;
+        path.push_back(Frame{n, {}, 0});
+        for (auto& output : n->outputs())
+        {
+            for (auto& input : output.get_target_inputs())
+            {
+                path.back().users.push_back(input.get_node());
+            }
+        }
+        for (Node* dependent : n->get_control_dependents())
+        {
+            path.back().users.push_back(dependent);
+        }
+    };
+    push(node);
+    while (!path.empty())
+    {
+        Frame& frame = path.back();
+        if (results.count(frame.node) != 0)
+        {
+            break;
+        }
+        if (frame.next == frame.users.size())
+        {
+            path.pop_back();
+            continue;
+        }
+        Node* user = frame.users[frame.next++];
+        auto user_it = known.find(user);
+        if (user_it == known.end())
+        {
+            push(user);
+        }
+        else if (user_it->second)
+        {
+            break;
+        }
+    }
+    for (auto& frame : path)
+    {
+        known[frame.node] = true;
+    }
+    return !path.empty();
+}
+
+void Function::validate_changed_nodes_and_infer_types()
+{
+    if (m_validated_change_count == Node::get_change_count())
+    {
+        return;
+    }
+
+    // The graphs of the function may also hold nodes of other functions that share nodes with
+    // this one, and nodes that were cut out of it but are still alive. Those are left listed.
+    vector<Node*> graph_nodes;
+    unordered_set<Node*> results;
+    for (auto& result : m_results)
+    {
+        graph_nodes.push_back(result.get());
+        results.insert(result.get());
+    }
+    unordered_set<Node*> parameters;
+    for (auto& parameter : m_parameters)
+    {
+        graph_nodes.push_back(parameter.get());
+        parameters.insert(parameter.get());
+    }
+    unordered_map<Node*, bool> known;
+    auto is_in_function = [&](Node* node) {
+        return parameters.count(node) != 0 || is_used_by_results(node, results, known);
+    };
+
+    vector<Node*> stack;
+    for (vector<Node*> dirty = Node::take_dirty_nodes(graph_nodes, is_in_function); !dirty.empty();
+         dirty = Node::take_dirty_nodes(graph_nodes, is_in_function))
+    {
+        for (Node* dirty_node : dirty)
+        {
+            stack.push_back(dirty_node);
+            while (!stack.empty())
             {
-                throw ngraph_error("Function references undeclared parameter");
+                Node* node = stack.back();
+                if (!node->get_needs_validation())
+                {
+                    stack.pop_back();
+                    continue;
+                }
+                // Arguments that changed as well are validated first
+                bool arguments_validated = true;
+                for (auto& input : node->inputs())
+                {
+                    Node* argument = input.get_source_output().get_node();
+                    if (argument->get_needs_validation())
+                    {
+                        stack.push_back(argument);
+                        arguments_validated = false;
+                    }
+                }
+                if (!arguments_validated)
+                {
+                    continue;
+                }
+                stack.pop_back();
+
+                vector<pair<element::Type, PartialShape>> output_types;
+                for (auto& output : node->outputs())
+                {
+                    output_types.emplace_back(output.get_element_type(),
+                                              output.get_partial_shape());
+                }
+
+                node->revalidate_and_infer_types();
+
+                if (node->is_parameter())
+                {
+                    check_parameter_is_declared(node->shared_from_this());
+                }
+                // A changed node may have been connected to a parameter that is not declared
+                for (auto& input : node->inputs())
+                {
+                    if (input.get_source_output().get_node()->is_parameter())
+                    {
+                        check_parameter_is_declared(
+                            input.get_source_output().get_node_shared_ptr());
+                    }
+                }
+
+                // Users of changed outputs join the list and are taken by the next round
+                for (size_t i = 0; i < output_types.size(); ++i)
+                {
+                    auto output = node->output(i);
+                    if (output.get_element_type() != output_types[i].first ||
+                        !output.get_partial_shape().same_scheme(output_types[i].second))
+                    {
+                        for (auto& target : output.get_target_inputs())
+                        {
+                            target.get_node()->set_needs_validation();
+                        }
+                    }
+                }
             }
         }
     }
+    m_validated_change_count = Node::get_change_count();
+}
+
+void Function::check_parameter_is_declared(const shared_ptr<Node>& node) const
+{
+    auto it = std::find(m_parameters.begin(), m_parameters.end(), node);
+    if (it == m_parameters.end())
+    {
+        throw ngraph_error("Function references undeclared parameter");
+    }
 }
 
 void Function::init()
@@ -101,6 +275,19 @@ void Function::init()
 
 std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
 {
+    lock_guard<mutex> lock(m_ordered_ops_mutex);
+    vector<shared_ptr<Node>> ordered_ops;
+    size_t version = get_topology_version();
+    if (m_ordered_ops_valid && m_ordered_ops_version == version)
+    {
+        ordered_ops.reserve(m_ordered_ops.size());
+        for (Node* node : m_ordered_ops)
+        {
+            ordered_ops.push_back(node->shared_from_this());
+        }
+        return ordered_ops;
+    }
+
     vector<shared_ptr<Node>> nodes;
     for (auto& r : get_results())
     {
@@ -111,7 +298,39 @@ std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
         nodes.push_back(param);
     }
 
-    return m_topological_sorter(nodes);
+    ordered_ops = m_topological_sorter(nodes);
+    m_ordered_ops.clear();
+    m_ordered_ops.reserve(ordered_ops.size());
+    for (auto& node : ordered_ops)
+    {
+        m_ordered_ops.push_back(node.get());
+    }
+    // A change during the sort leaves the cache stale for the next call
+    m_ordered_ops_version = version;
+    m_ordered_ops_valid = true;
+    return ordered_ops;
+}
+
+void Function::invalidate_ordered_ops()
+{
+    lock_guard<mutex> lock(m_ordered_ops_mutex);
+    m_ordered_ops_valid = false;
+    m_ordered_ops.clear();
+}
+
+size_t Function::get_topology_version() const
+{
+    // Every node of the function is connected to a result or is a parameter
+    size_t version = 0;
+    for (auto& result : m_results)
+    {
+        version = max(version, result->get_topology_version());
+    }
+    for (auto& parameter : m_parameters)
+    {
+        version = max(version, parameter->get_topology_version());
+    }
+    return version;
 }
 
 void Function::map_unordered_ops(std::function<void(Node*)> f) const
@@ -297,9 +516,11 @@ void Function::replace_parameter(size_t parameter_index, const shared_ptr<op::Pa
                  " parameters.");
     replace_node(m_parameters[parameter_index], parameter);
     m_parameters[parameter_index] = parameter;
+    invalidate_ordered_ops();
 }
 
 void Function::set_topological_sort(topological_sort_t sorter)
 {
     m_topological_sorter = sorter;
+    invalidate_ordered_ops();
 }
@@ -20,7 +20,9 @@
 #include <initializer_list>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "ngraph/lambda.hpp"
@@ -93,6 +95,10 @@ namespace ngraph
         const std::string& get_friendly_name() const;
 
         std::vector<std::shared_ptr<Node>> get_ops() const;
+        /// \brief Returns the nodes of the function in topological order.
+        ///
+        /// The order is cached and only recomputed after the connectivity of the function's
+        /// graph changed, see Node::get_topology_version.
         std::vector<std::shared_ptr<Node>> get_ordered_ops() const;
         void map_unordered_ops(std::function<void(Node*)> f) const;
 
@@ -105,6 +111,15 @@ namespace ngraph
 
         void validate_nodes_and_infer_types();
 
+        /// \brief Revalidates only the nodes that changed since they were last validated, see
+        ///        Node::set_needs_validation, and the users of nodes whose output types
+        ///        changed as a result.
+        ///
+        /// The changed nodes are taken from lists kept per connected graph, see
+        /// Node::take_dirty_nodes. The cost depends on the changed nodes and the nodes between
+        /// them and the results, not on the graph size or on changes to other graphs.
+        void validate_changed_nodes_and_infer_types();
+
         /// \brief Returns the sum of the size of all nodes in the graph plus the size of
         /// all constant data. This has little value beyond comparing the relative size of
         /// graphs and should not be considered the actual memory consumption of a graph.
@@ -138,11 +153,26 @@ namespace ngraph
         Function(const Function&&) = delete;
         Function& operator=(const Function&) = delete;
 
+        void check_parameter_is_declared(const std::shared_ptr<Node>& node) const;
+        void invalidate_ordered_ops();
+        // The largest topology version of the graphs of the results and parameters. It
+        // increases whenever the connectivity of the function changes.
+        size_t get_topology_version() const;
+
         static std::atomic<size_t> m_next_instance_id;
         size_t m_instance_id;
         std::string m_name;
         const std::string m_unique_name;
         size_t m_placement{0};
+        // Node::get_change_count() when all nodes were last known to be validated
+        size_t m_validated_change_count{0};
         topological_sort_t m_topological_sorter;
+
+        // Nodes stay alive while they are connected, and disconnecting one from the function
+        // changes its topology version, so the cache does not need to own them
+        mutable std::mutex m_ordered_ops_mutex;
+        mutable std::vector<Node*> m_ordered_ops;
+        mutable size_t m_ordered_ops_version{0};
+        mutable bool m_ordered_ops_valid{false};
     };
 }
@@ -284,23 +284,25 @@ bool ngraph::is_post_dominated(Node* X, Node* Y)
     return true;
 }
 
-std::vector<std::shared_ptr<ngraph::Node>>
-    ngraph::clone_nodes(const std::vector<std::shared_ptr<ngraph::Node>>& nodes, NodeMap& node_map)
+// Clones nodes that are already in topological order
+static void clone_sorted_nodes(const std::vector<std::shared_ptr<ngraph::Node>>& sorted_nodes,
+                               NodeMap& node_map)
 {
-    // for each node in topological order
-    auto sorted_nodes = topological_sort(nodes);
-    for (auto node : sorted_nodes)
+    node_map.reserve(node_map.size() + sorted_nodes.size());
+    OutputVector cloned_args;
+    std::vector<std::shared_ptr<Node>> cloned_dependencies;
+    for (auto& node : sorted_nodes)
     {
         if (node_map.count(node.get()) == 0)
         {
             // get (already) cloned arguments and clone the node
-            OutputVector cloned_args;
-            for (auto input : node->inputs())
+            cloned_args.clear();
+            for (size_t i = 0; i < node->get_input_size(); ++i)
             {
-                Output<Node> output = input.get_source_output();
+                Output<Node> output = node->input_value(i);
                 cloned_args.push_back(output.for_node(node_map.at(output.get_node())));
             }
-            std::vector<std::shared_ptr<Node>> cloned_dependencies;
+            cloned_dependencies.clear();
             for (auto& dependency : node->get_control_dependencies())
             {
                 shared_ptr<Node>& dependent = node_map.at(dependency.get());
@@ -311,13 +313,15 @@ std::vector<std::shared_ptr<ngraph::Node>>
                 }
             }
             auto cloned_node = node->copy_with_new_inputs(cloned_args, cloned_dependencies);
-            if (node->get_friendly_name() != node->get_name())
+            // Only look at the unique name when there is a friendly name, since building it
+            // allocates
+            if (node->has_friendly_name() && node->get_friendly_name() != node->get_name())
             {
                 // There is a friendly name for this node so copy it
                 cloned_node->set_friendly_name(node->get_friendly_name());
             }
 
-            for (auto tag : node->get_provenance_tags())
+            for (auto& tag : node->get_provenance_tags())
             {
                 cloned_node->add_provenance_tag(tag);
             }
@@ -326,10 +330,18 @@ std::vector<std::shared_ptr<ngraph::Node>>
             node_map[node.get()] = cloned_node;
         }
     }
+}
+
+std::vector<std::shared_ptr<ngraph::Node>>
+    ngraph::clone_nodes(const std::vector<std::shared_ptr<ngraph::Node>>& nodes, NodeMap& node_map)
+{
+    // for each node in topological order
+    clone_sorted_nodes(topological_sort(nodes), node_map);
 
     // create and return vector of cloned nodes
     // order matches input vector (not necessarily topological)
     std::vector<std::shared_ptr<ngraph::Node>> cloned_nodes;
+    cloned_nodes.reserve(nodes.size());
     for (auto node : nodes)
     {
         cloned_nodes.push_back(node_map.at(node.get()));
@@ -410,11 +422,12 @@ std::shared_ptr<ngraph::Function> ngraph::clone_function(const ngraph::Function&
 std::shared_ptr<ngraph::Function> ngraph::clone_function(const ngraph::Function& func,
                                                          NodeMap& node_map)
 {
-    // clone function operations
-    clone_nodes(func.get_ops(), node_map);
+    // clone function operations, the cached order of the function saves sorting them again
+    clone_sorted_nodes(func.get_ordered_ops(), node_map);
 
     // get cloned function results and parameters
     ResultVector cloned_results;
+    cloned_results.reserve(func.get_results().size());
     for (shared_ptr<Node> node : func.get_results())
     {
         auto result = as_type_ptr<op::Result>(node_map.at(node.get()));
@@ -425,7 +438,8 @@ std::shared_ptr<ngraph::Function> ngraph::clone_function(const ngraph::Function&
         cloned_results.push_back(result);
     }
     std::vector<std::shared_ptr<op::Parameter>> cloned_params;
-    for (auto param : func.get_parameters())
+    cloned_params.reserve(func.get_parameters().size());
+    for (auto& param : func.get_parameters())
     {
         cloned_params.push_back(as_type_ptr<op::Parameter>(node_map.at(param.get())));
     }
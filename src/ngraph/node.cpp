@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <typeindex>
 #include <typeinfo>
@@ -34,6 +35,12 @@ using namespace std;
 using namespace ngraph;
 
 atomic<size_t> Node::m_next_instance_id(0);
+atomic<size_t> Node::m_change_count(0);
+
+Node::Node()
+{
+    m_change_count++;
+}
 
 Node::Node(size_t output_size)
     : Node()
@@ -44,6 +51,7 @@ Node::Node(size_t output_size)
 Node::Node(const std::string& node_type, const NodeVector& arguments, size_t output_size)
     : m_node_type(node_type)
 {
+    m_change_count++;
     set_arguments(arguments);
     set_output_size(output_size);
 }
@@ -64,6 +72,7 @@ Node::Node(const OutputVector& arguments, size_t output_size)
 
 Node::~Node()
 {
+    unlist_dirty();
     for (descriptor::Input& input : m_inputs)
     {
         if (input.has_output())
@@ -74,11 +83,11 @@ Node::~Node()
             {
                 // Don't want to trigger a deep recursive delete
                 NodeVector nodes{input.get_output().get_node()};
-                input.remove_output();
+                input.release_output();
                 safe_delete(nodes, true);
                 return;
             }
-            input.remove_output();
+            input.release_output();
         }
     }
 }
@@ -178,7 +187,7 @@ void Node::safe_delete(NodeVector& nodes, bool recurse)
                 // Move the node from the input to nodes so we don't trigger a deep recursive delete
                 nodes.push_back(node);
             }
-            input.remove_output();
+            input.release_output();
         }
     }
     if (recurse)
@@ -253,7 +262,7 @@ void Node::set_argument(size_t position, const Output<Node>& argument)
 void Node::constructor_validate_and_infer_types()
 {
 #ifdef IN_TRANSITION
-    validate_and_infer_types();
+    revalidate_and_infer_types();
 #endif
 }
 
@@ -265,6 +274,192 @@ void Node::delayed_validate_and_infer_types()
 }
 #undef IN_TRANSITION
 
+// Connecting two graphs merges their Topology objects, and disconnecting nodes never splits one,
+// so a Topology may also cover nodes that are no longer connected. Versions are taken from one
+// counter for the whole process and a merged Topology keeps the larger version, so the version
+// of a graph increases with every change to it. The Topology of lower rank is merged into the
+// other one, which keeps the chains of merged objects short.
+//
+// The Topology also lists the nodes of the graph marked by set_needs_validation, so incremental
+// validation only looks at the nodes that changed. A node leaves the list when it is validated or
+// destroyed.
+struct Node::Topology
+{
+    shared_ptr<Topology> merged_into;
+    size_t version{0};
+    size_t rank{0};
+    mutex dirty_mutex;
+    Node* dirty_head{nullptr};
+};
+
+static atomic<size_t> s_last_topology_version(0);
+
+size_t Node::get_topology_version() const
+{
+    // Does not shorten paths, so concurrent readers do not write
+    const Topology* topology = m_topology.get();
+    while (topology && topology->merged_into)
+    {
+        topology = topology->merged_into.get();
+    }
+    return topology ? topology->version : 0;
+}
+
+shared_ptr<Node::Topology> Node::get_topology()
+{
+    while (m_topology && m_topology->merged_into)
+    {
+        m_topology = m_topology->merged_into;
+    }
+    return m_topology;
+}
+
+void Node::connect_topology(Node* user, Node* source, bool changed)
+{
+    auto topology = user->get_topology();
+    auto source_topology = source->get_topology();
+    if (!topology)
+    {
+        topology = source_topology ? source_topology : make_shared<Topology>();
+    }
+    else if (source_topology && source_topology != topology)
+    {
+        if (topology->rank < source_topology->rank)
+        {
+            swap(topology, source_topology);
+        }
+        else if (topology->rank == source_topology->rank)
+        {
+            topology->rank++;
+        }
+        topology->version = max(topology->version, source_topology->version);
+        source_topology->merged_into = topology;
+
+        std::lock(topology->dirty_mutex, source_topology->dirty_mutex);
+        lock_guard<mutex> lock(topology->dirty_mutex, adopt_lock);
+        lock_guard<mutex> source_lock(source_topology->dirty_mutex, adopt_lock);
+        if (Node* head = source_topology->dirty_head)
+        {
+            Node* tail = head;
+            while (tail->m_dirty_next)
+            {
+                tail = tail->m_dirty_next;
+            }
+            tail->m_dirty_next = topology->dirty_head;
+            if (topology->dirty_head)
+            {
+                topology->dirty_head->m_dirty_prev = tail;
+            }
+            topology->dirty_head = head;
+            source_topology->dirty_head = nullptr;
+        }
+    }
+    user->m_topology = topology;
+    source->m_topology = topology;
+    if (changed)
+    {
+        topology->version = ++s_last_topology_version;
+    }
+}
+
+void Node::topology_changed()
+{
+    auto topology = get_topology();
+    if (!topology)
+    {
+        m_topology = topology = make_shared<Topology>();
+    }
+    topology->version = ++s_last_topology_version;
+}
+
+void Node::revalidate_and_infer_types()
+{
+    validate_and_infer_types();
+    m_needs_validation = false;
+    unlist_dirty();
+}
+
+void Node::set_needs_validation()
+{
+    m_needs_validation = true;
+    m_change_count++;
+    if (!m_dirty_listed)
+    {
+        auto topology = get_topology();
+        if (!topology)
+        {
+            m_topology = topology = make_shared<Topology>();
+        }
+        lock_guard<mutex> lock(topology->dirty_mutex);
+        m_dirty_listed = true;
+        m_dirty_prev = nullptr;
+        m_dirty_next = topology->dirty_head;
+        if (topology->dirty_head)
+        {
+            topology->dirty_head->m_dirty_prev = this;
+        }
+        topology->dirty_head = this;
+    }
+}
+
+void Node::unlist_dirty()
+{
+    if (m_dirty_listed)
+    {
+        auto topology = get_topology();
+        lock_guard<mutex> lock(topology->dirty_mutex);
+        unlink_dirty(*topology);
+    }
+}
+
+void Node::unlink_dirty(Topology& topology)
+{
+    if (m_dirty_prev)
+    {
+        m_dirty_prev->m_dirty_next = m_dirty_next;
+    }
+    else
+    {
+        topology.dirty_head = m_dirty_next;
+    }
+    if (m_dirty_next)
+    {
+        m_dirty_next->m_dirty_prev = m_dirty_prev;
+    }
+    m_dirty_prev = nullptr;
+    m_dirty_next = nullptr;
+    m_dirty_listed = false;
+}
+
+vector<Node*> Node::take_dirty_nodes(const vector<Node*>& nodes,
+                                     const function<bool(Node*)>& take)
+{
+    vector<Node*> dirty;
+    // Several of the nodes are usually part of the same graph
+    unordered_set<Topology*> visited;
+    for (Node* graph_node : nodes)
+    {
+        auto topology = graph_node->get_topology();
+        if (!topology || !visited.insert(topology.get()).second)
+        {
+            continue;
+        }
+        lock_guard<mutex> lock(topology->dirty_mutex);
+        Node* node = topology->dirty_head;
+        while (node)
+        {
+            Node* next = node->m_dirty_next;
+            if (take(node))
+            {
+                node->unlink_dirty(*topology);
+                dirty.push_back(node);
+            }
+            node = next;
+        }
+    }
+    return dirty;
+}
+
 void Node::set_output_size(size_t n)
 {
     NGRAPH_CHECK(n >= m_outputs.size(), "shrinking ", m_outputs.size(), " to ", n);
@@ -302,16 +497,46 @@ void Node::set_output_type(size_t i, const element::Type& element_type, const Pa
     get_output_descriptor(i).get_tensor_ptr()->set_tensor_type(element_type, pshape);
 }
 
-std::deque<descriptor::Output>& Node::get_outputs()
+Node::OutputDescriptors& Node::get_outputs()
 {
     return m_outputs;
 }
 
-const std::deque<descriptor::Output>& Node::get_outputs() const
+const Node::OutputDescriptors& Node::get_outputs() const
 {
     return m_outputs;
 }
 
+unordered_set<descriptor::Tensor*>& Node::get_liveness_new_list()
+{
+    if (!m_liveness)
+    {
+        m_liveness.reset(new Liveness());
+    }
+    return m_liveness->new_list;
+}
+
+const unordered_set<descriptor::Tensor*>& Node::get_liveness_new_list() const
+{
+    static const unordered_set<descriptor::Tensor*> empty;
+    return m_liveness ? m_liveness->new_list : empty;
+}
+
+unordered_set<descriptor::Tensor*>& Node::get_liveness_free_list()
+{
+    if (!m_liveness)
+    {
+        m_liveness.reset(new Liveness());
+    }
+    return m_liveness->free_list;
+}
+
+const unordered_set<descriptor::Tensor*>& Node::get_liveness_free_list() const
+{
+    static const unordered_set<descriptor::Tensor*> empty;
+    return m_liveness ? m_liveness->free_list : empty;
+}
+
 bool Node::is_output() const
 {
     return false;
@@ -369,12 +594,19 @@ void Node::set_placement(Placement placement)
 
 void Node::add_provenance_group_member(const shared_ptr<Node>& node)
 {
-    m_provenance_group.insert(node);
+    if (!m_provenance)
+    {
+        m_provenance.reset(new Provenance());
+    }
+    m_provenance->group.insert(node);
 }
 
 void Node::remove_provenance_group_member(const shared_ptr<Node>& node)
 {
-    m_provenance_group.erase(node);
+    if (m_provenance)
+    {
+        m_provenance->group.erase(node);
+    }
 }
 
 void Node::replace_provenance_group_member(const shared_ptr<Node>& current_node,
@@ -393,7 +625,8 @@ void Node::replace_provenance_group_member(const shared_ptr<Node>& current_node,
 
 const set<shared_ptr<Node>>& Node::get_provenance_group_members() const
 {
-    return m_provenance_group;
+    static const set<shared_ptr<Node>> empty;
+    return m_provenance ? m_provenance->group : empty;
 }
 
 shared_ptr<Node> Node::add_provenance_group_members_above(const OutputVector& base)
@@ -425,7 +658,7 @@ shared_ptr<Node> Node::add_provenance_group_members_above(const OutputVector& ba
         add_provenance_group_member(node->shared_from_this());
         for (auto value : node->input_values())
         {
-            if (m_provenance_group.count(value.get_node_shared_ptr()) == 0)
+            if (m_provenance->group.count(value.get_node_shared_ptr()) == 0)
             {
                 todo.push_back(value.get_node());
             }
@@ -463,13 +696,18 @@ void Node::add_provenance_tags_above(const OutputVector& base,
 
 const std::unordered_set<std::string>& Node::get_provenance_tags() const
 {
-    return m_provenance_tags;
+    static const unordered_set<string> empty;
+    return m_provenance ? m_provenance->tags : empty;
 }
 
 void Node::add_provenance_tag(const std::string& tag)
 {
-    m_provenance_tags.insert(tag);
-    for (auto node : m_provenance_group)
+    if (!m_provenance)
+    {
+        m_provenance.reset(new Provenance());
+    }
+    m_provenance->tags.insert(tag);
+    for (auto node : m_provenance->group)
     {
         node->add_provenance_tag(tag);
     }
@@ -477,7 +715,10 @@ void Node::add_provenance_tag(const std::string& tag)
 
 void Node::remove_provenance_tag(const std::string& tag)
 {
-    m_provenance_tags.erase(tag);
+    if (m_provenance)
+    {
+        m_provenance->tags.erase(tag);
+    }
 }
 
 void Node::merge_provenance_tags_from(const std::shared_ptr<const Node>& source)
@@ -565,6 +806,7 @@ void Node::add_control_dependency(std::shared_ptr<Node> node)
         {
             node->m_control_dependents.push_back(this);
         }
+        connect_topology(this, node.get(), true);
     }
 }
 
@@ -606,6 +848,7 @@ void Node::remove_control_dependency(std::shared_ptr<Node> node)
             node->m_control_dependents.erase(it);
         }
     }
+    topology_changed();
 }
 
 void Node::clear_control_dependencies()
@@ -619,6 +862,7 @@ void Node::clear_control_dependencies()
         }
     }
     m_control_dependencies.clear();
+    topology_changed();
 }
 
 void Node::clear_control_dependents()
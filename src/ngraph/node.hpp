@@ -18,7 +18,7 @@
 
 #include <atomic>
 #include <cstring>
-#include <deque>
+#include <functional>
 #include <iostream>
 #include <memory>
 #include <set>
@@ -43,6 +43,7 @@
 #include "ngraph/op/util/op_annotations.hpp"
 #include "ngraph/output_vector.hpp"
 #include "ngraph/placement.hpp"
+#include "ngraph/small_deque.hpp"
 #include "ngraph/strides.hpp"
 #include "ngraph/type.hpp"
 
@@ -147,7 +148,7 @@ namespace ngraph
             const op::AutoBroadcastSpec& autob = op::AutoBroadcastSpec());
 
         /// \brief Construct an unitialized Node
-        Node() {}
+        Node();
         /// \brief Construct an unitialized Node
         /// \param output_size Number of outputs for this node
         Node(size_t output_size);
@@ -209,7 +210,26 @@ namespace ngraph
         /// Sets the number of outputs
         void set_output_size(size_t output_size);
 
-        void revalidate_and_infer_types() { validate_and_infer_types(); }
+        void revalidate_and_infer_types();
+        /// \brief Marks the node for revalidation by the next incremental validation.
+        ///
+        /// Replacing an input of the node does this automatically. Code that changes node
+        /// attributes used by type inference in place has to call it explicitly.
+        void set_needs_validation();
+        /// \brief True if the node changed since it was last validated.
+        bool get_needs_validation() const { return m_needs_validation; }
+        /// \brief Number of node creations and set_needs_validation calls in the process so
+        ///        far. If it did not change, no graph needs to be revalidated.
+        static size_t get_change_count() { return m_change_count; }
+        /// \brief Version of the connectivity of the graph the node is part of. Replacing an
+        ///        input or changing a control dependency of a node in the graph increases it.
+        ///        Creating nodes and destroying nodes nobody uses any more do not.
+        size_t get_topology_version() const;
+        /// \brief Returns the nodes of the graphs of nodes that were marked by
+        ///        set_needs_validation and not validated since, and for which take returns
+        ///        true, and stops tracking them.
+        static std::vector<Node*> take_dirty_nodes(const std::vector<Node*>& nodes,
+                                                   const std::function<bool(Node*)>& take);
         // Called after transition
         void delayed_validate_and_infer_types();
 
@@ -231,6 +251,8 @@ namespace ngraph
         ///        set_friendly_name then the node's unique name is returned.
         /// \returns A const reference to the node's friendly name.
         const std::string& get_friendly_name() const;
+        /// \brief True if a friendly name was set via set_friendly_name.
+        bool has_friendly_name() const { return !m_friendly_name.empty(); }
 
         /// Return true if this has the same implementing class as node. This
         /// will be used by the pattern matcher when comparing a pattern
@@ -287,18 +309,20 @@ namespace ngraph
         /// \returns The stream os
         virtual std::ostream& write_description(std::ostream& os, uint32_t depth = 0) const;
 
-        std::deque<descriptor::Input>& get_inputs() NGRAPH_DEPRECATED("use inputs() instead")
+        // Most nodes have at most two inputs and one output, those are stored inline
+        using InputDescriptors = SmallDeque<descriptor::Input, 2>;
+        using OutputDescriptors = SmallDeque<descriptor::Output, 1>;
+
+        InputDescriptors& get_inputs() NGRAPH_DEPRECATED("use inputs() instead")
         {
             return m_inputs;
         }
-        const std::deque<descriptor::Input>& get_inputs() const
-            NGRAPH_DEPRECATED("use inputs() instead")
+        const InputDescriptors& get_inputs() const NGRAPH_DEPRECATED("use inputs() instead")
         {
             return m_inputs;
         }
-        std::deque<descriptor::Output>& get_outputs() NGRAPH_DEPRECATED("use outputs() instead");
-        const std::deque<descriptor::Output>& get_outputs() const
-            NGRAPH_DEPRECATED("use outputs() instead");
+        OutputDescriptors& get_outputs() NGRAPH_DEPRECATED("use outputs() instead");
+        const OutputDescriptors& get_outputs() const NGRAPH_DEPRECATED("use outputs() instead");
 
         /// Get control dependencies registered on the node
         const std::vector<std::shared_ptr<Node>>& get_control_dependencies() const;
@@ -412,8 +436,12 @@ namespace ngraph
         /// Returns the tensor name for input i
         const std::string& get_input_tensor_name(size_t i) const;
 
-        std::unordered_set<descriptor::Tensor*> liveness_new_list;
-        std::unordered_set<descriptor::Tensor*> liveness_free_list;
+        /// \brief Tensors defined by this node, filled in by the liveness passes
+        std::unordered_set<descriptor::Tensor*>& get_liveness_new_list();
+        const std::unordered_set<descriptor::Tensor*>& get_liveness_new_list() const;
+        /// \brief Tensors last used by this node, filled in by the liveness passes
+        std::unordered_set<descriptor::Tensor*>& get_liveness_free_list();
+        const std::unordered_set<descriptor::Tensor*>& get_liveness_free_list() const;
 
         // Will be deprecated
         virtual NodeVector get_arguments() const;
@@ -555,11 +583,38 @@ namespace ngraph
         std::string m_friendly_name;
         std::string m_unique_name;
         static std::atomic<size_t> m_next_instance_id;
-        std::unordered_set<std::string> m_provenance_tags;
-        std::set<std::shared_ptr<Node>> m_provenance_group;
-        std::deque<descriptor::Input> m_inputs;
-        std::deque<descriptor::Output> m_outputs;
-        std::unordered_map<Node*, autodiff::Adjoints> m_adjoint_map;
+        bool m_needs_validation{true};
+        static std::atomic<size_t> m_change_count;
+        // Connectivity of the graph the node is part of, shared with the nodes connected to it
+        struct Topology;
+        // Links of the list of the nodes of the graph marked by set_needs_validation
+        bool m_dirty_listed{false};
+        Node* m_dirty_prev{nullptr};
+        Node* m_dirty_next{nullptr};
+        void unlist_dirty();
+        // Requires the lock of the list
+        void unlink_dirty(Topology& topology);
+        std::shared_ptr<Topology> m_topology;
+        // Returns the current Topology of the graph and points the node straight at it
+        std::shared_ptr<Topology> get_topology();
+        // Joins the graph of source to the graph of user after user got an input from source
+        static void connect_topology(Node* user, Node* source, bool changed);
+        void topology_changed();
+        InputDescriptors m_inputs;
+        OutputDescriptors m_outputs;
+        // Provenance and liveness are only used by some passes and are allocated on first use
+        struct Provenance
+        {
+            std::unordered_set<std::string> tags;
+            std::set<std::shared_ptr<Node>> group;
+        };
+        std::unique_ptr<Provenance> m_provenance;
+        struct Liveness
+        {
+            std::unordered_set<descriptor::Tensor*> new_list;
+            std::unordered_set<descriptor::Tensor*> free_list;
+        };
+        std::unique_ptr<Liveness> m_liveness;
         Placement m_placement = Placement::DEFAULT;
         std::shared_ptr<ngraph::op::util::OpAnnotations> m_op_annotations;
         std::map<std::string, std::shared_ptr<Variant>> m_rt_info;
@@ -299,6 +299,25 @@ op::Constant::Constant(const element::Type& type, const Shape& shape, const void
     m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
 }
 
+op::Constant::Constant(const element::Type& type,
+                       const Shape& shape,
+                       const std::shared_ptr<runtime::AlignedBuffer>& data)
+    : m_element_type(type)
+    , m_shape(shape)
+    , m_data(data)
+{
+    size_t size = ceil(shape_size(m_shape) * m_element_type.bitwidth() / 8.f);
+    NODE_VALIDATION_CHECK(this,
+                          m_data && m_data->size() >= size,
+                          "Constant buffer holds fewer bytes than its shape requires (",
+                          (m_data ? m_data->size() : 0),
+                          " < ",
+                          size,
+                          ").");
+    constructor_validate_and_infer_types();
+    m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
+}
+
 op::Constant::Constant(const Constant& other)
     : m_element_type(other.m_element_type)
     , m_shape(other.m_shape)
@@ -67,12 +67,14 @@ namespace ngraph
                 void set_partial_shape(const PartialShape& partial_shape)
                 {
                     m_partial_shape = partial_shape;
+                    set_needs_validation();
                 }
 
                 const element::Type& get_element_type() const { return m_element_type; }
                 void set_element_type(const element::Type& element_type)
                 {
                     m_element_type = element_type;
+                    set_needs_validation();
                 }
 
             protected:
@@ -14,11 +14,518 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
 #include "constant_folding.hpp"
+#include "ngraph/env_util.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/experimental/shape_of.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/op/result.hpp"
 
 using namespace std;
 using namespace ngraph;
 
+// ConstantFolding does not sweep the graph the way other GraphRewrite passes do. Folding one
+// node per callback and rediscovering its users on the next sweep makes large constant
+// subgraphs, such as weight preprocessing, the dominant compile time cost. Instead:
+//
+// 1. One topological walk collects every node whose inputs are all constants or nodes that
+//    are themselves foldable, i.e. the maximal constant subgraphs of the function.
+// 2. Those nodes are folded in dependency order on a pool of threads, so independent
+//    subgraphs, and independent branches of one subgraph, fold in parallel. Each node is cloned
+//    into a private sandbox over constants that share the buffers of its inputs, and the
+//    registered matchers fold the clone exactly as they used to fold the graph node. A folded
+//    value is released as soon as the last foldable node reading it has been folded.
+// 3. Only the values still used by the rest of the graph are spliced back into it.
+//
+// Splicing lets shape inference make more nodes foldable (ShapeOf of a tensor whose shape
+// just became static, for example), so the steps repeat until nothing more folds.
+
+namespace
+{
+    // Threads shared by every ConstantFolding pass of the process. They are started when a
+    // pass first needs them and then wait for the next one, so folding small functions does not
+    // pay for creating threads.
+    class FoldingThreadPool
+    {
+    public:
+        static FoldingThreadPool& get()
+        {
+            static FoldingThreadPool pool;
+            return pool;
+        }
+
+        ~FoldingThreadPool()
+        {
+            {
+                lock_guard<mutex> lock(m_mutex);
+                m_stop = true;
+            }
+            m_work_cv.notify_all();
+            for (auto& thread : m_threads)
+            {
+                thread.join();
+            }
+        }
+
+        // Runs job on the calling thread and on up to num_helpers pool threads, and returns
+        // once all of them returned. A pass that finds the pool busy, because another thread is
+        // folding, runs job on the calling thread only.
+        void run(size_t num_helpers, const function<void()>& job)
+        {
+            unique_lock<mutex> run_lock(m_run_mutex, try_to_lock);
+            if (!run_lock.owns_lock() || num_helpers == 0)
+            {
+                job();
+                return;
+            }
+            {
+                lock_guard<mutex> lock(m_mutex);
+                while (m_threads.size() < num_helpers)
+                {
+                    m_threads.emplace_back([this]() { work(); });
+                }
+                m_job = &job;
+                m_unclaimed = num_helpers;
+            }
+            m_work_cv.notify_all();
+            job();
+            unique_lock<mutex> lock(m_mutex);
+            // Helpers that did not start yet have nothing left to do
+            m_unclaimed = 0;
+            m_done_cv.wait(lock, [&]() { return m_active == 0; });
+            m_job = nullptr;
+        }
+
+    private:
+        void work()
+        {
+            unique_lock<mutex> lock(m_mutex);
+            while (true)
+            {
+                m_work_cv.wait(lock, [&]() { return m_stop || m_unclaimed > 0; });
+                if (m_stop)
+                {
+                    return;
+                }
+                m_unclaimed--;
+                m_active++;
+                const function<void()>* job = m_job;
+                lock.unlock();
+                (*job)();
+                lock.lock();
+                if (--m_active == 0)
+                {
+                    m_done_cv.notify_all();
+                }
+            }
+        }
+
+        mutex m_run_mutex;
+        mutex m_mutex;
+        condition_variable m_work_cv;
+        condition_variable m_done_cv;
+        vector<thread> m_threads;
+        const function<void()>* m_job{nullptr};
+        size_t m_unclaimed{0};
+        size_t m_active{0};
+        bool m_stop{false};
+    };
+
+    struct FoldInput
+    {
+        Output<Node> source;
+        // Index of the foldable node producing the input, or npos for a graph constant
+        size_t task;
+    };
+
+    struct FoldTask
+    {
+        shared_ptr<Node> node;
+        vector<FoldInput> inputs;
+        // Distinct foldable nodes this node reads from and that read from it
+        vector<size_t> producers;
+        vector<size_t> consumers;
+        size_t pending_producers;
+        size_t live_consumers;
+        // The value is still needed by a node that is not folded in this round
+        bool keep;
+        // A producer could not be folded, so neither can this node
+        bool skipped;
+        bool folded;
+        vector<shared_ptr<op::Constant>> values;
+    };
+
+    const size_t npos = numeric_limits<size_t>::max();
+
+    struct FoldKernel
+    {
+        shared_ptr<pattern::Matcher> matcher;
+        graph_rewrite_callback callback;
+    };
+
+    // Matchers keep per-match state, so every thread folds with its own copies of them
+    class Folder
+    {
+    public:
+        Folder(const vector<FoldKernel>& kernels,
+               const unordered_map<DiscreteTypeInfo, vector<size_t>>& typed_kernels,
+               const vector<size_t>& untyped_kernels)
+            : m_kernels(kernels)
+            , m_typed_kernels(typed_kernels)
+            , m_untyped_kernels(untyped_kernels)
+        {
+            for (auto& kernel : m_kernels)
+            {
+                m_matchers.push_back(
+                    make_shared<pattern::Matcher>(kernel.matcher->get_pattern_value(),
+                                                  kernel.matcher->get_name(),
+                                                  kernel.matcher->is_strict_mode()));
+            }
+        }
+
+        bool fold(FoldTask& task, const vector<FoldTask>& tasks);
+
+    private:
+        bool fold_node(const shared_ptr<Node>& node);
+
+        const vector<FoldKernel>& m_kernels;
+        const unordered_map<DiscreteTypeInfo, vector<size_t>>& m_typed_kernels;
+        const vector<size_t>& m_untyped_kernels;
+        vector<shared_ptr<pattern::Matcher>> m_matchers;
+        vector<size_t> m_candidates;
+    };
+}
+
+bool Folder::fold(FoldTask& task, const vector<FoldTask>& tasks)
+{
+    OutputVector args;
+    for (auto& input : task.inputs)
+    {
+        if (input.task != npos)
+        {
+            auto& value = tasks[input.task].values.at(input.source.get_index());
+            args.push_back(make_shared<op::Constant>(*value));
+        }
+        else if (auto constant = as_type<op::Constant>(input.source.get_node()))
+        {
+            // Shares the buffer rather than copying it
+            args.push_back(make_shared<op::Constant>(*constant));
+        }
+        else
+        {
+            // Only the shape of the input is used, see is_foldable_input
+            args.push_back(make_shared<op::Parameter>(input.source.get_element_type(),
+                                                      input.source.get_shape()));
+        }
+    }
+
+    auto clone = task.node->copy_with_new_inputs(args, NodeVector{});
+    vector<shared_ptr<op::Result>> results;
+    for (auto& output : clone->outputs())
+    {
+        results.push_back(make_shared<op::Result>(output));
+    }
+
+    // A kernel may leave foldable nodes behind, e.g. Split folds into Slices of its input
+    while (true)
+    {
+        bool done = true;
+        bool progress = false;
+        for (auto& result : results)
+        {
+            auto node = result->input_value(0).get_node_shared_ptr();
+            if (!is_type<op::Constant>(node))
+            {
+                done = false;
+                progress = fold_node(node) || progress;
+            }
+        }
+        if (done)
+        {
+            break;
+        }
+        if (!progress)
+        {
+            return false;
+        }
+    }
+
+    for (auto& result : results)
+    {
+        task.values.push_back(
+            static_pointer_cast<op::Constant>(result->input_value(0).get_node_shared_ptr()));
+    }
+    return true;
+}
+
+bool Folder::fold_node(const shared_ptr<Node>& node)
+{
+    const vector<size_t>* candidates = &m_untyped_kernels;
+    auto it = m_typed_kernels.find(node->get_type_info());
+    if (it != m_typed_kernels.end())
+    {
+        candidates = &it->second;
+        if (!m_untyped_kernels.empty())
+        {
+            m_candidates.clear();
+            merge(it->second.begin(),
+                  it->second.end(),
+                  m_untyped_kernels.begin(),
+                  m_untyped_kernels.end(),
+                  back_inserter(m_candidates));
+            candidates = &m_candidates;
+        }
+    }
+    for (auto index : *candidates)
+    {
+        auto& matcher = *m_matchers[index];
+        if (matcher.match(node) && m_kernels[index].callback(matcher))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool is_foldable_input(const shared_ptr<Node>& node, const Output<Node>& source)
+{
+    // ShapeOf folds as soon as the shape of its input is static, whatever its value
+    return is_type<op::ShapeOf>(node) && source.get_partial_shape().is_static();
+}
+
+size_t pass::ConstantFolding::get_num_threads() const
+{
+    if (m_num_threads > 0)
+    {
+        return m_num_threads;
+    }
+    int32_t num_threads = getenv_int("NGRAPH_CONSTANT_FOLDING_THREADS", 0);
+    if (num_threads > 0)
+    {
+        return num_threads;
+    }
+    return max(thread::hardware_concurrency(), 1u);
+}
+
+bool pass::ConstantFolding::run_on_function(shared_ptr<Function> f)
+{
+    bool rewritten = false;
+    while (fold_constant_subgraphs(f))
+    {
+        rewritten = true;
+        f->validate_changed_nodes_and_infer_types();
+    }
+    return rewritten;
+}
+
+bool pass::ConstantFolding::fold_constant_subgraphs(const shared_ptr<Function>& f)
+{
+    vector<FoldKernel> kernels;
+    unordered_map<DiscreteTypeInfo, vector<size_t>> typed_kernels;
+    vector<size_t> untyped_kernels;
+    for (auto& closure : m_matchers)
+    {
+        Node* root = closure.matcher->get_pattern_value().get_node();
+        if (root->is_pattern())
+        {
+            untyped_kernels.push_back(kernels.size());
+        }
+        else
+        {
+            typed_kernels[root->get_type_info()].push_back(kernels.size());
+        }
+        kernels.push_back({closure.matcher, closure.callback});
+    }
+
+    vector<FoldTask> tasks;
+    unordered_map<Node*, size_t> task_index;
+    for (auto& node : f->get_ordered_ops())
+    {
+        if (node->is_constant() || node->is_parameter() || node->is_output() ||
+            node->get_input_size() == 0 ||
+            (untyped_kernels.empty() && typed_kernels.count(node->get_type_info()) == 0))
+        {
+            continue;
+        }
+
+        FoldTask task{node, {}, {}, {}, 0, 0, false, false, false, {}};
+        bool foldable = true;
+        for (auto& input : node->inputs())
+        {
+            auto source = input.get_source_output();
+            auto it = task_index.find(source.get_node());
+            if (it != task_index.end())
+            {
+                task.inputs.push_back({source, it->second});
+                if (find(task.producers.begin(), task.producers.end(), it->second) ==
+                    task.producers.end())
+                {
+                    task.producers.push_back(it->second);
+                }
+            }
+            else if (source.get_node()->is_constant() || is_foldable_input(node, source))
+            {
+                task.inputs.push_back({source, npos});
+            }
+            else
+            {
+                foldable = false;
+                break;
+            }
+        }
+        if (!foldable)
+        {
+            continue;
+        }
+
+        size_t index = tasks.size();
+        for (auto producer : task.producers)
+        {
+            tasks[producer].consumers.push_back(index);
+        }
+        task.pending_producers = task.producers.size();
+        task_index[node.get()] = index;
+        tasks.push_back(move(task));
+    }
+    if (tasks.empty())
+    {
+        return false;
+    }
+
+    deque<size_t> ready;
+    for (size_t i = 0; i < tasks.size(); i++)
+    {
+        auto& task = tasks[i];
+        task.live_consumers = task.consumers.size();
+        task.keep = !task.node->get_control_dependents().empty();
+        for (auto& output : task.node->outputs())
+        {
+            for (auto& input : output.get_target_inputs())
+            {
+                task.keep = task.keep || task_index.count(input.get_node()) == 0;
+            }
+        }
+        if (task.pending_producers == 0)
+        {
+            ready.push_back(i);
+        }
+    }
+
+    mutex scheduler_mutex;
+    condition_variable scheduler_cv;
+    size_t remaining = tasks.size();
+    exception_ptr error;
+
+    // Bookkeeping happens under the lock, folding does not
+    function<void()> work = [&]() {
+        Folder folder(kernels, typed_kernels, untyped_kernels);
+        unique_lock<mutex> lock(scheduler_mutex);
+        while (true)
+        {
+            scheduler_cv.wait(lock, [&]() { return !ready.empty() || remaining == 0 || error; });
+            if (remaining == 0 || error)
+            {
+                return;
+            }
+            size_t index = ready.front();
+            ready.pop_front();
+            auto& task = tasks[index];
+            lock.unlock();
+
+            bool folded = false;
+            if (!task.skipped)
+            {
+                try
+                {
+                    folded = folder.fold(task, tasks);
+                }
+                catch (...)
+                {
+                    lock.lock();
+                    if (!error)
+                    {
+                        error = current_exception();
+                    }
+                    scheduler_cv.notify_all();
+                    return;
+                }
+            }
+
+            lock.lock();
+            task.folded = folded;
+            for (auto producer : task.producers)
+            {
+                auto& producer_task = tasks[producer];
+                producer_task.keep = producer_task.keep || !folded;
+                if (--producer_task.live_consumers == 0 && !producer_task.keep)
+                {
+                    // Nothing reads this intermediate any more
+                    producer_task.values.clear();
+                    producer_task.values.shrink_to_fit();
+                }
+            }
+            for (auto consumer : task.consumers)
+            {
+                auto& consumer_task = tasks[consumer];
+                consumer_task.skipped = consumer_task.skipped || !folded;
+                if (--consumer_task.pending_producers == 0)
+                {
+                    ready.push_back(consumer);
+                }
+            }
+            remaining--;
+            scheduler_cv.notify_all();
+        }
+    };
+
+    // The calling thread is one of the workers
+    size_t num_workers = min(get_num_threads(), tasks.size());
+    FoldingThreadPool::get().run(num_workers - 1, work);
+    if (error)
+    {
+        rethrow_exception(error);
+    }
+
+    bool rewritten = false;
+    for (auto& task : tasks)
+    {
+        if (!task.folded)
+        {
+            continue;
+        }
+        rewritten = true;
+        if (!task.keep)
+        {
+            continue;
+        }
+        NGRAPH_DEBUG << "Folded " << task.node->get_name();
+        if (task.values.size() == 1)
+        {
+            replace_node(task.node, task.values[0]);
+        }
+        else
+        {
+            OutputVector values;
+            for (auto& value : task.values)
+            {
+                values.push_back(value->output(0));
+            }
+            replace_node(task.node, values);
+        }
+    }
+    return rewritten;
+}
+
 bool ngraph::pass::revalidate_and_ensure_static(shared_ptr<Node> n)
 {
     n->revalidate_and_infer_types();
@@ -30,6 +30,14 @@ namespace ngraph
     }
 }
 
+/// \brief Replaces subgraphs whose value is known at compile time with constants
+///
+/// The folding kernels are registered as matchers, but unlike other GraphRewrite passes the
+/// graph is not swept one match at a time. Maximal constant subgraphs are found in a single
+/// topological walk and their nodes are folded in dependency order on a pool of threads shared
+/// by all ConstantFolding passes, see constant_folding.cpp. The number of threads defaults to
+/// the hardware concurrency and can be overridden with NGRAPH_CONSTANT_FOLDING_THREADS or
+/// set_num_threads().
 class NGRAPH_API ngraph::pass::ConstantFolding : public ngraph::pass::GraphRewrite
 {
 public:
@@ -103,6 +111,10 @@ public:
         construct_constant_non_zero();
     }
 
+    virtual bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+    /// \brief Sets the number of threads used to fold independent nodes, 0 for the default
+    void set_num_threads(size_t num_threads) { m_num_threads = num_threads; }
 private:
     void construct_constant_reshape();
     void construct_constant_broadcast();
@@ -134,5 +146,9 @@ private:
     void construct_constant_tile();
     void construct_constant_non_zero();
 
+    size_t get_num_threads() const;
+    bool fold_constant_subgraphs(const std::shared_ptr<ngraph::Function>& f);
+
     ngraph::BuildNodeExecutorMap m_cfmap;
+    size_t m_num_threads{0};
 };
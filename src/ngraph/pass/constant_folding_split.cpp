@@ -51,7 +51,6 @@ void pass::ConstantFolding::construct_constant_split()
             output.replace(slices[index++]->output(0));
         }
         split->outputs().clear();
-        construct_constant_slice();
 
         return true;
     };
@@ -82,7 +82,6 @@ void pass::ConstantFolding::construct_constant_variadic_split()
             }
         }
         variadic_split->outputs().clear();
-        construct_constant_slice();
 
         return true;
     };
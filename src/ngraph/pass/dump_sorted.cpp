@@ -58,11 +58,11 @@ bool pass::DumpSorted::run_on_module(vector<shared_ptr<Function>>& functions)
                 out << join(outputs);
                 out << "\n";
 
-                for (const descriptor::Tensor* tensor : node->liveness_new_list)
+                for (const descriptor::Tensor* tensor : node->get_liveness_new_list())
                 {
                     out << "    N " << tensor->get_name() << "\n";
                 }
-                for (const descriptor::Tensor* tensor : node->liveness_free_list)
+                for (const descriptor::Tensor* tensor : node->get_liveness_free_list())
                 {
                     out << "    F " << tensor->get_name() << "\n";
                 }
@@ -15,14 +15,20 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <chrono>
 #include <iostream>
+#include <iterator>
 #include <regex>
+#include <tuple>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
 #include "graph_rewrite.hpp"
 #include "ngraph/env_util.hpp"
+#include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/pattern/matcher_index.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -60,6 +66,44 @@ using namespace ngraph;
 // c) there's no linear order of fusions which will give
 //    the correct final fusion. i.e. the same fusion needs to occur before and after some other
 //    fusion
+//
+// Matchers are compiled into one pattern::MatcherIndex, a discrimination tree over the op types
+// and arities of their patterns. One walk of the tree from a node yields every matcher whose
+// pattern skeleton fits there and only those are run, so nodes without any candidate matcher are
+// skipped after a few comparisons. Candidates are still tried in registration order, so this does
+// not change which matcher wins on a node.
+//
+// Every node is visited once in topological order. When a callback rewrites the graph, the
+// replacement nodes, their arguments and the users they were connected to are collected and
+// visited again in topological order, and so on until no callback applies. A rewrite that enables
+// another one nearby is picked up without sweeping over the whole graph again.
+
+namespace
+{
+    uint64_t elapsed_ns(chrono::steady_clock::time_point start)
+    {
+        return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start)
+            .count();
+    }
+
+    // False once a node has been replaced and nothing uses it any more
+    bool is_live(const shared_ptr<Node>& node)
+    {
+        if (node->is_output() || node->get_output_size() == 0 ||
+            !node->get_control_dependents().empty())
+        {
+            return true;
+        }
+        for (auto& output : node->outputs())
+        {
+            if (!output.get_target_inputs().empty())
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+}
 
 bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
 {
@@ -78,14 +122,21 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         // that need multiple passes. See comments above.
         vector<MatchClosure> matchers_to_run{m_matchers};
         m_matchers.clear();
-        for (auto node : f->get_ordered_ops())
+
+        pattern::MatcherIndex index;
+        for (auto& closure : matchers_to_run)
         {
-            if (m_enable_shape_inference)
-            {
-                node->revalidate_and_infer_types();
-            }
-            for (auto& closure : matchers_to_run)
+            index.add(closure.matcher->get_pattern_value());
+        }
+
+        // Tries the candidate matchers on node in registration order. Returns true if a callback
+        // rewrote the graph and adds the nodes around the rewrite to revisit.
+        vector<size_t> candidates;
+        auto rewrite = [&](const shared_ptr<Node>& node, NodeVector& revisit) {
+            index.find(node->output(0), candidates);
+            for (auto candidate : candidates)
             {
+                auto& closure = matchers_to_run[candidate];
                 if (is_dyn_func && closure.property[PassProperty::REQUIRE_STATIC_SHAPE])
                 {
                     NGRAPH_DEBUG << "matcher callback requires static shape but the "
@@ -97,25 +148,126 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
                 NGRAPH_DEBUG << "Running matcher " << closure.matcher->get_name() << "("
                              << closure.matcher->get_pattern()->get_name() << ") on "
                              << node->get_name();
-                if (closure.matcher->match(node))
+                auto start = m_profiler.is_enabled() ? chrono::steady_clock::now()
+                                                     : chrono::steady_clock::time_point();
+                bool matched = closure.matcher->match(node);
+                bool applied = false;
+                vector<tuple<shared_ptr<Node>, size_t, Output<Node>>> user_inputs;
+                if (matched)
                 {
                     NGRAPH_DEBUG << "Matcher " << closure.matcher << closure.matcher->get_name()
                                  << " matched " << node->get_name();
-                    if (closure.callback(*closure.matcher.get()))
+                    // Inputs fed by the matched nodes. Those the callback reconnects lead to the
+                    // replacement nodes.
+                    auto matched_nodes = closure.matcher->get_matched_nodes();
+                    matched_nodes.push_back(node);
+                    for (auto& matched_node : matched_nodes)
+                    {
+                        for (auto& output : matched_node->outputs())
+                        {
+                            for (auto& input : output.get_target_inputs())
+                            {
+                                user_inputs.emplace_back(input.get_node()->shared_from_this(),
+                                                         input.get_index(),
+                                                         output);
+                            }
+                        }
+                    }
+                    applied = closure.callback(*closure.matcher.get());
+                }
+                if (m_profiler.is_enabled())
+                {
+                    m_profiler.record(closure.matcher->get_name(),
+                                      matched,
+                                      applied,
+                                      elapsed_ns(start));
+                }
+                if (applied)
+                {
+                    // If call back may change function's is_dynamic state, we need to
+                    // update the cached value.
+                    if (closure.property.is_set(PassProperty::CHANGE_DYNAMIC_STATE))
+                    {
+                        is_dyn_func = s_rerun_dynamic_check && f->is_dynamic();
+                    }
+                    for (auto& user_input : user_inputs)
                     {
-                        rewritten = true;
-                        // If call back may change function's is_dynamic state, we need to
-                        // update the cached value.
-                        if (closure.property.is_set(PassProperty::CHANGE_DYNAMIC_STATE))
+                        auto& user = get<0>(user_input);
+                        auto source = user->input_value(get<1>(user_input));
+                        if (source != get<2>(user_input))
                         {
-                            is_dyn_func = s_rerun_dynamic_check && f->is_dynamic();
+                            auto replacement = source.get_node_shared_ptr();
+                            revisit.push_back(user);
+                            revisit.push_back(replacement);
+                            for (auto& argument : replacement->input_values())
+                            {
+                                revisit.push_back(argument.get_node_shared_ptr());
+                            }
                         }
-                        break;
                     }
+                    return true;
                 }
             }
+            return false;
+        };
+
+        // The first visit covers every node in topological order. After that only the
+        // neighbourhoods of replacements are visited again, also in topological order, until
+        // no callback applies or NUM_TRIES rounds have run.
+        vector<shared_ptr<Node>> worklist;
+        for (auto& node : f->get_ordered_ops())
+        {
+            worklist.push_back(node);
         }
+        for (size_t round = 0; !worklist.empty() && round < NUM_TRIES; round++)
+        {
+            unordered_map<Node*, size_t> positions;
+            for (size_t i = 0; i < worklist.size(); i++)
+            {
+                positions[worklist[i].get()] = i;
+            }
 
+            NodeVector revisit;
+            unordered_set<Node*> scheduled;
+            for (size_t i = 0; i < worklist.size(); i++)
+            {
+                auto& node = worklist[i];
+                // Nodes replaced earlier in this round are no longer part of the graph
+                if (!is_live(node))
+                {
+                    continue;
+                }
+                if (m_enable_shape_inference)
+                {
+                    node->revalidate_and_infer_types();
+                }
+                NodeVector touched;
+                if (rewrite(node, touched))
+                {
+                    rewritten = true;
+                    for (auto& touched_node : touched)
+                    {
+                        // Nodes still ahead in this round are visited anyway
+                        auto position = positions.find(touched_node.get());
+                        if ((position == positions.end() || position->second <= i) &&
+                            scheduled.insert(touched_node.get()).second)
+                        {
+                            revisit.push_back(touched_node);
+                        }
+                    }
+                }
+            }
+
+            NodeVector live_revisit;
+            for (auto& node : revisit)
+            {
+                if (is_live(node))
+                {
+                    live_revisit.push_back(node);
+                }
+            }
+            worklist = subgraph_topological_sort(live_revisit);
+        }
     } while (rewritten && m_matchers.size() > 0 && tries--);
 
     m_matchers.assign(original_matchers.begin(), original_matchers.end());
@@ -215,8 +367,9 @@ bool pass::RecurrentGraphRewrite::run_on_function(shared_ptr<Function> f)
         bool is_dyn_func = s_rerun_dynamic_check && f->is_dynamic();
         for (auto node : f->get_ops())
         {
-            for (auto& closure : m_matchers)
+            for (size_t index = 0; index < m_matchers.size(); index++)
             {
+                auto& closure = m_matchers[index];
                 if (is_dyn_func && closure.property[PassProperty::REQUIRE_STATIC_SHAPE])
                 {
                     NGRAPH_DEBUG << "matcher callback requires static shape but the "
@@ -226,20 +379,33 @@ bool pass::RecurrentGraphRewrite::run_on_function(shared_ptr<Function> f)
                     continue;
                 }
                 NGRAPH_DEBUG << "Running matcher " << closure.matcher << " on " << node->get_name();
-                if (closure.matcher->match(node->output(0)))
+                auto start = m_profiler.is_enabled() ? chrono::steady_clock::now()
+                                                     : chrono::steady_clock::time_point();
+                bool matched = closure.matcher->match(node->output(0));
+                bool applied = false;
+                if (matched)
                 {
                     NGRAPH_DEBUG << "Matcher " << closure.matcher << " matched "
                                  << node->get_name();
-                    if (closure.callback(*closure.matcher.get()))
+                    applied = closure.callback(*closure.matcher.get());
+                }
+                if (m_profiler.is_enabled())
+                {
+                    // Recurrent matchers are unnamed, report them by registration order
+                    m_profiler.record("RecurrentMatcher" + to_string(index),
+                                      matched,
+                                      applied,
+                                      elapsed_ns(start));
+                }
+                if (applied)
+                {
+                    // If call back may change function's is_dynamic state, we need to
+                    // update the cached value.
+                    if (closure.property.is_set(PassProperty::CHANGE_DYNAMIC_STATE))
                     {
-                        // If call back may change function's is_dynamic state, we need to
-                        // update the cached value.
-                        if (closure.property.is_set(PassProperty::CHANGE_DYNAMIC_STATE))
-                        {
-                            is_dyn_func = s_rerun_dynamic_check && f->is_dynamic();
-                        }
-                        return true;
+                        is_dyn_func = s_rerun_dynamic_check && f->is_dynamic();
                     }
+                    return true;
                 }
             }
         }
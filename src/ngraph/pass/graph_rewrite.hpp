@@ -21,6 +21,7 @@
 #include <set>
 
 #include "ngraph/pass/pass.hpp"
+#include "ngraph/pass/pass_profile.hpp"
 #include "ngraph/pattern/matcher.hpp"
 
 namespace ngraph
@@ -68,11 +69,12 @@ public:
 
     virtual bool run_on_function(std::shared_ptr<ngraph::Function> f);
 
+    /// \brief Per-matcher counters, collected while the profiler is enabled
+    MatcherProfiler& get_matcher_profiler() { return m_profiler; }
 protected:
     bool is_enabled(const std::shared_ptr<pattern::Matcher>& m) const;
     bool m_enable_shape_inference = false;
 
-private:
     struct MatchClosure
     {
         std::shared_ptr<pattern::Matcher> matcher;
@@ -80,6 +82,9 @@ private:
         PassPropertyMask property;
     };
     std::vector<MatchClosure> m_matchers;
+
+private:
+    MatcherProfiler m_profiler;
 };
 
 class NGRAPH_API ngraph::pass::RecurrentGraphRewrite : public FunctionPass
@@ -105,8 +110,11 @@ public:
 
     virtual bool run_on_function(std::shared_ptr<ngraph::Function> f);
 
+    /// \brief Per-matcher counters, collected while the profiler is enabled
+    MatcherProfiler& get_matcher_profiler() { return m_profiler; }
 private:
     size_t m_num_iters;
+    MatcherProfiler m_profiler;
 
     struct MatchClosure
     {
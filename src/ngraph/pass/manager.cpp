@@ -15,18 +15,25 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <cstdlib>
 #ifdef _WIN32
 #else
 #include <cxxabi.h>
 #endif
+#include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <memory>
+#include <mutex>
+#include <sstream>
 
+#include "ngraph/chrome_trace.hpp"
 #include "ngraph/env_util.hpp"
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
 #include "ngraph/node.hpp"
+#include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/pass/serialize.hpp"
@@ -36,10 +43,69 @@
 using namespace std;
 using namespace ngraph;
 
+static string get_pass_name(const pass::PassBase& pass)
+{
+    string name = typeid(pass).name();
+#ifndef _WIN32
+    int status;
+    char* demangled = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
+    if (demangled != nullptr)
+    {
+        name = demangled;
+        free(demangled);
+    }
+#endif
+    return name;
+}
+
+static size_t count_nodes(const vector<shared_ptr<Function>>& functions)
+{
+    size_t count = 0;
+    for (auto& f : functions)
+    {
+        count += f->get_ops().size();
+    }
+    return count;
+}
+
+static pass::MatcherProfiler* get_matcher_profiler(const shared_ptr<pass::PassBase>& pass)
+{
+    if (auto graph_rewrite = dynamic_pointer_cast<pass::GraphRewrite>(pass))
+    {
+        return &graph_rewrite->get_matcher_profiler();
+    }
+    if (auto recurrent_graph_rewrite = dynamic_pointer_cast<pass::RecurrentGraphRewrite>(pass))
+    {
+        return &recurrent_graph_rewrite->get_matcher_profiler();
+    }
+    return nullptr;
+}
+
+// Runs of all managers in the process are appended to the same report, one JSON object per line
+static void append_pass_report(const string& path,
+                               const string& function_name,
+                               uint64_t time_us,
+                               const vector<pass::PassProfile>& profile)
+{
+    static mutex report_mutex;
+    lock_guard<mutex> lock(report_mutex);
+    ofstream out(path, ios_base::app);
+    if (out)
+    {
+        pass::write_json(out, function_name, time_us, profile);
+    }
+    else
+    {
+        NGRAPH_WARN << "Unable to write pass profile to " << path;
+    }
+}
+
 pass::Manager::Manager()
     : m_visualize(getenv_bool("NGRAPH_ENABLE_VISUALIZE_TRACING"))
     , m_serialize(getenv_bool("NGRAPH_ENABLE_SERIALIZE_TRACING"))
-
+    , m_incremental_validation(getenv_bool("NGRAPH_INCREMENTAL_VALIDATION", false))
+    , m_profile_passes(getenv_bool("NGRAPH_PROFILE_PASS_ENABLE") ||
+                       !getenv_string("NGRAPH_PROFILE_PASS_REPORT").empty())
 {
 }
 
@@ -50,6 +116,10 @@ pass::Manager::~Manager()
 void pass::Manager::run_passes(shared_ptr<Function> func, bool /* transitive */)
 {
     static bool profile_enabled = getenv_bool("NGRAPH_PROFILE_PASS_ENABLE");
+    static const string report_path = getenv_string("NGRAPH_PROFILE_PASS_REPORT");
+    // Pass events in the chrome trace carry the profile as their arguments
+    bool collect_profile = m_profile_passes || event::Manager::is_tracing_enabled();
+    m_pass_profile.clear();
 
     get_state().set_function(func);
     vector<std::pair<shared_ptr<Function>, bool>> fs{std::make_pair(func, func->is_dynamic())};
@@ -61,6 +131,24 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool /* transitive */)
     overall_timer.start();
     for (shared_ptr<PassBase> pass : m_pass_list)
     {
+        PassProfile profile;
+        size_t peak_rss_before = 0;
+        MatcherProfiler* matcher_profiler = nullptr;
+        unique_ptr<event::Duration> trace;
+        if (collect_profile)
+        {
+            profile.name = get_pass_name(*pass);
+            profile.nodes_before = count_nodes(f_array);
+            peak_rss_before = get_peak_rss_bytes();
+            matcher_profiler = get_matcher_profiler(pass);
+            if (matcher_profiler)
+            {
+                matcher_profiler->clear();
+                matcher_profiler->set_enabled(true);
+            }
+            trace.reset(new event::Duration(profile.name, "Pass"));
+        }
+
         pass_timer.start();
         pass->set_state(get_state());
         auto module_pass = dynamic_pointer_cast<ModulePass>(pass);
@@ -154,21 +242,48 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool /* transitive */)
         }
         index++;
         pass_timer.stop();
+        if (collect_profile)
+        {
+            trace->stop();
+            profile.time_us = pass_timer.get_microseconds();
+            profile.nodes_after = count_nodes(f_array);
+            profile.peak_rss_bytes = get_peak_rss_bytes();
+            profile.peak_rss_increase_bytes =
+                profile.peak_rss_bytes - min(profile.peak_rss_bytes, peak_rss_before);
+            if (matcher_profiler)
+            {
+                profile.matchers = matcher_profiler->get_profile();
+                matcher_profiler->set_enabled(false);
+                matcher_profiler->clear();
+            }
+            if (event::Manager::is_tracing_enabled())
+            {
+                stringstream args;
+                write_json(args, profile);
+                trace->set_args(args.str());
+            }
+            trace.reset();
+            if (m_profile_passes)
+            {
+                m_pass_profile.push_back(move(profile));
+            }
+        }
         if (profile_enabled)
         {
-            PassBase* p = pass.get();
-            string name = typeid(*p).name();
-#ifndef _WIN32
-            int status;
-            name = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
-#endif
-            cout << setw(7) << pass_timer.get_milliseconds() << "ms " << name << "\n";
+            cout << setw(7) << pass_timer.get_milliseconds() << "ms " << get_pass_name(*pass)
+                 << "\n";
         }
     }
+    overall_timer.stop();
     if (profile_enabled)
     {
         cout << "passes done in " << overall_timer.get_milliseconds() << "ms\n";
     }
+    if (m_profile_passes && !report_path.empty())
+    {
+        append_pass_report(
+            report_path, func->get_name(), overall_timer.get_microseconds(), m_pass_profile);
+    }
 }
 
 pass::ManagerState& pass::Manager::get_state()
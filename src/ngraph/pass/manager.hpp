@@ -24,6 +24,7 @@
 #include "ngraph/pass/manager_state.hpp"
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/pass/pass_config.hpp"
+#include "ngraph/pass/pass_profile.hpp"
 #include "ngraph/pass/validate.hpp"
 
 namespace ngraph
@@ -47,7 +48,7 @@ public:
         auto rc = push_pass<T>(std::forward<Args>(args)...);
         if (m_per_pass_validation)
         {
-            push_pass<Validate>();
+            push_pass<Validate>(m_incremental_validation);
         }
         return rc;
     }
@@ -60,6 +61,17 @@ public:
     void set_pass_visualization(bool new_state) { m_visualize = new_state; }
     void set_pass_serialization(bool new_state) { m_serialize = new_state; }
     void set_per_pass_validation(bool new_state) { m_per_pass_validation = new_state; }
+    /// \brief Only revalidate the nodes changed by a pass in the validation that follows it.
+    ///        Applies to passes registered afterwards. Passes that change node attributes in
+    ///        place must call Node::set_needs_validation. Disabled by default, unless
+    ///        NGRAPH_INCREMENTAL_VALIDATION is set to true.
+    void set_incremental_validation(bool new_state) { m_incremental_validation = new_state; }
+    /// \brief Record time, node counts, memory high-water and matcher counters for every pass.
+    ///        Enabled by default when NGRAPH_PROFILE_PASS_ENABLE or NGRAPH_PROFILE_PASS_REPORT
+    ///        is set.
+    void set_pass_profiling(bool new_state) { m_profile_passes = new_state; }
+    /// \brief Profile of the last run_passes call, empty unless pass profiling is enabled
+    const std::vector<PassProfile>& get_pass_profile() const { return m_pass_profile; }
 private:
     template <typename T, class... Args>
     std::shared_ptr<T> push_pass(Args&&... args)
@@ -91,4 +103,7 @@ private:
     bool m_visualize = false;
     bool m_serialize = false;
     bool m_per_pass_validation = true;
+    bool m_incremental_validation = false;
+    bool m_profile_passes = false;
+    std::vector<PassProfile> m_pass_profile;
 };
@@ -14,10 +14,15 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <exception>
+#include <functional>
+#include <numeric>
+#include <set>
 #include <sstream>
+#include <unordered_map>
 
-#include "ngraph/log.hpp"
+#include "ngraph/env_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/concat.hpp"
 #include "ngraph/op/get_output_element.hpp"
@@ -30,9 +35,12 @@
 using namespace std;
 using namespace ngraph;
 
-pass::MemoryLayout::MemoryLayout(size_t alignment, bool disable_memory_sharing)
+pass::MemoryLayout::MemoryLayout(size_t alignment,
+                                 bool disable_memory_sharing,
+                                 chrono::microseconds planning_budget)
     : m_alignment(alignment)
     , m_disable_memory_sharing(disable_memory_sharing)
+    , m_planning_budget(planning_budget)
 {
     if (m_alignment == 0)
     {
@@ -42,7 +50,11 @@ pass::MemoryLayout::MemoryLayout(size_t alignment, bool disable_memory_sharing)
 
 bool pass::MemoryLayout::run_on_function(shared_ptr<Function> function)
 {
-    MemoryManager mm(m_alignment, m_disable_memory_sharing);
+    // Lifetimes are recorded in execution order and placed all at once, a tensor that reuses
+    // an input in place shares the input's buffer and extends its lifetime
+    StaticMemoryPlanner planner(m_alignment, m_planning_budget);
+    unordered_map<descriptor::Tensor*, size_t> buffers;
+    size_t step = 0;
     for (shared_ptr<Node> node : function->get_ordered_ops())
     {
         std::map<descriptor::Tensor*, descriptor::Tensor*> in_place_outputs;
@@ -64,11 +76,11 @@ bool pass::MemoryLayout::run_on_function(shared_ptr<Function> function)
 
                         // For destructive kernel, this should be the last use
                         // Non-destructive kernels can pass through if memory sharing is disabled
-                        if ((node->liveness_free_list.count(input) != 0 ||
+                        if ((node->get_liveness_free_list().count(input) != 0 ||
                              is_type<op::GetOutputElement>(node) ||
                              (m_disable_memory_sharing && !oi_pair.destructive &&
                               !input_node->is_parameter() && !input_node->is_constant())) &&
-                            node->liveness_new_list.count(output) != 0)
+                            node->get_liveness_new_list().count(output) != 0)
 
                         {
                             NGRAPH_DEBUG << "Reusing " << input->get_name() << " for "
@@ -81,26 +93,40 @@ bool pass::MemoryLayout::run_on_function(shared_ptr<Function> function)
             }
         }
 
-        for (descriptor::Tensor* tensor : node->liveness_new_list)
+        for (descriptor::Tensor* tensor : node->get_liveness_new_list())
         {
-            size_t offset = in_place_outputs.count(tensor)
-                                ? in_place_outputs.at(tensor)->get_pool_offset()
-                                : mm.allocate(tensor->size());
-            tensor->set_pool_offset(offset);
+            auto in_place = in_place_outputs.find(tensor);
+            auto input_buffer =
+                in_place == in_place_outputs.end() ? buffers.end() : buffers.find(in_place->second);
+            buffers[tensor] = input_buffer != buffers.end()
+                                  ? input_buffer->second
+                                  : planner.add_buffer(tensor->size(), step);
         }
 
         if (!m_disable_memory_sharing)
         {
-            for (const descriptor::Tensor* tensor : node->liveness_free_list)
+            for (descriptor::Tensor* tensor : node->get_liveness_free_list())
             {
-                if (reused_inputs.count(tensor) == 0)
+                auto buffer = buffers.find(tensor);
+                if (reused_inputs.count(tensor) == 0 && buffer != buffers.end())
                 {
-                    mm.free(tensor->get_pool_offset());
+                    planner.set_last_use(buffer->second, step);
                 }
             }
         }
+        step++;
+    }
+
+    planner.plan();
+    for (auto& buffer : buffers)
+    {
+        buffer.first->set_pool_offset(planner.get_offset(buffer.second));
     }
-    function->set_temporary_pool_size(mm.max_allocated());
+    m_report = planner.get_report();
+    stringstream report;
+    planner.dump(report);
+    NGRAPH_DEBUG << "Memory plan for " << function->get_name() << ": " << report.str();
+    function->set_temporary_pool_size(planner.max_allocated());
 
     return false;
 }
@@ -290,3 +316,316 @@ size_t pass::MemoryManager::align(size_t size, size_t alignment)
     }
     return size;
 }
+
+pass::StaticMemoryPlanner::StaticMemoryPlanner(size_t alignment,
+                                               chrono::microseconds time_budget)
+    : m_alignment{alignment}
+    , m_time_budget{time_budget}
+{
+    if (m_alignment == 0)
+    {
+        throw invalid_argument("Memory alignment must be > 0");
+    }
+}
+
+chrono::microseconds pass::StaticMemoryPlanner::get_default_time_budget()
+{
+    return chrono::microseconds(max(getenv_int("NGRAPH_MEMORY_PLANNER_BUDGET_US", 0), 0));
+}
+
+size_t pass::StaticMemoryPlanner::add_buffer(size_t size, size_t first_use)
+{
+    m_buffers.push_back(
+        Buffer{MemoryManager::align(size, m_alignment), first_use, numeric_limits<size_t>::max()});
+    m_planned = false;
+    return m_buffers.size() - 1;
+}
+
+void pass::StaticMemoryPlanner::set_last_use(size_t buffer, size_t last_use)
+{
+    if (buffer >= m_buffers.size() || last_use < m_buffers[buffer].first_use)
+    {
+        throw runtime_error("bad free");
+    }
+    m_buffers[buffer].last_use = last_use;
+    m_planned = false;
+}
+
+size_t pass::StaticMemoryPlanner::get_offset(size_t buffer) const
+{
+    if (!m_planned || buffer >= m_offsets.size())
+    {
+        throw runtime_error("buffer has not been planned");
+    }
+    return m_offsets[buffer];
+}
+
+void pass::StaticMemoryPlanner::plan()
+{
+    auto start = chrono::steady_clock::now();
+    auto deadline = m_time_budget > chrono::microseconds::zero()
+                        ? start + m_time_budget
+                        : chrono::steady_clock::time_point::max();
+    m_report = Report{};
+    m_report.lower_bound = compute_lower_bound();
+
+    struct Heuristic
+    {
+        const char* name;
+        bool best_fit;
+        function<bool(const Buffer&, const Buffer&)> before;
+    };
+    auto duration = [](const Buffer& b) { return b.last_use - b.first_use; };
+    vector<Heuristic> heuristics{
+        {"greedy_by_size",
+         true,
+         [&](const Buffer& a, const Buffer& b) {
+             return a.size != b.size ? a.size > b.size : duration(a) > duration(b);
+         }},
+        {"greedy_by_duration",
+         true,
+         [&](const Buffer& a, const Buffer& b) {
+             return duration(a) != duration(b) ? duration(a) > duration(b) : a.size > b.size;
+         }},
+        // What MemoryManager achieves with FIRST_FIT, so the plan is never worse than it
+        {"first_fit_in_order",
+         false,
+         [](const Buffer& a, const Buffer& b) { return a.first_use < b.first_use; }}};
+
+    vector<size_t> order(m_buffers.size());
+    vector<size_t> offsets;
+    bool any_freed = any_of(m_buffers.begin(), m_buffers.end(), [](const Buffer& buffer) {
+        return buffer.last_use != numeric_limits<size_t>::max();
+    });
+    if (!any_freed)
+    {
+        // Every buffer overlaps every other one, stacking them in order is optimal
+        m_offsets.resize(m_buffers.size());
+        for (size_t i = 0; i < m_buffers.size(); i++)
+        {
+            m_offsets[i] = m_report.peak;
+            m_report.peak += m_buffers[i].size;
+        }
+        m_report.heuristic = "no_reuse";
+        m_report.heuristics_tried = 1;
+    }
+    else
+    {
+        auto overlaps = compute_overlaps();
+        for (size_t i = 0; i < heuristics.size(); i++)
+        {
+            if (i > 0 &&
+                (m_report.peak == m_report.lower_bound || chrono::steady_clock::now() >= deadline))
+            {
+                break;
+            }
+            const Heuristic& heuristic = heuristics[i];
+            iota(order.begin(), order.end(), 0);
+            stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+                return heuristic.before(m_buffers[a], m_buffers[b]);
+            });
+            size_t peak;
+            if (!place(order, overlaps, heuristic.best_fit, i > 0, deadline, offsets, peak))
+            {
+                break;
+            }
+            m_report.heuristics_tried++;
+            if (i == 0 || peak < m_report.peak)
+            {
+                m_report.heuristic = heuristic.name;
+                m_report.peak = peak;
+                m_offsets.swap(offsets);
+            }
+        }
+    }
+
+    compute_fragmentation();
+    m_report.planning_time =
+        chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start);
+    m_planned = true;
+}
+
+size_t pass::StaticMemoryPlanner::compute_lower_bound() const
+{
+    vector<pair<size_t, size_t>> starts;
+    vector<pair<size_t, size_t>> ends;
+    for (const Buffer& buffer : m_buffers)
+    {
+        starts.push_back({buffer.first_use, buffer.size});
+        if (buffer.last_use != numeric_limits<size_t>::max())
+        {
+            ends.push_back({buffer.last_use, buffer.size});
+        }
+    }
+    sort(starts.begin(), starts.end());
+    sort(ends.begin(), ends.end());
+
+    size_t live = 0;
+    size_t bound = 0;
+    size_t end = 0;
+    for (auto& start : starts)
+    {
+        for (; end < ends.size() && ends[end].first < start.first; end++)
+        {
+            live -= ends[end].second;
+        }
+        live += start.second;
+        bound = max(bound, live);
+    }
+    return bound;
+}
+
+vector<vector<size_t>> pass::StaticMemoryPlanner::compute_overlaps() const
+{
+    vector<size_t> by_start(m_buffers.size());
+    iota(by_start.begin(), by_start.end(), 0);
+    stable_sort(by_start.begin(), by_start.end(), [&](size_t a, size_t b) {
+        return m_buffers[a].first_use < m_buffers[b].first_use;
+    });
+
+    // Every buffer still live when another one starts overlaps it
+    vector<vector<size_t>> overlaps(m_buffers.size());
+    vector<size_t> live;
+    for (size_t id : by_start)
+    {
+        const Buffer& buffer = m_buffers[id];
+        live.erase(remove_if(live.begin(),
+                             live.end(),
+                             [&](size_t other) {
+                                 return m_buffers[other].last_use < buffer.first_use;
+                             }),
+                   live.end());
+        for (size_t other : live)
+        {
+            overlaps[id].push_back(other);
+            overlaps[other].push_back(id);
+        }
+        live.push_back(id);
+    }
+    return overlaps;
+}
+
+bool pass::StaticMemoryPlanner::place(const vector<size_t>& order,
+                                      const vector<vector<size_t>>& overlaps,
+                                      bool best_fit,
+                                      bool can_stop,
+                                      chrono::steady_clock::time_point deadline,
+                                      vector<size_t>& offsets,
+                                      size_t& peak) const
+{
+    offsets.assign(m_buffers.size(), 0);
+    peak = 0;
+    vector<bool> placed(m_buffers.size(), false);
+    vector<pair<size_t, size_t>> neighbours;
+    for (size_t i = 0; i < order.size(); i++)
+    {
+        if (can_stop && i % 64 == 0 && chrono::steady_clock::now() >= deadline)
+        {
+            return false;
+        }
+
+        // Only buffers live at the same time constrain where this one goes
+        const Buffer& buffer = m_buffers[order[i]];
+        neighbours.clear();
+        for (size_t other : overlaps[order[i]])
+        {
+            if (placed[other])
+            {
+                neighbours.push_back({offsets[other], offsets[other] + m_buffers[other].size});
+            }
+        }
+        sort(neighbours.begin(), neighbours.end());
+
+        size_t top = 0;
+        size_t offset = 0;
+        size_t smallest_gap = numeric_limits<size_t>::max();
+        bool found = false;
+        for (auto& neighbour : neighbours)
+        {
+            if (neighbour.first > top)
+            {
+                size_t gap = neighbour.first - top;
+                if (gap >= buffer.size && gap < smallest_gap)
+                {
+                    offset = top;
+                    smallest_gap = gap;
+                    found = true;
+                    if (!best_fit)
+                    {
+                        break;
+                    }
+                }
+            }
+            top = max(top, neighbour.second);
+        }
+        if (!found)
+        {
+            offset = top;
+        }
+
+        offsets[order[i]] = offset;
+        peak = max(peak, offset + buffer.size);
+        placed[order[i]] = true;
+    }
+    return true;
+}
+
+void pass::StaticMemoryPlanner::compute_fragmentation()
+{
+    vector<size_t> by_start(m_buffers.size());
+    iota(by_start.begin(), by_start.end(), 0);
+    sort(by_start.begin(), by_start.end(), [&](size_t a, size_t b) {
+        return m_buffers[a].first_use < m_buffers[b].first_use;
+    });
+    vector<size_t> by_end;
+    for (size_t i = 0; i < m_buffers.size(); i++)
+    {
+        if (m_buffers[i].last_use != numeric_limits<size_t>::max())
+        {
+            by_end.push_back(i);
+        }
+    }
+    sort(by_end.begin(), by_end.end(), [&](size_t a, size_t b) {
+        return m_buffers[a].last_use < m_buffers[b].last_use;
+    });
+
+    // Sampled whenever buffers become live, which is where the extent can grow
+    multiset<size_t> tops;
+    size_t live = 0;
+    size_t end = 0;
+    size_t samples = 0;
+    double total = 0;
+    for (size_t start = 0; start < by_start.size();)
+    {
+        size_t step = m_buffers[by_start[start]].first_use;
+        for (; end < by_end.size() && m_buffers[by_end[end]].last_use < step; end++)
+        {
+            size_t id = by_end[end];
+            live -= m_buffers[id].size;
+            tops.erase(tops.find(m_offsets[id] + m_buffers[id].size));
+        }
+        for (; start < by_start.size() && m_buffers[by_start[start]].first_use == step; start++)
+        {
+            size_t id = by_start[start];
+            live += m_buffers[id].size;
+            tops.insert(m_offsets[id] + m_buffers[id].size);
+        }
+        size_t extent = *tops.rbegin();
+        double fragmentation = extent == 0 ? 0 : static_cast<double>(extent - live) / extent;
+        m_report.max_fragmentation = max(m_report.max_fragmentation, fragmentation);
+        total += fragmentation;
+        samples++;
+    }
+    m_report.mean_fragmentation = samples == 0 ? 0 : total / samples;
+}
+
+void pass::StaticMemoryPlanner::dump(ostream& out) const
+{
+    out << "heuristic=" << m_report.heuristic << " (" << m_report.heuristics_tried
+        << " tried), ";
+    out << "peak=" << m_report.peak << ", ";
+    out << "lower_bound=" << m_report.lower_bound << ", ";
+    out << "mean_fragmentation=" << m_report.mean_fragmentation << ", ";
+    out << "max_fragmentation=" << m_report.max_fragmentation << ", ";
+    out << "planning_time=" << m_report.planning_time.count() << "us\n";
+}
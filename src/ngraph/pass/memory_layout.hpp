@@ -16,9 +16,12 @@
 
 #pragma once
 
+#include <chrono>
 #include <limits>
 #include <list>
 #include <sstream>
+#include <string>
+#include <vector>
 
 #include "ngraph/pass/pass.hpp"
 
@@ -29,20 +32,10 @@ namespace ngraph
         class MemoryLayout;
         class MemoryNode;
         class MemoryManager;
+        class StaticMemoryPlanner;
     }
 }
 
-class NGRAPH_API ngraph::pass::MemoryLayout : public FunctionPass
-{
-public:
-    MemoryLayout(size_t alignment = 1, bool disable_memory_sharing = false);
-    bool run_on_function(std::shared_ptr<ngraph::Function>) override;
-
-private:
-    size_t m_alignment;
-    bool m_disable_memory_sharing;
-};
-
 class NGRAPH_API ngraph::pass::MemoryManager
 {
 public:
@@ -95,3 +88,102 @@ private:
     allocation_scheme m_scheme;
     size_t m_max_allocated;
 };
+
+/// StaticMemoryPlanner places buffers whose lifetimes are all known before any of them is
+/// placed. Lifetimes are inclusive ranges of steps, usually the positions of ops in execution
+/// order, and buffers whose lifetimes overlap never share memory.
+///
+/// Unlike MemoryManager, which must decide each offset as ops are visited, plan() sees every
+/// buffer at once. It runs several orderings (largest buffers first, longest lived first, and
+/// the first fit in execution order that MemoryManager does) and keeps the plan with the
+/// smallest peak. It stops early when a plan reaches the lower bound, the most bytes live at any
+/// one step, or when the optional time budget runs out. The first ordering always completes.
+/// Placing a buffer only looks at the buffers whose lifetimes overlap its own, which are found
+/// with one sweep over the lifetimes in order of first use.
+class NGRAPH_API ngraph::pass::StaticMemoryPlanner
+{
+public:
+    struct Report
+    {
+        /// Ordering that produced the plan
+        std::string heuristic;
+        size_t heuristics_tried{0};
+        /// Bytes needed by the plan, what max_allocated() returns
+        size_t peak{0};
+        /// Most bytes live at any one step, no plan can need less
+        size_t lower_bound{0};
+        /// Fraction of the memory below the highest live buffer that is unused, averaged over
+        /// the steps where a buffer becomes live and at the worst of those steps
+        double mean_fragmentation{0};
+        double max_fragmentation{0};
+        std::chrono::microseconds planning_time{0};
+    };
+
+    StaticMemoryPlanner(size_t alignment = 1,
+                        std::chrono::microseconds time_budget = std::chrono::microseconds::zero());
+
+    /// \brief The budget set in NGRAPH_MEMORY_PLANNER_BUDGET_US, in microseconds. Zero, the
+    /// default, leaves the time unlimited.
+    static std::chrono::microseconds get_default_time_budget();
+
+    /// \brief Adds a buffer of \p size bytes that is live from step \p first_use on
+    /// \returns The id of the buffer, ids are handed out in order starting from 0
+    size_t add_buffer(size_t size, size_t first_use);
+
+    /// \brief Ends the lifetime of \p buffer after step \p last_use. Buffers whose lifetime is
+    /// never ended stay live until the last step.
+    void set_last_use(size_t buffer, size_t last_use);
+
+    /// \brief Places every buffer added so far
+    void plan();
+
+    size_t get_offset(size_t buffer) const;
+    size_t max_allocated() const { return m_report.peak; }
+    const Report& get_report() const { return m_report; }
+    void dump(std::ostream&) const;
+
+private:
+    struct Buffer
+    {
+        size_t size;
+        size_t first_use;
+        size_t last_use;
+    };
+
+    size_t compute_lower_bound() const;
+    std::vector<std::vector<size_t>> compute_overlaps() const;
+    bool place(const std::vector<size_t>& order,
+               const std::vector<std::vector<size_t>>& overlaps,
+               bool best_fit,
+               bool can_stop,
+               std::chrono::steady_clock::time_point deadline,
+               std::vector<size_t>& offsets,
+               size_t& peak) const;
+    void compute_fragmentation();
+
+    std::vector<Buffer> m_buffers;
+    std::vector<size_t> m_offsets;
+    size_t m_alignment;
+    std::chrono::microseconds m_time_budget;
+    bool m_planned{false};
+    Report m_report;
+};
+
+class NGRAPH_API ngraph::pass::MemoryLayout : public FunctionPass
+{
+public:
+    /// \param planning_budget Time StaticMemoryPlanner may spend on each function
+    MemoryLayout(size_t alignment = 1,
+                 bool disable_memory_sharing = false,
+                 std::chrono::microseconds planning_budget =
+                     StaticMemoryPlanner::get_default_time_budget());
+    bool run_on_function(std::shared_ptr<ngraph::Function>) override;
+
+    /// \brief The report of the plan made for the last function
+    const StaticMemoryPlanner::Report& get_report() const { return m_report; }
+private:
+    size_t m_alignment;
+    bool m_disable_memory_sharing;
+    std::chrono::microseconds m_planning_budget;
+    StaticMemoryPlanner::Report m_report;
+};
@@ -66,7 +66,8 @@ bool pass::MemoryVisualize::run_on_module(vector<shared_ptr<Function>>& function
             size_t temp_max_size = 0;
             for (shared_ptr<Node> node : nodes)
             {
-                tensors.insert(node->liveness_new_list.begin(), node->liveness_new_list.end());
+                auto& new_list = node->get_liveness_new_list();
+                tensors.insert(new_list.begin(), new_list.end());
             }
             for (descriptor::Tensor* tensor : tensors)
             {
@@ -104,7 +105,7 @@ unordered_set<const descriptor::Tensor*>
     for (shared_ptr<Node> exop : nodes)
     {
         size_t size = 0;
-        for (const descriptor::Tensor* tensor : exop->liveness_new_list)
+        for (const descriptor::Tensor* tensor : exop->get_liveness_new_list())
         {
             liveness_list.insert(tensor);
             size += tensor->size();
@@ -139,12 +140,12 @@ void pass::MemoryVisualize::draw_tensor_weight(ostream& file, const vector<share
     size_t i = 0;
     for (shared_ptr<Node> exop : nodes)
     {
-        for (const descriptor::Tensor* tensor : exop->liveness_new_list)
+        for (const descriptor::Tensor* tensor : exop->get_liveness_new_list())
         {
             age_list[tensor] = i;
             generator_op[tensor] = exop;
         }
-        for (const descriptor::Tensor* tensor : exop->liveness_free_list)
+        for (const descriptor::Tensor* tensor : exop->get_liveness_free_list())
         {
             size_t start = age_list[tensor];
             age_list[tensor] = (i - start);
@@ -239,11 +240,11 @@ void pass::MemoryVisualize::draw_op_influence(ostream& file, const vector<shared
 int pass::MemoryVisualize::compute_op_weight(const shared_ptr<Node> exop)
 {
     int mass = 0;
-    for (const descriptor::Tensor* tensor : exop->liveness_new_list)
+    for (const descriptor::Tensor* tensor : exop->get_liveness_new_list())
     {
         mass += static_cast<int>(tensor->size());
     }
-    for (const descriptor::Tensor* tensor : exop->liveness_free_list)
+    for (const descriptor::Tensor* tensor : exop->get_liveness_free_list())
     {
         mass -= static_cast<int>(tensor->size());
     }
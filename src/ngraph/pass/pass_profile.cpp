@@ -0,0 +1,134 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+#include "ngraph/pass/pass_profile.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string json_string(const string& s)
+{
+    string result = "\"";
+    for (char c : s)
+    {
+        if (c == '"' || c == '\\')
+        {
+            result += '\\';
+            result += c;
+        }
+        else if (static_cast<unsigned char>(c) < 0x20)
+        {
+            result += ' ';
+        }
+        else
+        {
+            result += c;
+        }
+    }
+    result += "\"";
+    return result;
+}
+
+void pass::MatcherProfiler::record(const string& name,
+                                   bool matched,
+                                   bool rewrote,
+                                   uint64_t time_ns)
+{
+    auto it = m_index.find(name);
+    if (it == m_index.end())
+    {
+        it = m_index.insert({name, m_profile.size()}).first;
+        m_profile.emplace_back();
+        m_profile.back().name = name;
+    }
+    auto& profile = m_profile[it->second];
+    profile.attempts++;
+    profile.matches += matched ? 1 : 0;
+    profile.callbacks += rewrote ? 1 : 0;
+    profile.time_ns += time_ns;
+}
+
+void pass::MatcherProfiler::clear()
+{
+    m_profile.clear();
+    m_index.clear();
+}
+
+size_t pass::get_peak_rss_bytes()
+{
+#ifdef _WIN32
+    return 0;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+    {
+        return 0;
+    }
+#ifdef __APPLE__
+    return static_cast<size_t>(usage.ru_maxrss);
+#else
+    // Linux reports kilobytes
+    return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#endif
+#endif
+}
+
+void pass::write_json(ostream& out, const PassProfile& profile)
+{
+    out << "{\"name\":" << json_string(profile.name) << ",\"time_us\":" << profile.time_us
+        << ",\"nodes_before\":" << profile.nodes_before
+        << ",\"nodes_after\":" << profile.nodes_after
+        << ",\"peak_rss_bytes\":" << profile.peak_rss_bytes
+        << ",\"peak_rss_increase_bytes\":" << profile.peak_rss_increase_bytes
+        << ",\"matchers\":[";
+    bool first = true;
+    for (auto& matcher : profile.matchers)
+    {
+        if (!first)
+        {
+            out << ",";
+        }
+        first = false;
+        out << "{\"name\":" << json_string(matcher.name) << ",\"attempts\":" << matcher.attempts
+            << ",\"matches\":" << matcher.matches << ",\"callbacks\":" << matcher.callbacks
+            << ",\"time_ns\":" << matcher.time_ns << "}";
+    }
+    out << "]}";
+}
+
+void pass::write_json(ostream& out,
+                      const string& function_name,
+                      uint64_t time_us,
+                      const vector<PassProfile>& profile)
+{
+    out << "{\"function\":" << json_string(function_name) << ",\"time_us\":" << time_us
+        << ",\"passes\":[";
+    bool first = true;
+    for (auto& pass_profile : profile)
+    {
+        if (!first)
+        {
+            out << ",";
+        }
+        first = false;
+        write_json(out, pass_profile);
+    }
+    out << "]}\n";
+}
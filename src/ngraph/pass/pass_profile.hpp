@@ -0,0 +1,98 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ngraph/ngraph_visibility.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        /// \brief Counters collected for one GraphRewrite matcher, aggregated by matcher name
+        struct MatcherProfile
+        {
+            std::string name;
+            /// Number of nodes the matcher was tried on
+            size_t attempts = 0;
+            /// Number of nodes the pattern matched
+            size_t matches = 0;
+            /// Number of callbacks that rewrote the graph (returned true)
+            size_t callbacks = 0;
+            /// Time spent matching and in callbacks
+            uint64_t time_ns = 0;
+        };
+
+        /// \brief Cost of one pass of a pass::Manager run
+        struct PassProfile
+        {
+            std::string name;
+            uint64_t time_us = 0;
+            /// Number of ops in all functions the pass ran on, before and after the pass
+            size_t nodes_before = 0;
+            size_t nodes_after = 0;
+            /// Resident set high-water mark of the process after the pass, and by how much
+            /// the pass raised it. Zero where the platform does not report it.
+            size_t peak_rss_bytes = 0;
+            size_t peak_rss_increase_bytes = 0;
+            /// Only filled in for GraphRewrite and RecurrentGraphRewrite passes
+            std::vector<MatcherProfile> matchers;
+        };
+
+        /// \brief Accumulates MatcherProfile entries while enabled. Owned by the rewrite passes
+        ///        and driven by pass::Manager when pass profiling is on.
+        class NGRAPH_API MatcherProfiler
+        {
+        public:
+            bool is_enabled() const { return m_enabled; }
+            void set_enabled(bool enabled) { m_enabled = enabled; }
+            /// \brief Accounts one attempt of the named matcher on a node
+            void record(const std::string& name, bool matched, bool rewrote, uint64_t time_ns);
+            const std::vector<MatcherProfile>& get_profile() const { return m_profile; }
+            void clear();
+
+        private:
+            bool m_enabled = false;
+            std::vector<MatcherProfile> m_profile;
+            std::unordered_map<std::string, size_t> m_index;
+        };
+
+        /// \brief Returns the resident set high-water mark of the process in bytes, or 0 if the
+        ///        platform does not report it
+        NGRAPH_API size_t get_peak_rss_bytes();
+
+        /// \brief Writes the JSON representation of a single profiled pass
+        NGRAPH_API void write_json(std::ostream& out, const PassProfile& profile);
+
+        /// \brief Writes a pass::Manager run as a single line JSON object
+        ///
+        /// {"function": ..., "time_us": ..., "passes": [{"name": ..., "time_us": ...,
+        /// "nodes_before": ..., "nodes_after": ..., "peak_rss_bytes": ...,
+        /// "peak_rss_increase_bytes": ..., "matchers": [{"name": ..., "attempts": ...,
+        /// "matches": ..., "callbacks": ..., "time_ns": ...}]}]}
+        NGRAPH_API void write_json(std::ostream& out,
+                                   const std::string& function_name,
+                                   uint64_t time_us,
+                                   const std::vector<PassProfile>& profile);
+    }
+}
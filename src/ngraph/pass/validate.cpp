@@ -21,6 +21,13 @@ using namespace ngraph;
 
 bool pass::Validate::run_on_function(std::shared_ptr<Function> f)
 {
-    f->validate_nodes_and_infer_types();
+    if (m_incremental)
+    {
+        f->validate_changed_nodes_and_infer_types();
+    }
+    else
+    {
+        f->validate_nodes_and_infer_types();
+    }
     return false;
 }
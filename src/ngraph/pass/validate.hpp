@@ -22,14 +22,22 @@ namespace ngraph
 {
     namespace pass
     {
+        /// \brief Validates the function and infers the types of all nodes.
+        ///
+        /// An incremental Validate only revalidates the nodes changed since they were last
+        /// validated, see Function::validate_changed_nodes_and_infer_types.
         class NGRAPH_API Validate : public FunctionPass
         {
         public:
-            Validate()
+            Validate(bool incremental = false)
                 : FunctionPass()
+                , m_incremental(incremental)
             {
             }
             bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+        private:
+            bool m_incremental;
         };
     }
 }
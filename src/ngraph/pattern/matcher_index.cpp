@@ -0,0 +1,187 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <numeric>
+
+#include "ngraph/pattern/matcher_index.hpp"
+#include "ngraph/pattern/op/any_output.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+bool pattern::MatcherIndex::Symbol::operator==(const Symbol& other) const
+{
+    if (type == nullptr || other.type == nullptr)
+    {
+        return type == other.type;
+    }
+    return arity == other.arity && output_index == other.output_index &&
+           (type == other.type || *type == *other.type);
+}
+
+pattern::MatcherIndex::MatcherIndex()
+{
+    m_tree.push_back(TreeNode{Symbol{nullptr, 0, 0}, no_node, no_node, no_node});
+}
+
+size_t pattern::MatcherIndex::add(const Output<Node>& pattern)
+{
+    vector<Symbol> symbols;
+    flatten(pattern, symbols);
+
+    uint32_t tree_node = 0;
+    for (auto& symbol : symbols)
+    {
+        tree_node = find_or_add_child(tree_node, symbol);
+    }
+
+    size_t id = m_pattern_count++;
+    m_accepted.push_back(Accepted{id, m_tree[tree_node].first_accepted});
+    m_tree[tree_node].first_accepted = static_cast<uint32_t>(m_accepted.size() - 1);
+    return id;
+}
+
+void pattern::MatcherIndex::flatten(const Output<Node>& value, vector<Symbol>& symbols) const
+{
+    Node* node = value.get_node();
+    uint32_t output_index = static_cast<uint32_t>(value.get_index());
+    if (is_type<op::AnyOutput>(node))
+    {
+        // AnyOutput matches its wrapped op through whichever output the graph value is
+        node = node->get_input_node_ptr(0);
+        output_index = any_index;
+    }
+
+    if (node->is_pattern())
+    {
+        symbols.push_back(Symbol{nullptr, 0, 0});
+        return;
+    }
+
+    symbols.push_back(Symbol{
+        &node->get_type_info(), static_cast<uint32_t>(node->get_input_size()), output_index});
+    for (auto& input_value : node->input_values())
+    {
+        flatten(input_value, symbols);
+    }
+}
+
+uint32_t pattern::MatcherIndex::find_or_add_child(uint32_t parent, const Symbol& symbol)
+{
+    uint32_t last = no_node;
+    for (uint32_t child = m_tree[parent].first_child; child != no_node;
+         child = m_tree[child].next_sibling)
+    {
+        if (m_tree[child].symbol == symbol)
+        {
+            return child;
+        }
+        last = child;
+    }
+
+    uint32_t child = static_cast<uint32_t>(m_tree.size());
+    m_tree.push_back(TreeNode{symbol, no_node, no_node, no_node});
+    if (last == no_node)
+    {
+        m_tree[parent].first_child = child;
+    }
+    else
+    {
+        m_tree[last].next_sibling = child;
+    }
+    return child;
+}
+
+void pattern::MatcherIndex::find(const Output<Node>& graph_value,
+                                 vector<size_t>& candidates) const
+{
+    candidates.clear();
+    vector<Pending> pending{Pending{graph_value.get_node(), graph_value.get_index()}};
+    walk(0, pending, candidates);
+
+    // A commutative op can reach the same pattern through several argument orders
+    sort(candidates.begin(), candidates.end());
+    candidates.erase(unique(candidates.begin(), candidates.end()), candidates.end());
+}
+
+void pattern::MatcherIndex::walk(uint32_t tree_node,
+                                 vector<Pending>& pending,
+                                 vector<size_t>& candidates) const
+{
+    // Every symbol consumes exactly the values it pushed, so patterns end at an empty stack
+    if (pending.empty())
+    {
+        for (uint32_t accepted = m_tree[tree_node].first_accepted; accepted != no_node;
+             accepted = m_accepted[accepted].next)
+        {
+            candidates.push_back(m_accepted[accepted].pattern);
+        }
+        return;
+    }
+
+    Pending value = pending.back();
+    pending.pop_back();
+    Node* node = value.node;
+    const DiscreteTypeInfo& type_info = node->get_type_info();
+    size_t arity = node->get_input_size();
+    for (uint32_t child = m_tree[tree_node].first_child; child != no_node;
+         child = m_tree[child].next_sibling)
+    {
+        const Symbol& symbol = m_tree[child].symbol;
+        if (symbol.type == nullptr)
+        {
+            walk(child, pending, candidates);
+        }
+        else if (symbol.arity == arity &&
+                 (symbol.output_index == any_index || symbol.output_index == value.index) &&
+                 (symbol.type == &type_info || *symbol.type == type_info))
+        {
+            descend(child, node, pending, candidates);
+        }
+    }
+    pending.push_back(value);
+}
+
+void pattern::MatcherIndex::descend(uint32_t tree_node,
+                                    Node* node,
+                                    vector<Pending>& pending,
+                                    vector<size_t>& candidates) const
+{
+    size_t base = pending.size();
+    size_t arity = node->get_input_size();
+    vector<Pending> args;
+    args.reserve(arity);
+    for (size_t i = 0; i < arity; i++)
+    {
+        args.push_back(Pending{node->get_input_node_ptr(i), node->input_value(i).get_index()});
+    }
+
+    // Arguments are pushed last to first so that the first one is consumed next, which is the
+    // preorder the patterns were flattened in. Matcher::match_arguments tries every order of the
+    // arguments of a commutative op, so the walk does too.
+    vector<size_t> order(arity);
+    iota(order.begin(), order.end(), 0);
+    do
+    {
+        for (auto it = order.rbegin(); it != order.rend(); ++it)
+        {
+            pending.push_back(args[*it]);
+        }
+        walk(tree_node, pending, candidates);
+        pending.resize(base);
+    } while (node->is_commutative() && next_permutation(order.begin(), order.end()));
+}
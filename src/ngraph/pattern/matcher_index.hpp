@@ -0,0 +1,109 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "ngraph/node.hpp"
+
+namespace ngraph
+{
+    namespace pattern
+    {
+        /// MatcherIndex compiles a set of patterns into one discrimination tree so that the
+        /// patterns which may match a graph value are found with a single walk of the graph,
+        /// instead of running every Matcher on every node.
+        ///
+        /// A pattern is flattened in preorder into one symbol per op: its type, its number of
+        /// inputs and the output index it is used through. Pattern ops (Label, Any, Skip, ...)
+        /// become wildcards that accept any graph subtree, so their inputs are not indexed. The
+        /// symbols of all patterns share one prefix tree stored in flat arrays.
+        ///
+        /// The index only rules out patterns whose op skeleton cannot match; predicates, label
+        /// bindings and strict mode are left to the Matcher that runs on the candidates. This
+        /// assumes the Matcher does not accept an op that Node::match_value would reject.
+        class NGRAPH_API MatcherIndex
+        {
+        public:
+            MatcherIndex();
+
+            /// \brief Adds \p pattern to the index
+            /// \returns The id of the pattern, ids are handed out in order starting from 0
+            size_t add(const Output<Node>& pattern);
+
+            /// \brief Finds the patterns that may match \p graph_value
+            ///
+            /// \param graph_value is the value a Matcher would be started on
+            /// \param candidates receives the ids of the patterns in increasing order
+            void find(const Output<Node>& graph_value, std::vector<size_t>& candidates) const;
+
+            size_t get_pattern_count() const { return m_pattern_count; }
+            size_t get_tree_size() const { return m_tree.size(); }
+        private:
+            static constexpr uint32_t any_index = UINT32_MAX;
+            static constexpr uint32_t no_node = UINT32_MAX;
+
+            struct Symbol
+            {
+                // nullptr for a wildcard
+                const DiscreteTypeInfo* type;
+                uint32_t arity;
+                uint32_t output_index;
+
+                bool operator==(const Symbol& other) const;
+            };
+
+            struct TreeNode
+            {
+                Symbol symbol;
+                uint32_t first_child;
+                uint32_t next_sibling;
+                // Head of the list in m_accepted of the patterns that end at this node
+                uint32_t first_accepted;
+            };
+
+            struct Accepted
+            {
+                size_t pattern;
+                uint32_t next;
+            };
+
+            // A graph value that still has to be consumed by the walk
+            struct Pending
+            {
+                Node* node;
+                size_t index;
+            };
+
+            void flatten(const Output<Node>& value, std::vector<Symbol>& symbols) const;
+            uint32_t find_or_add_child(uint32_t parent, const Symbol& symbol);
+            void walk(uint32_t tree_node,
+                      std::vector<Pending>& pending,
+                      std::vector<size_t>& candidates) const;
+            void descend(uint32_t tree_node,
+                         Node* node,
+                         std::vector<Pending>& pending,
+                         std::vector<size_t>& candidates) const;
+
+            // m_tree[0] is the root and carries no symbol
+            std::vector<TreeNode> m_tree;
+            std::vector<Accepted> m_accepted;
+            size_t m_pattern_count{0};
+        };
+    }
+}
@@ -70,6 +70,7 @@ private:
     AlignedBuffer(const AlignedBuffer&) = delete;
     AlignedBuffer& operator=(const AlignedBuffer&) = delete;
 
+protected:
     Allocator* m_allocator;
     char* m_allocated_buffer;
     char* m_aligned_buffer;
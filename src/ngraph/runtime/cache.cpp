@@ -14,14 +14,21 @@
 // limitations under the License.
 //*****************************************************************************
 
-#include "ngraph/runtime/cache.hpp"
+#include <cerrno>
+#include <cstdlib>
+#include <iterator>
+
 #include "ngraph/env_util.hpp"
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/cache.hpp"
 
 using namespace ngraph;
 using namespace std;
 
 // Constructor
 runtime::LRUCache::LRUCache()
+    : m_byte_budget(0)
+    , m_size_in_bytes(0)
 {
     int32_t cache_size = getenv_int("NGRAPH_CACHE_SIZE");
     if (cache_size <= 0)
@@ -33,16 +40,37 @@ runtime::LRUCache::LRUCache()
         m_cache_size = cache_size;
     }
 
-    m_map = {};
-    m_list = {};
+    // Budgets for large models exceed what getenv_int can hold
+    string byte_budget = getenv_string("NGRAPH_CACHE_BYTE_BUDGET");
+    if (!byte_budget.empty())
+    {
+        char* end;
+        errno = 0;
+        long long value = strtoll(byte_budget.c_str(), &end, 0);
+        if (errno || *end || value < 0)
+        {
+            throw ngraph_error("Environment variable \"NGRAPH_CACHE_BYTE_BUDGET\"=\"" +
+                               byte_budget + "\" is not a valid number of bytes");
+        }
+        m_byte_budget = static_cast<size_t>(value);
+    }
 }
 
 // Destructor
 runtime::LRUCache::~LRUCache()
 {
-    m_list.clear();
     m_map.clear();
-    m_clone_function_map.clear();
+    m_list.clear();
+}
+
+size_t runtime::LRUCache::ShapeHash::operator()(const vector<int>& shape) const
+{
+    size_t seed = shape.size();
+    for (auto value : shape)
+    {
+        seed ^= hash<int>()(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    }
+    return seed;
 }
 
 void runtime::LRUCache::convert_shape_to_string(const vector<int>& shape, ostringstream& key)
@@ -55,63 +83,69 @@ void runtime::LRUCache::convert_shape_to_string(const vector<int>& shape, ostrin
 
 void runtime::LRUCache::add_entry(const vector<int>& shape,
                                   shared_ptr<runtime::Executable> exec,
-                                  shared_ptr<Function> func)
+                                  shared_ptr<Function> func,
+                                  size_t size_in_bytes)
 {
     std::lock_guard<std::mutex> guard(m_mutex);
-    ostringstream key;
-    // check if the list is empty
-    if (m_list.size() == m_cache_size)
+    // The same shape may have been compiled by two callers at once, keep the newest
+    auto it = m_map.find(shape);
+    if (it != m_map.end())
     {
-        ostringstream key;
-        convert_shape_to_string(m_list.back(), key);
-        m_list.pop_back();
-        m_map.erase(key.str());
+        m_size_in_bytes -= it->second->size_in_bytes;
+        m_list.erase(it->second);
+        m_map.erase(it);
     }
 
-    convert_shape_to_string(shape, key);
-    m_map.insert({key.str(), exec});
-    m_list.push_front(shape);
-    m_clone_function_map.insert({key.str(), func});
+    m_list.push_front(Entry{shape, exec, func, size_in_bytes});
+    m_map.insert({shape, m_list.begin()});
+    m_size_in_bytes += size_in_bytes;
+    evict();
 }
 
-bool runtime::LRUCache::is_cached(const vector<int>& shape)
+void runtime::LRUCache::evict()
 {
-    for (auto itr = m_list.begin(); itr != m_list.end(); itr++)
+    while (m_list.size() > 1 &&
+           (m_list.size() > m_cache_size ||
+            (m_byte_budget != 0 && m_size_in_bytes > m_byte_budget)))
     {
-        if (*itr == shape)
-        {
-            return true;
-        }
+        m_size_in_bytes -= m_list.back().size_in_bytes;
+        m_map.erase(m_list.back().shape);
+        m_list.pop_back();
     }
-    return false;
 }
 
-shared_ptr<runtime::Executable> runtime::LRUCache::get_cached_entry(const vector<int>& shape)
+bool runtime::LRUCache::is_cached(const vector<int>& shape)
 {
     std::lock_guard<std::mutex> guard(m_mutex);
-    ostringstream key;
-    convert_shape_to_string(shape, key);
+    return m_map.find(shape) != m_map.end();
+}
 
-    // find the entry and return the function
-    auto it = m_map.find(key.str());
+bool runtime::LRUCache::get_entry(const vector<int>& shape,
+                                  shared_ptr<runtime::Executable>& exec,
+                                  shared_ptr<Function>& func)
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    auto it = m_map.find(shape);
     if (it == m_map.end())
     {
-        throw ngraph_error("Entry not found in cache");
+        return false;
     }
-    else
+    // update list to push this reference to the front
+    m_list.splice(m_list.begin(), m_list, it->second);
+    exec = it->second->exec;
+    func = it->second->func;
+    return true;
+}
+
+shared_ptr<runtime::Executable> runtime::LRUCache::get_cached_entry(const vector<int>& shape)
+{
+    shared_ptr<runtime::Executable> exec;
+    shared_ptr<Function> func;
+    if (!get_entry(shape, exec, func))
     {
-        // update list to push this reference to the front
-        for (auto itr = m_list.begin(); itr != m_list.end(); itr++)
-        {
-            if (*itr == shape)
-            {
-                m_list.remove(shape);
-                m_list.push_front(shape);
-                break;
-            }
-        }
-        return it->second;
+        throw ngraph_error("Entry not found in cache");
     }
+    return exec;
 }
 
 // Need the clone function to get the output shape so that
@@ -119,13 +153,41 @@ shared_ptr<runtime::Executable> runtime::LRUCache::get_cached_entry(const vector
 shared_ptr<Function> runtime::LRUCache::get_cloned_function(const vector<int>& shape)
 {
     std::lock_guard<std::mutex> guard(m_mutex);
-    ostringstream key;
-    convert_shape_to_string(shape, key);
-    // find the entry and return the function
-    auto it = m_clone_function_map.find(key.str());
-    if (it == m_clone_function_map.end())
+    auto it = m_map.find(shape);
+    if (it == m_map.end())
     {
         throw ngraph_error("Cloned function not found");
     }
-    return it->second;
+    return it->second->func;
+}
+
+vector<vector<int>> runtime::LRUCache::get_cached_keys()
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    vector<vector<int>> keys;
+    keys.reserve(m_list.size());
+    for (auto& entry : m_list)
+    {
+        keys.push_back(entry.shape);
+    }
+    return keys;
+}
+
+void runtime::LRUCache::set_byte_budget(size_t byte_budget)
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    m_byte_budget = byte_budget;
+    evict();
+}
+
+size_t runtime::LRUCache::get_size_in_bytes()
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    return m_size_in_bytes;
+}
+
+size_t runtime::LRUCache::get_num_entries()
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    return m_list.size();
 }
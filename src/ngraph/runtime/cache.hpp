@@ -16,14 +16,14 @@
 
 #pragma once
 
-#include <algorithm>
-#include <iostream>
-#include <iterator>
+#include <cstddef>
 #include <list>
+#include <memory>
 #include <mutex>
 #include <sstream>
-#include <string>
 #include <unordered_map>
+#include <vector>
+
 #include "ngraph/function.hpp"
 #include "ngraph/runtime/executable.hpp"
 #include "ngraph/shape.hpp"
@@ -32,29 +32,66 @@ namespace ngraph
 {
     namespace runtime
     {
-        class LRUCache : public std::enable_shared_from_this<LRUCache>
+        /// \brief Least recently used cache of executables compiled for specific input shapes.
+        ///
+        /// The cache is bounded by an entry count (NGRAPH_CACHE_SIZE, default 1024) and,
+        /// optionally, by the estimated size in bytes of the cached entries
+        /// (NGRAPH_CACHE_BYTE_BUDGET, default unbounded). The most recently added entry is never
+        /// evicted, even if it exceeds the byte budget on its own.
+        class NGRAPH_API LRUCache : public std::enable_shared_from_this<LRUCache>
         {
         public:
-            using GraphCache = std::unordered_map<std::string, std::shared_ptr<Executable>>;
-            using ClonedFunctionMap = std::unordered_map<std::string, std::shared_ptr<Function>>;
-
             LRUCache();
 
             virtual ~LRUCache();
 
             void add_entry(const std::vector<int>& shape,
                            std::shared_ptr<Executable> exec,
-                           std::shared_ptr<Function> func);
+                           std::shared_ptr<Function> func,
+                           size_t size_in_bytes = 0);
             bool is_cached(const std::vector<int>& shape);
             std::shared_ptr<Executable> get_cached_entry(const std::vector<int>& shape);
             void convert_shape_to_string(const std::vector<int>& shape, std::ostringstream& key);
             std::shared_ptr<Function> get_cloned_function(const std::vector<int>& shape);
+            /// \brief Look up the executable and cloned function for `shape` in one step.
+            /// \return false if `shape` is not cached
+            bool get_entry(const std::vector<int>& shape,
+                           std::shared_ptr<Executable>& exec,
+                           std::shared_ptr<Function>& func);
+
+            /// \brief The keys of all cached entries, most recently used first
+            std::vector<std::vector<int>> get_cached_keys();
+
+            /// \brief Set the byte budget, evicting entries if needed. 0 means unbounded.
+            void set_byte_budget(size_t byte_budget);
+            size_t get_byte_budget() const { return m_byte_budget; }
+            size_t get_size_in_bytes();
+            size_t get_num_entries();
 
         private:
-            int m_cache_size;
-            GraphCache m_map;
-            ClonedFunctionMap m_clone_function_map;
-            std::list<std::vector<int>> m_list;
+            struct Entry
+            {
+                std::vector<int> shape;
+                std::shared_ptr<Executable> exec;
+                std::shared_ptr<Function> func;
+                size_t size_in_bytes;
+            };
+
+            struct ShapeHash
+            {
+                size_t operator()(const std::vector<int>& shape) const;
+            };
+
+            using EntryList = std::list<Entry>;
+
+            void evict();
+
+            size_t m_cache_size;
+            size_t m_byte_budget;
+            size_t m_size_in_bytes;
+            // Most recently used entry first
+            EntryList m_list;
+            std::unordered_map<std::vector<int>, EntryList::iterator, ShapeHash> m_map;
             std::mutex m_mutex;
         };
     }
@@ -19,6 +19,7 @@
 #include "ngraph/op/add.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/kernel/add.hpp"
+#include "ngraph/runtime/cpu/kernel/half_precision.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 
@@ -83,7 +84,7 @@ namespace ngraph
                 }
                 else
                 {
-                    BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::add);
+                    BUILD_BINARY_ELEMWISE_HALF_FUNCTOR(runtime::cpu::kernel::add);
                 }
             }
 
@@ -40,15 +40,28 @@ namespace ngraph
 
                 std::function<decltype(runtime::cpu::kernel::convert<float, int>)> kernel;
 
-                if (out[0].get_element_type() == element::boolean)
+                auto input_type = args[0].get_element_type();
+                auto output_type = out[0].get_element_type();
+                if (input_type == element::f16 && output_type == element::f32)
                 {
-                    SELECT_KERNEL(
-                        kernel, args[0].get_element_type(), runtime::cpu::kernel::convert_to_bool)
+                    kernel = runtime::cpu::kernel::convert_f16_to_f32;
+                }
+                else if (input_type == element::f32 && output_type == element::f16)
+                {
+                    kernel = runtime::cpu::kernel::convert_f32_to_f16;
+                }
+                else if (input_type == element::bf16 && output_type == element::f32)
+                {
+                    kernel = runtime::cpu::kernel::convert_bf16_to_f32;
                 }
-                else if (args[0].get_element_type() == element::bf16 &&
-                         out[0].get_element_type() == element::f32)
+                else if (input_type == element::f32 && output_type == element::bf16)
                 {
-                    kernel = runtime::cpu::kernel::convert_to_float32<bfloat16>;
+                    kernel = runtime::cpu::kernel::convert_f32_to_bf16;
+                }
+                else if (out[0].get_element_type() == element::boolean)
+                {
+                    SELECT_KERNEL(
+                        kernel, args[0].get_element_type(), runtime::cpu::kernel::convert_to_bool)
                 }
                 else if (out[0].get_element_type() == element::f32)
                 {
@@ -102,11 +115,6 @@ namespace ngraph
                     SELECT_KERNEL(
                         kernel, args[0].get_element_type(), runtime::cpu::kernel::convert_to_u64)
                 }
-                else if (args[0].get_element_type() == element::f32 &&
-                         out[0].get_element_type() == element::bf16)
-                {
-                    kernel = runtime::cpu::kernel::convert_to_bf16<float>;
-                }
                 else
                 {
                     NGRAPH_CHECK(false,
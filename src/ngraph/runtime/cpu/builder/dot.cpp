@@ -21,6 +21,7 @@
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/cpu_kernels.hpp"
 #include "ngraph/runtime/cpu/kernel/dot.hpp"
+#include "ngraph/runtime/cpu/kernel/half_precision.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -235,6 +236,42 @@ namespace ngraph
                     return;
                 }
 
+                if (out[0].get_element_type() == element::f16 ||
+                    out[0].get_element_type() == element::bf16)
+                {
+                    std::function<decltype(runtime::cpu::kernel::half_dot<float16>)> kernel;
+                    if (out[0].get_element_type() == element::f16)
+                    {
+                        kernel = runtime::cpu::kernel::half_dot<float16>;
+                    }
+                    else
+                    {
+                        kernel = runtime::cpu::kernel::half_dot<bfloat16>;
+                    }
+
+                    auto functor = [&,
+                                    kernel,
+                                    arg0_shape,
+                                    arg1_shape,
+                                    result_shape,
+                                    reduction_axes_count,
+                                    arg0_buffer_index,
+                                    arg1_buffer_index,
+                                    out_buffer_index](CPURuntimeContext* ctx,
+                                                      CPUExecutionContext* ectx) {
+                        kernel(ctx->buffer_data[arg0_buffer_index],
+                               ctx->buffer_data[arg1_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
+                               arg0_shape,
+                               arg1_shape,
+                               result_shape,
+                               reduction_axes_count,
+                               ectx->arena);
+                    };
+                    functors.emplace_back(functor);
+                    return;
+                }
+
                 std::function<decltype(runtime::cpu::kernel::dot_ref<float, float, float>)> kernel;
 
                 SELECT_KERNEL_3ARGS(
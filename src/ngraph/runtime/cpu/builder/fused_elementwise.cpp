@@ -0,0 +1,98 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/kernel/fused_elementwise.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/op/fused_elementwise.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::FusedElementwise)
+            {
+                auto& functors = external_function->get_functors();
+                auto fused = static_cast<const ngraph::op::FusedElementwise*>(node);
+
+                auto loop = make_shared<runtime::cpu::kernel::FusedElementwiseLoop>();
+                loop->shape = out[0].get_shape();
+                loop->count = shape_size(loop->shape);
+                for (size_t i = 0; i < args.size(); i++)
+                {
+                    auto& broadcast_axes = fused->get_broadcast_axes()[i];
+                    vector<size_t> strides;
+                    if (!broadcast_axes.empty())
+                    {
+                        auto arg_strides = row_major_strides(args[i].get_shape());
+                        size_t arg_axis = 0;
+                        for (size_t axis = 0; axis < loop->shape.size(); axis++)
+                        {
+                            strides.push_back(broadcast_axes.count(axis) != 0
+                                                  ? 0
+                                                  : arg_strides[arg_axis++]);
+                        }
+                    }
+                    loop->input_strides.push_back(strides);
+                }
+                loop->instructions = fused->get_instructions();
+                for (auto& arg : args)
+                {
+                    loop->input_buffers.push_back(
+                        external_function->get_buffer_index(arg.get_name()));
+                }
+                loop->value_buffers.resize(args.size() + loop->instructions.size(),
+                                           runtime::cpu::kernel::fused_elementwise_no_output);
+                loop->num_outputs = out.size();
+                for (size_t i = 0; i < out.size(); i++)
+                {
+                    loop->value_buffers[fused->get_results()[i]] =
+                        external_function->get_buffer_index(out[i].get_name());
+                }
+
+                std::function<decltype(runtime::cpu::kernel::fused_elementwise<float>)> kernel;
+                if (out[0].get_element_type() == element::f32)
+                {
+                    kernel = runtime::cpu::kernel::fused_elementwise<float>;
+                }
+                else if (out[0].get_element_type() == element::f64)
+                {
+                    kernel = runtime::cpu::kernel::fused_elementwise<double>;
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported type in CPU Builder for FusedElementwise");
+                }
+
+                auto functor = [&, kernel, loop](CPURuntimeContext* ctx,
+                                                 CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data.data(), *loop, ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_fused_elementwise_cpp()
+            {
+                REGISTER_OP_BUILDER(FusedElementwise);
+            }
+        }
+    }
+}
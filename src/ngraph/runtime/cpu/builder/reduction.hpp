@@ -173,7 +173,7 @@
                                                                                                    \
     std::function<decltype(runtime::cpu::kernel::K<float>)> ref_kernel;                            \
                                                                                                    \
-    SELECT_KERNEL(ref_kernel, result_element_type, runtime::cpu::kernel::K);                       \
+    SELECT_KERNEL_HALF(ref_kernel, result_element_type, runtime::cpu::kernel::K);                  \
                                                                                                    \
     auto functor = [&,                                                                             \
                     ref_kernel,                                                                    \
@@ -17,6 +17,7 @@
 #include "ngraph/runtime/cpu/kernel/relu.hpp"
 #include "ngraph/op/relu.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/half_precision.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 
@@ -78,7 +79,7 @@ namespace ngraph
                 }
                 else
                 {
-                    BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::relu);
+                    BUILD_UNARY_ELEMWISE_HALF_FUNCTOR(runtime::cpu::kernel::relu);
                 }
             }
 
@@ -16,7 +16,7 @@
 
 #include "ngraph/op/experimental/generate_mask.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
-#include "ngraph/runtime/reference/generate_mask.hpp"
+#include "ngraph/runtime/cpu/kernel/random.hpp"
 #include "ngraph/state/bernoulli_rng_state.hpp"
 
 using namespace std;
@@ -62,7 +62,7 @@ namespace ngraph
                                arg2_buffer_index,
                                arg3_buffer_index,
                                arg4_buffer_index](CPURuntimeContext* ctx,
-                                                  CPUExecutionContext* /* ectx */) {
+                                                  CPUExecutionContext* ectx) {
                         bool training = static_cast<bool>(
                             static_cast<float*>(ctx->buffer_data[arg_buffer_index])[0]);
                         // TODO: get shape when required
@@ -74,20 +74,22 @@ namespace ngraph
 
                         if (use_seed == false)
                         {
-                            reference::generate_mask(
+                            runtime::cpu::kernel::generate_mask(
                                 static_cast<float*>(ctx->buffer_data[out_buffer_index]),
                                 element_count,
                                 static_cast<BernoulliRNGState*>(ctx->states[index]),
-                                training);
+                                training,
+                                ectx->arena);
                         }
                         else
                         {
-                            reference::generate_mask_no_state(
+                            runtime::cpu::kernel::generate_mask_no_state(
                                 static_cast<float*>(ctx->buffer_data[out_buffer_index]),
                                 element_count,
                                 training,
                                 seed,
-                                prob);
+                                prob,
+                                ectx->arena);
                         }
                     };
                 }
@@ -101,7 +103,7 @@ namespace ngraph
                                arg2_buffer_index,
                                arg3_buffer_index,
                                arg4_buffer_index](CPURuntimeContext* ctx,
-                                                  CPUExecutionContext* /* ectx */) {
+                                                  CPUExecutionContext* ectx) {
                         bool training = static_cast<bool>(
                             static_cast<double*>(ctx->buffer_data[arg_buffer_index])[0]);
                         // TODO: get shape when required
@@ -113,20 +115,22 @@ namespace ngraph
 
                         if (use_seed == false)
                         {
-                            reference::generate_mask(
+                            runtime::cpu::kernel::generate_mask(
                                 static_cast<double*>(ctx->buffer_data[out_buffer_index]),
                                 element_count,
                                 static_cast<BernoulliRNGState*>(ctx->states[index]),
-                                training);
+                                training,
+                                ectx->arena);
                         }
                         else
                         {
-                            reference::generate_mask_no_state(
+                            runtime::cpu::kernel::generate_mask_no_state(
                                 static_cast<double*>(ctx->buffer_data[out_buffer_index]),
                                 element_count,
                                 training,
                                 seed,
-                                prob);
+                                prob,
+                                ectx->arena);
                         }
                     };
                 }
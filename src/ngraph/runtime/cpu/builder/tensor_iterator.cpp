@@ -0,0 +1,93 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/tensor_iterator.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/runtime/allocator.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_executable.hpp"
+#include "ngraph/runtime/cpu/cpu_tensor.hpp"
+#include "ngraph/runtime/tensor_iterator_runner.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::TensorIterator)
+            {
+                auto& functors = external_function->get_functors();
+                auto ti = static_cast<const ngraph::op::TensorIterator*>(node);
+
+                vector<size_t> arg_buffer_indices;
+                for (auto& arg : args)
+                {
+                    arg_buffer_indices.push_back(
+                        external_function->get_buffer_index(arg.get_name()));
+                }
+                vector<size_t> out_buffer_indices;
+                for (auto& result : out)
+                {
+                    out_buffer_indices.push_back(
+                        external_function->get_buffer_index(result.get_name()));
+                }
+
+                // The body is compiled once, the compiler passes work on a copy of it
+                auto body = ti->get_body();
+                auto body_function = clone_function(Function(
+                    body->get_results(), body->get_parameters(), ti->get_name() + "_body"));
+                ngraph::pass::PassConfig pass_config;
+                auto body_executable = make_shared<CPU_Executable>(
+                    body_function, pass_config, runtime::get_default_allocator(), false);
+                auto runner = make_shared<TensorIteratorRunner>(
+                    *ti,
+                    body_executable,
+                    [](const element::Type& type, const Shape& shape, void* data) {
+                        return make_shared<runtime::cpu::CPUTensor>(type, shape, data);
+                    },
+                    [](runtime::Tensor& tensor, void* data) {
+                        static_cast<runtime::cpu::CPUTensor&>(tensor).set_data_ptr(data);
+                    });
+
+                auto functor = [&, runner, arg_buffer_indices, out_buffer_indices](
+                    CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
+                    vector<void*> inputs;
+                    for (auto index : arg_buffer_indices)
+                    {
+                        inputs.push_back(ctx->buffer_data[index]);
+                    }
+                    vector<void*> outputs;
+                    for (auto index : out_buffer_indices)
+                    {
+                        outputs.push_back(ctx->buffer_data[index]);
+                    }
+                    runner->run(inputs, outputs);
+                };
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_tensor_iterator_cpp()
+            {
+                REGISTER_OP_BUILDER(TensorIterator);
+            }
+        }
+    }
+}
@@ -106,6 +106,10 @@ shared_ptr<runtime::Executable>
     }
 #endif
 
+    // Direct execution keeps its compiled state in functors and MKLDNN primitives. Neither can be
+    // written out (MKLDNN has no primitive serialization in the version we use), so only codegen
+    // output reaches the on-disk ExecutableCache, through codegen::Compiler. Direct execution
+    // executables are cached in memory per Function below.
     shared_ptr<runtime::Executable> rc;
     // we will protect the access to map (m_exec_map) across multiple threads by creating a
     // lock_gaurd
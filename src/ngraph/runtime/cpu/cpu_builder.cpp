@@ -89,6 +89,7 @@
 #include "ngraph/runtime/cpu/kernel/floor.hpp"
 #include "ngraph/runtime/cpu/kernel/greater.hpp"
 #include "ngraph/runtime/cpu/kernel/greater_eq.hpp"
+#include "ngraph/runtime/cpu/kernel/half_precision.hpp"
 #include "ngraph/runtime/cpu/kernel/less.hpp"
 #include "ngraph/runtime/cpu/kernel/less_eq.hpp"
 #include "ngraph/runtime/cpu/kernel/log.hpp"
@@ -130,13 +131,13 @@ namespace ngraph
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Subtract)
             {
-                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::subtract);
+                BUILD_BINARY_ELEMWISE_HALF_FUNCTOR(runtime::cpu::kernel::subtract);
             }
 
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Multiply)
             {
-                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::multiply);
+                BUILD_BINARY_ELEMWISE_HALF_FUNCTOR(runtime::cpu::kernel::multiply);
             }
 
             template <>
@@ -145,7 +146,8 @@ namespace ngraph
                 auto& functors = external_function->get_functors();
                 const ngraph::op::Divide* divop = static_cast<const ngraph::op::Divide*>(node);
                 std::function<void(void*, void*, void*, size_t, bool, int)> kernel;
-                SELECT_KERNEL(kernel, args[0].get_element_type(), runtime::cpu::kernel::divide)
+                SELECT_KERNEL_HALF(
+                    kernel, args[0].get_element_type(), runtime::cpu::kernel::divide)
                 auto element_count = out[0].get_size();
                 auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
                 auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
@@ -299,12 +301,12 @@ namespace ngraph
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Maximum)
             {
-                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::maximum);
+                BUILD_BINARY_ELEMWISE_HALF_FUNCTOR(runtime::cpu::kernel::maximum);
             }
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Minimum)
             {
-                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::minimum);
+                BUILD_BINARY_ELEMWISE_HALF_FUNCTOR(runtime::cpu::kernel::minimum);
             }
 
             template <>
@@ -316,7 +318,7 @@ namespace ngraph
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Abs)
             {
-                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::abs);
+                BUILD_UNARY_ELEMWISE_HALF_FUNCTOR(runtime::cpu::kernel::abs);
             }
 
             template <>
@@ -376,24 +378,32 @@ namespace ngraph
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Negative)
             {
-                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::negative);
+                BUILD_UNARY_ELEMWISE_HALF_FUNCTOR(runtime::cpu::kernel::negative);
             }
 
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Sqrt)
             {
-                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::sqrt);
+                BUILD_UNARY_ELEMWISE_HALF_FUNCTOR(runtime::cpu::kernel::sqrt);
             }
 
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Result)
             {
-                if (args[0].get_element_type() == element::bf16)
+                if (args[0].get_element_type() == element::bf16 ||
+                    args[0].get_element_type() == element::f16)
                 {
                     auto& functors = external_function->get_functors();
                     std::function<void(void*, void*, size_t, int)> kernel;
 
-                    kernel = ngraph::runtime::cpu::kernel::result<bfloat16>;
+                    if (args[0].get_element_type() == element::bf16)
+                    {
+                        kernel = ngraph::runtime::cpu::kernel::result<bfloat16>;
+                    }
+                    else
+                    {
+                        kernel = ngraph::runtime::cpu::kernel::result<float16>;
+                    }
 
                     auto element_count = out[0].get_size();
                     auto arg0_buffer_index =
@@ -418,13 +428,13 @@ namespace ngraph
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Exp)
             {
-                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::exp);
+                BUILD_UNARY_ELEMWISE_HALF_FUNCTOR(runtime::cpu::kernel::exp);
             }
 
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Log)
             {
-                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::log);
+                BUILD_UNARY_ELEMWISE_HALF_FUNCTOR(runtime::cpu::kernel::log);
             }
 
             template <>
@@ -460,7 +470,7 @@ namespace ngraph
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Tanh)
             {
-                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::tanh);
+                BUILD_UNARY_ELEMWISE_HALF_FUNCTOR(runtime::cpu::kernel::tanh);
             }
 
             template <>
@@ -495,19 +505,19 @@ namespace ngraph
             template <>
             NodeExecutorTy Builder::BUILDER_CF_DECL(ngraph::op::Add)
             {
-                BUILD_BINARY_ELEMWISE_CF_FUNCTOR(runtime::cpu::kernel::add);
+                BUILD_BINARY_ELEMWISE_HALF_CF_FUNCTOR(runtime::cpu::kernel::add);
             }
 
             template <>
             NodeExecutorTy Builder::BUILDER_CF_DECL(ngraph::op::Subtract)
             {
-                BUILD_BINARY_ELEMWISE_CF_FUNCTOR(runtime::cpu::kernel::subtract);
+                BUILD_BINARY_ELEMWISE_HALF_CF_FUNCTOR(runtime::cpu::kernel::subtract);
             }
 
             template <>
             NodeExecutorTy Builder::BUILDER_CF_DECL(ngraph::op::Multiply)
             {
-                BUILD_BINARY_ELEMWISE_CF_FUNCTOR(runtime::cpu::kernel::multiply);
+                BUILD_BINARY_ELEMWISE_HALF_CF_FUNCTOR(runtime::cpu::kernel::multiply);
             }
 
             template <>
@@ -521,7 +531,8 @@ namespace ngraph
             {
                 const ngraph::op::Divide* divop = static_cast<const ngraph::op::Divide*>(node);
                 std::function<void(void*, void*, void*, size_t, bool, int)> kernel;
-                SELECT_KERNEL(kernel, node->get_input_element_type(0), runtime::cpu::kernel::divide)
+                SELECT_KERNEL_HALF(
+                    kernel, node->get_input_element_type(0), runtime::cpu::kernel::divide)
                 auto element_count = shape_size(node->get_shape());
                 bool pythondiv = divop->is_pythondiv();
                 auto functor = [&, kernel, element_count, pythondiv](
@@ -534,37 +545,37 @@ namespace ngraph
             template <>
             NodeExecutorTy Builder::BUILDER_CF_DECL(ngraph::op::Minimum)
             {
-                BUILD_BINARY_ELEMWISE_CF_FUNCTOR(runtime::cpu::kernel::minimum);
+                BUILD_BINARY_ELEMWISE_HALF_CF_FUNCTOR(runtime::cpu::kernel::minimum);
             }
 
             template <>
             NodeExecutorTy Builder::BUILDER_CF_DECL(ngraph::op::Maximum)
             {
-                BUILD_BINARY_ELEMWISE_CF_FUNCTOR(runtime::cpu::kernel::maximum);
+                BUILD_BINARY_ELEMWISE_HALF_CF_FUNCTOR(runtime::cpu::kernel::maximum);
             }
 
             template <>
             NodeExecutorTy Builder::BUILDER_CF_DECL(ngraph::op::Abs)
             {
-                BUILD_UNARY_ELEMWISE_CF_FUNCTOR(runtime::cpu::kernel::abs);
+                BUILD_UNARY_ELEMWISE_HALF_CF_FUNCTOR(runtime::cpu::kernel::abs);
             }
 
             template <>
             NodeExecutorTy Builder::BUILDER_CF_DECL(ngraph::op::Negative)
             {
-                BUILD_UNARY_ELEMWISE_CF_FUNCTOR(runtime::cpu::kernel::negative);
+                BUILD_UNARY_ELEMWISE_HALF_CF_FUNCTOR(runtime::cpu::kernel::negative);
             }
 
             template <>
             NodeExecutorTy Builder::BUILDER_CF_DECL(ngraph::op::Relu)
             {
-                BUILD_UNARY_ELEMWISE_CF_FUNCTOR(runtime::cpu::kernel::relu);
+                BUILD_UNARY_ELEMWISE_HALF_CF_FUNCTOR(runtime::cpu::kernel::relu);
             }
 
             template <>
             NodeExecutorTy Builder::BUILDER_CF_DECL(ngraph::op::Sqrt)
             {
-                BUILD_UNARY_ELEMWISE_CF_FUNCTOR(runtime::cpu::kernel::checked_sqrt);
+                BUILD_UNARY_ELEMWISE_HALF_CF_FUNCTOR(runtime::cpu::kernel::checked_sqrt);
             }
 
             template <>
@@ -30,12 +30,21 @@
                    const std::vector<TensorWrapper>& args,                                         \
                    const std::vector<TensorWrapper>& out)
 
-#define BUILD_UNARY_ELEMWISE_FUNCTOR(OP)                                                           \
+#define BUILD_UNARY_ELEMWISE_FUNCTOR(OP) BUILD_UNARY_ELEMWISE_FUNCTOR_WITH(SELECT_KERNEL, OP)
+#define BUILD_BINARY_ELEMWISE_FUNCTOR(OP) BUILD_BINARY_ELEMWISE_FUNCTOR_WITH(SELECT_KERNEL, OP)
+
+// For kernels that also have f16 and bf16 specializations in kernel/half_precision.hpp
+#define BUILD_UNARY_ELEMWISE_HALF_FUNCTOR(OP)                                                      \
+    BUILD_UNARY_ELEMWISE_FUNCTOR_WITH(SELECT_KERNEL_HALF, OP)
+#define BUILD_BINARY_ELEMWISE_HALF_FUNCTOR(OP)                                                     \
+    BUILD_BINARY_ELEMWISE_FUNCTOR_WITH(SELECT_KERNEL_HALF, OP)
+
+#define BUILD_UNARY_ELEMWISE_FUNCTOR_WITH(SELECT, OP)                                              \
     (void)node;                                                                                    \
     auto& functors = external_function->get_functors();                                            \
     std::function<void(void*, void*, size_t, int)> kernel;                                         \
                                                                                                    \
-    SELECT_KERNEL(kernel, args[0].get_element_type(), OP);                                         \
+    SELECT(kernel, args[0].get_element_type(), OP);                                                \
                                                                                                    \
     auto element_count = out[0].get_size();                                                        \
     auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());              \
@@ -50,12 +59,12 @@
     };                                                                                             \
     functors.emplace_back(functor)
 
-#define BUILD_BINARY_ELEMWISE_FUNCTOR(OP)                                                          \
+#define BUILD_BINARY_ELEMWISE_FUNCTOR_WITH(SELECT, OP)                                             \
     (void)node;                                                                                    \
     auto& functors = external_function->get_functors();                                            \
     std::function<void(void*, void*, void*, size_t, int)> kernel;                                  \
                                                                                                    \
-    SELECT_KERNEL(kernel, args[0].get_element_type(), OP);                                         \
+    SELECT(kernel, args[0].get_element_type(), OP);                                                \
                                                                                                    \
     auto element_count = out[0].get_size();                                                        \
     auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());              \
@@ -73,10 +82,18 @@
         };                                                                                         \
     functors.emplace_back(functor)
 
-#define BUILD_UNARY_ELEMWISE_CF_FUNCTOR(OP)                                                        \
+#define BUILD_UNARY_ELEMWISE_CF_FUNCTOR(OP) BUILD_UNARY_ELEMWISE_CF_FUNCTOR_WITH(SELECT_KERNEL, OP)
+#define BUILD_BINARY_ELEMWISE_CF_FUNCTOR(OP)                                                       \
+    BUILD_BINARY_ELEMWISE_CF_FUNCTOR_WITH(SELECT_KERNEL, OP)
+#define BUILD_UNARY_ELEMWISE_HALF_CF_FUNCTOR(OP)                                                   \
+    BUILD_UNARY_ELEMWISE_CF_FUNCTOR_WITH(SELECT_KERNEL_HALF, OP)
+#define BUILD_BINARY_ELEMWISE_HALF_CF_FUNCTOR(OP)                                                  \
+    BUILD_BINARY_ELEMWISE_CF_FUNCTOR_WITH(SELECT_KERNEL_HALF, OP)
+
+#define BUILD_UNARY_ELEMWISE_CF_FUNCTOR_WITH(SELECT, OP)                                           \
     std::function<void(void*, void*, size_t, int)> kernel;                                         \
                                                                                                    \
-    SELECT_KERNEL(kernel, node->get_input_element_type(0), OP);                                    \
+    SELECT(kernel, node->get_input_element_type(0), OP);                                           \
                                                                                                    \
     auto element_count = shape_size(node->get_shape());                                            \
                                                                                                    \
@@ -86,10 +103,10 @@
     };                                                                                             \
     return functor
 
-#define BUILD_BINARY_ELEMWISE_CF_FUNCTOR(OP)                                                       \
+#define BUILD_BINARY_ELEMWISE_CF_FUNCTOR_WITH(SELECT, OP)                                          \
     std::function<void(void*, void*, void*, size_t, int)> kernel;                                  \
                                                                                                    \
-    SELECT_KERNEL(kernel, node->get_input_element_type(0), OP);                                    \
+    SELECT(kernel, node->get_input_element_type(0), OP);                                           \
                                                                                                    \
     auto element_count = shape_size(node->get_shape());                                            \
                                                                                                    \
@@ -41,6 +41,7 @@ namespace ngraph
                 register_builders_dropout_cpp();
                 register_builders_embedding_lookup_cpp();
                 register_builders_erf_cpp();
+                register_builders_fused_elementwise_cpp();
                 register_builders_gather_cpp();
                 register_builders_gather_nd_cpp();
                 register_builders_gelu_cpp();
@@ -75,6 +76,7 @@ namespace ngraph
                 register_builders_slice_cpp();
                 register_builders_softmax_cpp();
                 register_builders_sum_cpp();
+                register_builders_tensor_iterator_cpp();
                 register_builders_tile_cpp();
                 register_builders_topk_cpp();
                 register_builders_update_slice_cpp();
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <new>
 #include <thread>
 
 #include "ngraph/env_util.hpp"
@@ -28,6 +29,24 @@
 using namespace std;
 using namespace ngraph;
 
+// States of the runtime context slots
+static const int s_ctx_not_created = 0;
+static const int s_ctx_free = 1;
+static const int s_ctx_busy = 2;
+
+// Attempts to claim a context before a caller blocks while all of them are busy
+static const size_t s_ctx_spins = 256;
+
+// Identifies the calling thread for the staleness hints, unlike a thread id it is never reused
+static uint64_t get_thread_token()
+{
+    static atomic<uint64_t> s_next_token{1};
+    static thread_local uint64_t token = s_next_token++;
+    return token;
+}
+
+constexpr size_t runtime::cpu::CPU_CallFrame::s_ctx_slot_size;
+
 runtime::cpu::CPU_CallFrame::CPU_CallFrame(std::shared_ptr<CPU_ExternalFunction> external_function,
                                            InitContextFuncCG compiled_init_ctx_func,
                                            DestroyContextFuncCG compiled_destroy_ctx_func,
@@ -120,44 +139,114 @@ void runtime::cpu::CPU_CallFrame::call(
     const std::vector<std::shared_ptr<runtime::Tensor>>& output_tvs,
     const std::vector<std::shared_ptr<runtime::Tensor>>& input_tvs)
 {
-    size_t id = 0;
-    auto disable_caching = false;
+    size_t id = acquire_runtime_context();
+    // Disable caching since staleness hints are no longer
+    // applicable to this context. The slot belongs to this call until it is released, so
+    // last_user needs no atomics.
+    auto& slot = get_ctx_slot(id);
+    auto thread_token = get_thread_token();
+    auto disable_caching = slot.last_user != thread_token;
+    slot.last_user = thread_token;
+
+    try
+    {
+        m_ctx_vec[id]->pc = 0;
+        propagate_layouts(output_tvs, m_external_function->get_result_layout_descriptors());
+        inner_call(output_tvs, input_tvs, id, disable_caching);
+    }
+    catch (...)
+    {
+        release_runtime_context(id);
+        throw;
+    }
+    release_runtime_context(id);
+}
+
+bool runtime::cpu::CPU_CallFrame::try_acquire_runtime_context(size_t id, int state)
+{
+    // Plain load first so that busy slots are skipped without a locked instruction
+    auto& slot_state = get_ctx_slot(id).state;
+    return slot_state.load(memory_order_relaxed) == state &&
+           slot_state.compare_exchange_strong(state, s_ctx_busy, memory_order_acquire);
+}
+
+size_t runtime::cpu::CPU_CallFrame::acquire_runtime_context()
+{
+    // A thread comes back to the context it used last, whose buffers it has already touched
+    static thread_local const CPU_CallFrame* last_call_frame = nullptr;
+    static thread_local size_t last_id = 0;
+    if (last_call_frame == this && last_id < m_num_ctx &&
+        try_acquire_runtime_context(last_id, s_ctx_free))
+    {
+        return last_id;
+    }
+
+    size_t idle_spins = 0;
+    while (true)
     {
-        std::unique_lock<std::mutex> lck(m_mutex);
-        while (m_num_ctx_available == 0)
+        for (size_t id = 0; id < m_num_ctx; id++)
         {
-            m_cv.wait(lck);
+            if (try_acquire_runtime_context(id, s_ctx_free))
+            {
+                last_call_frame = this;
+                last_id = id;
+                return id;
+            }
         }
-
-        for (size_t i = 0; i < m_num_ctx; i++)
+        // Only grow the pool when every existing context is busy
+        for (size_t id = 0; id < m_num_ctx; id++)
         {
-            if (m_id_pool[i])
+            if (try_acquire_runtime_context(id, s_ctx_not_created))
             {
-                id = i;
-                break;
+                try
+                {
+                    m_ctx_vec[id] = create_runtime_context();
+                }
+                catch (...)
+                {
+                    get_ctx_slot(id).state.store(s_ctx_not_created, memory_order_release);
+                    throw;
+                }
+                m_num_ctx_created++;
+                last_call_frame = this;
+                last_id = id;
+                return id;
             }
         }
-        NGRAPH_CHECK(id != m_num_ctx);
-        m_id_pool[id] = false;
-        if (id != m_prev_ctx)
+        // The pool is at its limit, wait for a call to finish. Calls are usually short, so
+        // spin for a while before sleeping until a context is released.
+        if (++idle_spins < s_ctx_spins)
+        {
+            this_thread::yield();
+            continue;
+        }
+        idle_spins = 0;
+        unique_lock<mutex> lock(m_ctx_mutex);
+        // Registered before the slots are checked again, release_runtime_context checks for
+        // waiters after freeing its slot, so one of the two sees the other
+        m_num_ctx_waiters++;
+        bool any_free = false;
+        for (size_t id = 0; id < m_num_ctx && !any_free; id++)
+        {
+            any_free = get_ctx_slot(id).state.load() != s_ctx_busy;
+        }
+        if (!any_free)
         {
-            // Disable caching since staleness hints are no longer
-            // applicable to this context
-            disable_caching = true;
+            m_ctx_available.wait(lock);
         }
-        m_prev_ctx = id;
-        m_num_ctx_available--;
+        m_num_ctx_waiters--;
     }
+}
 
-    m_ctx_vec[id]->pc = 0;
-    propagate_layouts(output_tvs, m_external_function->get_result_layout_descriptors());
-    inner_call(output_tvs, input_tvs, id, disable_caching);
-
-    m_mutex.lock();
-    m_id_pool[id] = true;
-    m_num_ctx_available++;
-    m_mutex.unlock();
-    m_cv.notify_one();
+void runtime::cpu::CPU_CallFrame::release_runtime_context(size_t id)
+{
+    get_ctx_slot(id).state.store(s_ctx_free);
+    if (m_num_ctx_waiters.load() != 0)
+    {
+        // Taking the lock orders the notification after the waiter started waiting
+        lock_guard<mutex> lock(m_ctx_mutex);
+        m_ctx_available.notify_one();
+    }
 }
 
 void runtime::cpu::CPU_CallFrame::propagate_layouts(
@@ -182,126 +271,144 @@ void runtime::cpu::CPU_CallFrame::propagate_layouts(
 
 void runtime::cpu::CPU_CallFrame::setup_runtime_context(Allocator* allocator)
 {
+    m_allocator = allocator;
+    m_ctx_vec.assign(m_num_ctx, nullptr);
+    m_ctx_slots = AlignedBuffer(m_num_ctx * s_ctx_slot_size, s_ctx_slot_size);
     for (size_t i = 0; i < m_num_ctx; i++)
     {
-        m_id_pool[i] = true;
-        auto ctx = new CPURuntimeContext;
-        m_ctx_vec.push_back(ctx);
+        auto slot = new (m_ctx_slots.get_ptr(i * s_ctx_slot_size)) ContextSlot;
+        slot->state.store(s_ctx_not_created, memory_order_relaxed);
+        slot->last_user = 0;
+    }
 
-        ctx->pc = 0;
-        ctx->op_durations = nullptr;
-        if (runtime::cpu::IsTracingEnabled())
-        {
-            ctx->op_durations = new int64_t[m_external_function->get_op_attrs().size()];
-        }
-        ctx->p_en = new bool[m_external_function->get_parameter_layout_descriptors().size()];
+    // The first context always exists, the debugger inspects it
+    m_ctx_vec[0] = create_runtime_context();
+    get_ctx_slot(0).state.store(s_ctx_free, memory_order_release);
+    m_num_ctx_created = 1;
+}
 
-        ctx->first_iteration = true;
+runtime::cpu::CPURuntimeContext* runtime::cpu::CPU_CallFrame::create_runtime_context()
+{
+    auto ctx = new CPURuntimeContext;
+
+    ctx->pc = 0;
+    ctx->op_durations = nullptr;
+    if (runtime::cpu::IsTracingEnabled())
+    {
+        ctx->op_durations = new int64_t[m_external_function->get_op_attrs().size()];
+    }
+    ctx->p_en = new bool[m_external_function->get_parameter_layout_descriptors().size()];
+
+    ctx->first_iteration = true;
 
-        ctx->buffer_data = std::vector<void*>(m_external_function->get_buffer_size());
+    ctx->buffer_data = std::vector<void*>(m_external_function->get_buffer_size());
 
-        // Create temporary buffer pools
-        size_t alignment = runtime::cpu::CPU_ExternalFunction::s_memory_pool_alignment;
-        for (auto buffer_size : m_external_function->get_memory_buffer_sizes())
+    // Create temporary buffer pools
+    size_t alignment = runtime::cpu::CPU_ExternalFunction::s_memory_pool_alignment;
+    for (auto buffer_size : m_external_function->get_memory_buffer_sizes())
+    {
+        auto buffer = new AlignedBuffer(buffer_size, alignment, m_allocator);
+        ctx->memory_buffers.push_back(buffer);
+    }
+    const auto& mkldnn_emitter = m_external_function->get_mkldnn_emitter();
+    // Create scratchpad
+    auto scratchpad_size = mkldnn_emitter->get_max_scratchpad_size();
+    if (m_external_function->is_direct_execution())
+    {
+        ctx->mkldnn_primitives =
+            std::vector<mkldnn::primitive*>(mkldnn_emitter->get_mkldnn_primitives().size());
+        ctx->mkldnn_memories =
+            std::vector<mkldnn::memory*>(mkldnn_emitter->get_mkldnn_memories().size());
+        ctx->mkldnn_scratchpad_mds = std::vector<mkldnn::memory::desc*>(
+            mkldnn_emitter->get_mkldnn_scratchpad_mds().size());
+        if (scratchpad_size > 0)
         {
-            auto buffer = new AlignedBuffer(buffer_size, alignment, allocator);
-            ctx->memory_buffers.push_back(buffer);
-        }
-        const auto& mkldnn_emitter = m_external_function->get_mkldnn_emitter();
-        // Create scratchpad
-        auto scratchpad_size = mkldnn_emitter->get_max_scratchpad_size();
-        if (m_external_function->is_direct_execution())
-        {
-            ctx->mkldnn_primitives =
-                std::vector<mkldnn::primitive*>(mkldnn_emitter->get_mkldnn_primitives().size());
-            ctx->mkldnn_memories =
-                std::vector<mkldnn::memory*>(mkldnn_emitter->get_mkldnn_memories().size());
-            ctx->mkldnn_scratchpad_mds = std::vector<mkldnn::memory::desc*>(
-                mkldnn_emitter->get_mkldnn_scratchpad_mds().size());
-            if (scratchpad_size > 0)
-            {
-                ctx->scratchpad_buffer = new AlignedBuffer(scratchpad_size, alignment, allocator);
-            }
-            else
-            {
-                ctx->scratchpad_buffer = nullptr;
-            }
+            ctx->scratchpad_buffer = new AlignedBuffer(scratchpad_size, alignment, m_allocator);
         }
         else
         {
-            // single thread for codegen
-            NGRAPH_CHECK(m_num_ctx == 1);
+            ctx->scratchpad_buffer = nullptr;
         }
+    }
+    else
+    {
+        // single thread for codegen
+        NGRAPH_CHECK(m_num_ctx == 1);
+    }
 
-        ctx->states = m_external_function->m_states.data();
+    ctx->states = m_external_function->m_states.data();
 #if defined(NGRAPH_TBB_ENABLE)
-        if (m_external_function->is_direct_execution() && getenv_bool("NGRAPH_CPU_USE_TBB"))
-        {
-            // For codegen mode, graph and global control are now part of the code generated
-            // CPURuntimeContextCG class.
-            ctx->G = new tbb::flow::graph;
-            const auto envParallelism = getenv_int("NGRAPH_INTER_OP_PARALLELISM");
-            const auto parallelism = envParallelism <= 0 ? 1 : envParallelism;
-            ctx->c =
-                new tbb::global_control(tbb::global_control::max_allowed_parallelism, parallelism);
-        }
-#endif
+    if (m_external_function->is_direct_execution() && getenv_bool("NGRAPH_CPU_USE_TBB"))
+    {
+        // For codegen mode, graph and global control are now part of the code generated
+        // CPURuntimeContextCG class.
+        ctx->G = new tbb::flow::graph;
+        const auto envParallelism = getenv_int("NGRAPH_INTER_OP_PARALLELISM");
+        const auto parallelism = envParallelism <= 0 ? 1 : envParallelism;
+        ctx->c = new tbb::global_control(tbb::global_control::max_allowed_parallelism, parallelism);
     }
-    m_num_ctx_available = m_num_ctx;
+#endif
+    return ctx;
 }
 
 void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
 {
-    for (size_t i = 0; i < m_num_ctx; i++)
+    for (auto ctx : m_ctx_vec)
     {
-        auto ctx = m_ctx_vec.back();
-        m_ctx_vec.pop_back();
-
-        delete[] ctx->op_durations;
-        delete[] ctx->p_en;
-        for (auto p : ctx->mkldnn_primitives)
-        {
-            delete p;
-        }
-        for (auto m : ctx->mkldnn_memories)
-        {
-            delete m;
-        }
-        for (auto buffer : ctx->memory_buffers)
+        if (ctx != nullptr)
         {
-            delete buffer;
-        }
-        for (auto s : ctx->mkldnn_scratchpad_mds)
-        {
-            delete s;
-        }
-        if (m_external_function->is_direct_execution())
-        {
-            delete ctx->scratchpad_buffer;
+            destroy_runtime_context(ctx);
         }
+    }
+    m_ctx_vec.clear();
+    m_num_ctx_created = 0;
+}
+
+void runtime::cpu::CPU_CallFrame::destroy_runtime_context(CPURuntimeContext* ctx)
+{
+    delete[] ctx->op_durations;
+    delete[] ctx->p_en;
+    for (auto p : ctx->mkldnn_primitives)
+    {
+        delete p;
+    }
+    for (auto m : ctx->mkldnn_memories)
+    {
+        delete m;
+    }
+    for (auto buffer : ctx->memory_buffers)
+    {
+        delete buffer;
+    }
+    for (auto s : ctx->mkldnn_scratchpad_mds)
+    {
+        delete s;
+    }
+    if (m_external_function->is_direct_execution())
+    {
+        delete ctx->scratchpad_buffer;
+    }
 
 #if defined(NGRAPH_TBB_ENABLE)
-        if (m_external_function->is_direct_execution() && getenv_bool("NGRAPH_CPU_USE_TBB"))
-        {
-            // For codegen mode, graph and global control are now part of a code generated
-            // CPURuntimeContext class.
+    if (m_external_function->is_direct_execution() && getenv_bool("NGRAPH_CPU_USE_TBB"))
+    {
+        // For codegen mode, graph and global control are now part of a code generated
+        // CPURuntimeContext class.
 
-            // delete graph G and nodes in G
-            ctx->G->wait_for_all();
-            std::vector<tbb::flow::graph_node*> to_be_deleted;
-            for (auto it = ctx->G->begin(); it != ctx->G->end(); it++)
-            {
-                to_be_deleted.push_back(&(*it));
-            }
-            delete ctx->G;
-            for (auto node : to_be_deleted)
-            {
-                delete node;
-            }
-            delete ctx->c;
+        // delete graph G and nodes in G
+        ctx->G->wait_for_all();
+        std::vector<tbb::flow::graph_node*> to_be_deleted;
+        for (auto it = ctx->G->begin(); it != ctx->G->end(); it++)
+        {
+            to_be_deleted.push_back(&(*it));
         }
-#endif
-        delete ctx;
+        delete ctx->G;
+        for (auto node : to_be_deleted)
+        {
+            delete node;
+        }
+        delete ctx->c;
     }
-    m_num_ctx_available = 0;
+#endif
+    delete ctx;
 }
@@ -16,7 +16,9 @@
 
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -24,6 +26,7 @@
 #include <vector>
 
 #include "ngraph/function.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/allocator.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_runtime_context.hpp"
@@ -77,6 +80,10 @@ namespace ngraph
                 void setup_cg_runtime_context();
                 void cleanup_runtime_context();
 
+                /// \brief Number of runtime contexts created so far. Contexts are created on
+                ///        demand, up to NGRAPH_CPU_CONCURRENCY.
+                size_t get_num_runtime_contexts() const { return m_num_ctx_created; }
+
             protected:
                 CPU_CallFrame(const CPU_CallFrame&) = delete;
                 CPU_CallFrame(CPU_CallFrame&&) = delete;
@@ -87,15 +94,46 @@ namespace ngraph
                                 const size_t id,
                                 const bool disable_caching = true);
 
+                CPURuntimeContext* create_runtime_context();
+                void destroy_runtime_context(CPURuntimeContext* ctx);
+                size_t acquire_runtime_context();
+                bool try_acquire_runtime_context(size_t id, int state);
+                void release_runtime_context(size_t id);
+
                 std::shared_ptr<CPU_ExternalFunction> m_external_function;
 
-                std::mutex m_mutex;
-                std::condition_variable m_cv;
-                volatile size_t m_num_ctx_available = 0;
-                size_t m_prev_ctx = 0;
+                // Each slot sits on its own cache line so that claiming one context does not
+                // invalidate the line of another
+                struct ContextSlot
+                {
+                    // Whether the context is not created yet, free or in use
+                    std::atomic<int> state;
+                    // Thread that made the last call on the context, staleness hints of its
+                    // tensors only hold for that thread
+                    uint64_t last_user;
+                };
+                static constexpr size_t s_ctx_slot_size = 64;
+                static_assert(sizeof(ContextSlot) <= s_ctx_slot_size,
+                              "a context slot must fit in one cache line");
+
+                ContextSlot& get_ctx_slot(size_t id)
+                {
+                    return *static_cast<ContextSlot*>(m_ctx_slots.get_ptr(id * s_ctx_slot_size));
+                }
+
+                // Lock-free pool of runtime contexts, a context is claimed with a
+                // compare-and-swap on its slot state. Contexts beyond the first are created by
+                // the first thread that finds all others busy, so their buffers are first
+                // touched on, and stay local to, that thread's NUMA node. Callers only block on
+                // m_ctx_available after spinning for a while with every context busy.
+                AlignedBuffer m_ctx_slots;
+                std::atomic<size_t> m_num_ctx_created{0};
+                std::atomic<size_t> m_num_ctx_waiters{0};
+                std::mutex m_ctx_mutex;
+                std::condition_variable m_ctx_available;
                 size_t m_num_ctx = 1;
-                std::unordered_map<size_t, bool> m_id_pool;
                 std::vector<CPURuntimeContext*> m_ctx_vec;
+                runtime::Allocator* m_allocator = nullptr;
 
                 // Codegen specific
 
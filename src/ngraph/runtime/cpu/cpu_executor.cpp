@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <thread>
 
 #include "cpu_executor.hpp"
@@ -142,6 +143,19 @@ namespace ngraph
                 }
 #endif
 
+                CPUInterOpScheduler& CPUExecutor::get_inter_op_scheduler(int num_workers)
+                {
+                    // Workers share the arenas round robin
+                    num_workers = std::max(m_num_thread_pools, num_workers);
+                    std::lock_guard<std::mutex> lock(m_inter_op_schedulers_mutex);
+                    auto& scheduler = m_inter_op_schedulers[num_workers];
+                    if (!scheduler)
+                    {
+                        scheduler.reset(new CPUInterOpScheduler(num_workers));
+                    }
+                    return *scheduler;
+                }
+
                 CPUExecutor& GetCPUExecutor()
                 {
                     static int num_thread_pools = GetNumThreadPools();
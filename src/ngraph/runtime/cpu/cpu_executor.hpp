@@ -17,10 +17,15 @@
 #pragma once
 
 #include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <thread>
 
 #include <mkldnn.hpp>
 
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+#include "ngraph/runtime/cpu/cpu_inter_op_scheduler.hpp"
 #include "ngraph/runtime/cpu/cpu_runtime_context.hpp"
 
 #define EIGEN_USE_THREADS
@@ -41,7 +46,7 @@ namespace ngraph
                 extern mkldnn::engine global_cpu_engine;
 
                 // CPUExecutor owns the resources for executing a graph.
-                class CPUExecutor
+                class CPU_BACKEND_API CPUExecutor
                 {
                 public:
                     explicit CPUExecutor(int num_thread_pools);
@@ -63,17 +68,24 @@ namespace ngraph
 #endif
                     int get_num_thread_pools() { return m_num_thread_pools; }
                     int get_num_cores() { return m_num_cores; }
+                    // Inter-op scheduler with num_workers workers, at least one per thread pool.
+                    // One scheduler is created per width the first time it is requested and
+                    // lives as long as the executor.
+                    CPUInterOpScheduler& get_inter_op_scheduler(int num_workers);
+
                 private:
                     std::vector<std::unique_ptr<Eigen::ThreadPool>> m_thread_pools;
                     std::vector<std::unique_ptr<Eigen::ThreadPoolDevice>> m_thread_pool_devices;
 #if defined(NGRAPH_TBB_ENABLE)
                     std::vector<tbb::task_arena> m_tbb_arenas;
 #endif
+                    std::map<int, std::unique_ptr<CPUInterOpScheduler>> m_inter_op_schedulers;
+                    std::mutex m_inter_op_schedulers_mutex;
                     int m_num_thread_pools;
                     int m_num_cores;
                 };
 
-                extern CPUExecutor& GetCPUExecutor();
+                extern CPU_BACKEND_API CPUExecutor& GetCPUExecutor();
             }
         }
     }
@@ -16,7 +16,9 @@
 
 #include <cstdlib>
 #include <fstream>
+#include <limits>
 #include <memory>
+#include <set>
 #include <string>
 #include <tuple>
 #include <typeindex>
@@ -197,7 +199,9 @@
 #include "ngraph/runtime/cpu/op/update_slice.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_assignment.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_collapse_dims.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_elementwise_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_half_precision_lowering.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_horizontal_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_layout.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_mat_fusion.hpp"
@@ -247,6 +251,7 @@ runtime::cpu::CPU_ExternalFunction::CPU_ExternalFunction(
 #if defined(NGRAPH_TBB_ENABLE)
     , m_use_tbb(getenv_bool("NGRAPH_CPU_USE_TBB"))
 #endif
+    , m_use_inter_op_scheduler(getenv_bool("NGRAPH_CPU_USE_INTER_OP_SCHEDULER"))
 #if !defined(NGRAPH_DEX_ONLY)
     , m_is_compiled(false)
     , m_direct_execution(!getenv_bool("NGRAPH_CODEGEN"))
@@ -651,17 +656,21 @@ using namespace ngraph::runtime;
         writer << "\n";
     }
 
+    // Constant data is bound through set_constants after the module is loaded. The generated
+    // source holds no addresses, so the same graph always compiles to the same source and the
+    // compiler cache can reuse its bitcode across processes.
     writer << "// Declare all constants\n";
+    CodeWriter constant_writer;
     for (shared_ptr<Node> node : ordered_ops)
     {
-        ngraph::op::Constant* c = as_type<ngraph::op::Constant>(node.get());
-        if (c)
+        if (is_type<ngraph::op::Constant>(node))
         {
-            m_active_constants.push_back(node);
             shared_ptr<descriptor::Tensor> tv = node->get_outputs()[0].get_tensor_ptr();
             string type = tv->get_element_type().c_type_string();
-            writer << "static " << type << "* " << tv->get_name() << " = ((" << type << "*)("
-                   << c->get_data_ptr() << "));\n";
+            writer << "static " << type << "* " << tv->get_name() << ";\n";
+            constant_writer << tv->get_name() << " = static_cast<" << type << "*>(constants["
+                            << m_active_constants.size() << "]);\n";
+            m_active_constants.push_back(node);
 
             auto output_tensor = &node->get_output_tensor();
             auto tensor_set = get_tensor_set(output_tensor);
@@ -674,6 +683,11 @@ using namespace ngraph::runtime;
             }
         }
     }
+    writer << "extern \"C\" void set_constants(void** constants)\n";
+    writer.block_begin();
+    writer << constant_writer.get_code();
+    writer.block_end();
+    writer << "\n";
 
     generate_class_declarations(writer);
 
@@ -732,7 +746,7 @@ using namespace ngraph::runtime;
     bool temporaries_used = false;
     for (shared_ptr<Node> node : ordered_ops)
     {
-        if (node->liveness_new_list.size() > 0)
+        if (node->get_liveness_new_list().size() > 0)
         {
             temporaries_used = true;
         }
@@ -1128,6 +1142,19 @@ using namespace ngraph::runtime;
         throw runtime_error("could not find compiled destroy context function");
     }
 
+    auto set_constants = m_execution_engine->find_function<void(void**)>("set_constants");
+    if (set_constants == nullptr)
+    {
+        throw runtime_error("could not find compiled set constants function");
+    }
+    vector<void*> constant_data;
+    for (auto& node : m_active_constants)
+    {
+        constant_data.push_back(
+            const_cast<void*>(static_pointer_cast<ngraph::op::Constant>(node)->get_data_ptr()));
+    }
+    set_constants(constant_data.data());
+
     m_compiled_function = m_execution_engine->find_function<EntryPointTy>(m_function_name);
 
     if (m_compiled_function == nullptr)
@@ -1277,6 +1304,7 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
     REGISTER_KNOBBED_PASS_WITH_ARGS(FusedOpDecomposition, true, ngraph::pass, is_supported)
     REGISTER_KNOBBED_PASS(Opset0Downgrade, true, ngraph::pass)
     REGISTER_KNOBBED_PASS(ImplicitBroadcastElimination, true, ngraph::pass)
+    REGISTER_KNOBBED_PASS(CPUHalfPrecisionLowering, true, runtime::cpu::pass)
     REGISTER_KNOBBED_PASS(NopElimination, true, ngraph::pass)
     REGISTER_KNOBBED_PASS(ZeroDimTensorElimination, true, ngraph::pass)
     REGISTER_KNOBBED_PASS(VanillaRNNFusion, true, runtime::cpu::pass)
@@ -1303,6 +1331,8 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
     REGISTER_KNOBBED_PASS(CPUQuantFusion, true, runtime::cpu::pass)
     REGISTER_KNOBBED_PASS(CPUHorizontalFusion, true, runtime::cpu::pass)
     REGISTER_KNOBBED_PASS(CPUCollapseDims, true, runtime::cpu::pass)
+    // Lowers the ops the passes above created around ops with half precision kernels
+    REGISTER_KNOBBED_PASS(CPUHalfPrecisionLowering, true, runtime::cpu::pass)
 
 #ifdef NGRAPH_MLIR_ENABLE
     if (getenv_bool("NGRAPH_MLIR"))
@@ -1315,6 +1345,12 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
     REGISTER_KNOBBED_PASS_WITH_ARGS(CPUWorkspaceInsertion, true, runtime::cpu::pass, nv_cwi, false)
     REGISTER_KNOBBED_PASS_WITH_ARGS(CPUAssignment, true, runtime::cpu::pass, this)
     REGISTER_KNOBBED_PASS_WITH_ARGS(ConstantFolding, true, ngraph::pass, GetGlobalCFDispatcherCPU())
+    // Runs before CPULayout so that inputs of the fused loops get native layouts. Codegen has no
+    // emitter for the fused op.
+    if (m_direct_execution)
+    {
+        REGISTER_KNOBBED_PASS(CPUElementwiseFusion, true, runtime::cpu::pass)
+    }
     REGISTER_KNOBBED_PASS_WITH_ARGS(CPULayout, true, runtime::cpu::pass, this)
     REGISTER_KNOBBED_PASS_WITH_ARGS(
         CommonSubexpressionElimination, true, ngraph::pass, runtime::cpu::get_cse_handlers_map())
@@ -1601,6 +1637,26 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
     // After processing inputs, outputs, constants, and intermediates, set the buffer size.
     m_buffer_size = buffer_index;
 
+    // With memory reuse enabled, buffers of unrelated tensors overlap based on the sequential
+    // liveness order, which the inter-op scheduler cannot see. Fall back to sequential execution.
+    if (m_use_inter_op_scheduler &&
+        (pass_config.get_pass_attribute("CPUMemoryAssignment::ReuseMemory") ||
+         pass_config.get_pass_attribute("ReuseMemory")))
+    {
+        NGRAPH_WARN << "CPU Backend: inter-op scheduler is disabled when memory reuse is enabled";
+        m_use_inter_op_scheduler = false;
+    }
+    if (m_use_inter_op_scheduler)
+    {
+        m_inter_op_scheduler = &executor::GetCPUExecutor().get_inter_op_scheduler(
+            getenv_int("NGRAPH_INTER_OP_PARALLELISM"));
+    }
+    // Buffer-set hazard tracking used to build the inter-op dependency graph
+    unordered_map<Node*, size_t> functor_indices;
+    unordered_map<size_t, size_t> buffer_last_writer;
+    unordered_map<size_t, vector<size_t>> buffer_readers;
+    const size_t scratchpad_buffer_id = numeric_limits<size_t>::max();
+
     for (shared_ptr<Node> node : m_function->get_ordered_ops())
     {
         if (node->is_parameter() || node->is_constant())
@@ -1641,8 +1697,91 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
 
         m_op_attrs.emplace_back(node->description(), out_names, in_names, t_out_attrs, t_in_attrs);
         op_names.push_back(node->get_name());
+        auto scratchpad_users = m_mkldnn_emitter->get_num_scratchpad_users();
         handler->second(this, node.get(), in, out);
 
+        if (m_use_inter_op_scheduler)
+        {
+            auto functor_index = m_op_successors.size();
+            functor_indices[node.get()] = functor_index;
+            m_op_successors.emplace_back();
+            m_op_num_predecessors.push_back(0);
+
+            set<size_t> predecessors;
+            for (auto& dependency : node->get_control_dependencies())
+            {
+                auto it = functor_indices.find(dependency.get());
+                if (it != functor_indices.end())
+                {
+                    predecessors.insert(it->second);
+                }
+            }
+
+            set<size_t> read_buffers;
+            for (const descriptor::Input& input : node->get_inputs())
+            {
+                read_buffers.insert(tensor_to_bufferID.at(&input.get_output().get_tensor()));
+            }
+            set<size_t> written_buffers;
+            for (const descriptor::Output& output : node->get_outputs())
+            {
+                written_buffers.insert(tensor_to_bufferID.at(&output.get_tensor()));
+            }
+            // A destructive in-place op keeps a buffer set of its own for the output but writes
+            // into the memory of its input
+            if (node->is_op())
+            {
+                auto op = std::static_pointer_cast<ngraph::op::Op>(node);
+                if (auto op_annotations = op->get_op_annotations())
+                {
+                    for (auto& oi_pair : op_annotations->get_in_place_oi_pairs())
+                    {
+                        if (oi_pair.destructive)
+                        {
+                            written_buffers.insert(tensor_to_bufferID.at(
+                                &node->input_value(oi_pair.input).get_tensor()));
+                        }
+                    }
+                }
+            }
+
+            // MKLDNN primitives all bind the single scratchpad buffer of the context, so ops
+            // that use it are ordered as if they wrote a buffer of their own
+            if (m_mkldnn_emitter->get_num_scratchpad_users() != scratchpad_users)
+            {
+                written_buffers.insert(scratchpad_buffer_id);
+            }
+
+            for (auto buffer : read_buffers)
+            {
+                auto writer = buffer_last_writer.find(buffer);
+                if (writer != buffer_last_writer.end())
+                {
+                    predecessors.insert(writer->second);
+                }
+                buffer_readers[buffer].push_back(functor_index);
+            }
+            for (auto buffer : written_buffers)
+            {
+                auto writer = buffer_last_writer.find(buffer);
+                if (writer != buffer_last_writer.end())
+                {
+                    predecessors.insert(writer->second);
+                }
+                auto& readers = buffer_readers[buffer];
+                predecessors.insert(readers.begin(), readers.end());
+                readers.clear();
+                buffer_last_writer[buffer] = functor_index;
+            }
+
+            predecessors.erase(functor_index);
+            for (auto predecessor : predecessors)
+            {
+                m_op_successors[predecessor].push_back(functor_index);
+            }
+            m_op_num_predecessors[functor_index] = predecessors.size();
+        }
+
         auto cacheable = true;
         auto reuse_memory = pass_config.get_pass_attribute("CPUMemoryAssignment::ReuseMemory") ||
                             pass_config.get_pass_attribute("ReuseMemory");
@@ -1922,6 +2061,62 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
         }
         else
 #endif
+            // Breakpoints and the debug tracer rely on ctx->pc walking the functors in order
+            if (m_use_inter_op_scheduler && ctx->breakpoints.empty() &&
+                !debug_tracer.tracing_is_enabled())
+        {
+            auto& cpu_executor = executor::GetCPUExecutor();
+            auto num_arenas = cpu_executor.get_num_thread_pools();
+            m_inter_op_scheduler->run(
+                m_op_successors,
+                m_op_num_predecessors,
+                [&](size_t index, int worker) {
+                    if ((enables.at(index))(ctx) || ctx->first_iteration)
+                    {
+                        cpu::Timestamp op_start_ts, op_end_ts;
+                        if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
+                        {
+                            op_start_ts = cpu::Clock::now();
+                        }
+
+                        // Each worker drives the intra-op thread pool of its own arena
+                        CPUExecutionContext ectx{worker % num_arenas};
+                        cpu_executor.execute(functors.at(index), ctx, &ectx);
+
+                        if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
+                        {
+                            op_end_ts = cpu::Clock::now();
+                            auto duration =
+                                std::chrono::duration_cast<cpu::Timescale>(op_end_ts -
+                                                                           op_start_ts)
+                                    .count();
+                            if (runtime::cpu::IsTracingEnabled())
+                            {
+                                ctx->op_durations[index] = duration;
+                            }
+                            if (m_emit_timing)
+                            {
+                                m_perf_counters[index].m_total_microseconds += duration;
+                                m_perf_counters[index].m_call_count++;
+                            }
+                        }
+                    }
+                    else
+                    {
+                        if (runtime::cpu::IsTracingEnabled())
+                        {
+                            ctx->op_durations[index] = 0;
+                        }
+                        if (m_emit_timing)
+                        {
+                            m_perf_counters[index].m_call_count++;
+                        }
+                    }
+                });
+            ctx->pc = functors.size();
+            profiler_count = functors.size();
+        }
+        else
         {
             static const auto ddebug = getenv_bool("NGRAPH_DEX_DEBUG");
             if (ddebug)
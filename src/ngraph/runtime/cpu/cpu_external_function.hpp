@@ -41,6 +41,7 @@
 #include "ngraph/pass/pass_config.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
 #include "ngraph/runtime/cpu/cpu_debug_tracer.hpp"
+#include "ngraph/runtime/cpu/cpu_inter_op_scheduler.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_wrapper.hpp"
 #include "ngraph/runtime/cpu/mkldnn_emitter.hpp"
@@ -245,6 +246,7 @@ namespace ngraph
 #if defined(NGRAPH_TBB_ENABLE)
                 bool m_use_tbb;
 #endif
+                bool m_use_inter_op_scheduler;
 #if !defined(NGRAPH_DEX_ONLY)
                 bool m_is_compiled;
 #endif
@@ -279,6 +281,13 @@ namespace ngraph
                 std::vector<std::function<bool(CPURuntimeContext*)>> enables;
                 std::list<std::pair<std::function<bool(CPURuntimeContext*)>, std::string>>
                     enable_nodename_list;
+                // Dependencies between functors used by the inter-op scheduler. An edge i -> j
+                // means that functor j reads or writes a buffer set touched by functor i
+                // earlier in program order.
+                std::vector<std::vector<size_t>> m_op_successors;
+                std::vector<size_t> m_op_num_predecessors;
+                // Scheduler sized from NGRAPH_INTER_OP_PARALLELISM when the function was built
+                runtime::cpu::executor::CPUInterOpScheduler* m_inter_op_scheduler = nullptr;
                 std::function<void(CPURuntimeContext*, std::vector<void*>&, std::vector<void*>&)>
                     executor;
                 // name of a tensor and index into the cpu_runtime_context's buffer_data vector to
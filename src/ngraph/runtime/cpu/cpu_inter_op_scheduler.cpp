@@ -0,0 +1,314 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <exception>
+
+#include "ngraph/check.hpp"
+#include "ngraph/runtime/cpu/cpu_inter_op_scheduler.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+struct runtime::cpu::executor::CPUInterOpScheduler::Job
+{
+    Job(const vector<vector<size_t>>& succ, const TaskFunction& fn)
+        : successors(succ)
+        , task(fn)
+        , pending(new atomic<size_t>[succ.size()])
+        , remaining(succ.size())
+        , failed(false)
+    {
+    }
+
+    const vector<vector<size_t>>& successors;
+    const TaskFunction& task;
+    unique_ptr<atomic<size_t>[]> pending;
+    atomic<size_t> remaining;
+    atomic<bool> failed;
+    mutex exception_mutex;
+    exception_ptr exception;
+};
+
+runtime::cpu::executor::CPUInterOpScheduler::CPUInterOpScheduler(int num_workers)
+    : m_num_workers(num_workers < 1 ? 1 : num_workers)
+    , m_queues(new WorkQueue[m_num_workers])
+    , m_num_queued(0)
+    , m_num_idle(0)
+    , m_job(nullptr)
+    , m_generation(0)
+    , m_active_helpers(0)
+    , m_shutdown(false)
+{
+    // Worker 0 is always the thread calling run()
+    for (int worker = 1; worker < m_num_workers; worker++)
+    {
+        m_helpers.emplace_back(&CPUInterOpScheduler::helper_loop, this, worker);
+    }
+}
+
+runtime::cpu::executor::CPUInterOpScheduler::~CPUInterOpScheduler()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_shutdown = true;
+    }
+    m_job_cv.notify_all();
+    for (auto& helper : m_helpers)
+    {
+        helper.join();
+    }
+}
+
+void runtime::cpu::executor::CPUInterOpScheduler::run(const vector<vector<size_t>>& successors,
+                                                      const vector<size_t>& num_predecessors,
+                                                      const TaskFunction& task)
+{
+    NGRAPH_CHECK(successors.size() == num_predecessors.size(),
+                 "Inter-op scheduler: successor and predecessor tables differ in size");
+    if (successors.empty())
+    {
+        return;
+    }
+
+    unique_lock<mutex> run_lock(m_run_mutex, try_to_lock);
+    if (m_num_workers == 1 || !run_lock.owns_lock())
+    {
+        run_serial(successors, num_predecessors, task);
+        return;
+    }
+
+    Job job(successors, task);
+    int next_worker = 0;
+    for (size_t i = 0; i < num_predecessors.size(); i++)
+    {
+        job.pending[i].store(num_predecessors[i], memory_order_relaxed);
+        if (num_predecessors[i] == 0)
+        {
+            // Spread the roots so that every helper has work without stealing
+            push(next_worker, i);
+            next_worker = (next_worker + 1) % m_num_workers;
+        }
+    }
+
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_job = &job;
+        m_active_helpers = m_num_workers - 1;
+        m_generation++;
+    }
+    m_job_cv.notify_all();
+
+    work(job, 0);
+
+    {
+        unique_lock<mutex> lock(m_mutex);
+        m_done_cv.wait(lock, [this]() { return m_active_helpers == 0; });
+        m_job = nullptr;
+    }
+
+    if (job.failed)
+    {
+        // Tasks released before the failure was noticed are still queued
+        for (int worker = 0; worker < m_num_workers; worker++)
+        {
+            m_queues[worker].tasks.clear();
+        }
+        m_num_queued = 0;
+        rethrow_exception(job.exception);
+    }
+}
+
+void runtime::cpu::executor::CPUInterOpScheduler::helper_loop(int worker)
+{
+    uint64_t seen_generation = 0;
+    unique_lock<mutex> lock(m_mutex);
+    while (true)
+    {
+        m_job_cv.wait(lock,
+                      [&]() { return m_shutdown || m_generation != seen_generation; });
+        if (m_shutdown)
+        {
+            return;
+        }
+        seen_generation = m_generation;
+        Job* job = m_job;
+        lock.unlock();
+
+        work(*job, worker);
+
+        lock.lock();
+        if (--m_active_helpers == 0)
+        {
+            m_done_cv.notify_all();
+        }
+    }
+}
+
+void runtime::cpu::executor::CPUInterOpScheduler::work(Job& job, int worker)
+{
+    // Sequentially consistent, see wake_idle_workers
+    auto job_done = [&job]() { return job.remaining == 0 || job.failed; };
+
+    size_t idle_spins = 0;
+    while (!job_done())
+    {
+        size_t task;
+        if (!pop(worker, task) && !steal(worker, task))
+        {
+            // Nothing is ready yet. Poll briefly, then sleep until a task is queued so that idle
+            // workers do not hold on to their cores.
+            if (++idle_spins > 64)
+            {
+                unique_lock<mutex> lock(m_idle_mutex);
+                m_num_idle++;
+                m_idle_cv.wait(lock, [&]() { return m_num_queued > 0 || job_done(); });
+                m_num_idle--;
+                idle_spins = 0;
+            }
+            continue;
+        }
+        idle_spins = 0;
+
+        try
+        {
+            job.task(task, worker);
+        }
+        catch (...)
+        {
+            {
+                lock_guard<mutex> lock(job.exception_mutex);
+                if (!job.failed)
+                {
+                    job.exception = current_exception();
+                    job.failed = true;
+                }
+            }
+            wake_idle_workers(true);
+            return;
+        }
+
+        // Successors are released before this task is retired so that `remaining` never drops
+        // to zero while ready tasks are still sitting in a queue
+        for (auto successor : job.successors[task])
+        {
+            if (job.pending[successor].fetch_sub(1, memory_order_acq_rel) == 1)
+            {
+                push(worker, successor);
+            }
+        }
+        if (job.remaining.fetch_sub(1) == 1)
+        {
+            wake_idle_workers(true);
+        }
+    }
+}
+
+void runtime::cpu::executor::CPUInterOpScheduler::wake_idle_workers(bool all)
+{
+    // A worker registers as idle under m_idle_mutex before it checks for work, so either it sees
+    // the update that preceded this call or it is counted here and woken
+    if (m_num_idle > 0)
+    {
+        {
+            lock_guard<mutex> lock(m_idle_mutex);
+        }
+        if (all)
+        {
+            m_idle_cv.notify_all();
+        }
+        else
+        {
+            m_idle_cv.notify_one();
+        }
+    }
+}
+
+void runtime::cpu::executor::CPUInterOpScheduler::push(int worker, size_t task)
+{
+    auto& queue = m_queues[worker];
+    {
+        lock_guard<mutex> lock(queue.mutex);
+        queue.tasks.push_back(task);
+    }
+    m_num_queued++;
+    wake_idle_workers(false);
+}
+
+bool runtime::cpu::executor::CPUInterOpScheduler::pop(int worker, size_t& task)
+{
+    auto& queue = m_queues[worker];
+    lock_guard<mutex> lock(queue.mutex);
+    if (queue.tasks.empty())
+    {
+        return false;
+    }
+    task = queue.tasks.back();
+    queue.tasks.pop_back();
+    m_num_queued--;
+    return true;
+}
+
+bool runtime::cpu::executor::CPUInterOpScheduler::steal(int worker, size_t& task)
+{
+    for (int i = 1; i < m_num_workers; i++)
+    {
+        auto& queue = m_queues[(worker + i) % m_num_workers];
+        lock_guard<mutex> lock(queue.mutex);
+        if (!queue.tasks.empty())
+        {
+            task = queue.tasks.front();
+            queue.tasks.pop_front();
+            m_num_queued--;
+            return true;
+        }
+    }
+    return false;
+}
+
+void runtime::cpu::executor::CPUInterOpScheduler::run_serial(
+    const vector<vector<size_t>>& successors,
+    const vector<size_t>& num_predecessors,
+    const TaskFunction& task)
+{
+    vector<size_t> pending(num_predecessors);
+    vector<size_t> ready;
+    // Seed in reverse so that tasks are popped in their original order
+    for (size_t i = pending.size(); i-- > 0;)
+    {
+        if (pending[i] == 0)
+        {
+            ready.push_back(i);
+        }
+    }
+
+    size_t executed = 0;
+    while (!ready.empty())
+    {
+        auto current = ready.back();
+        ready.pop_back();
+        task(current, 0);
+        executed++;
+        for (auto successor : successors[current])
+        {
+            if (--pending[successor] == 0)
+            {
+                ready.push_back(successor);
+            }
+        }
+    }
+    NGRAPH_CHECK(executed == successors.size(),
+                 "Inter-op scheduler: dependency graph has a cycle");
+}
@@ -0,0 +1,126 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace executor
+            {
+                /// \brief Dependency-aware inter-op scheduler for direct execution mode.
+                ///
+                /// A graph is described by the successors of every task and the number of
+                /// predecessors each task waits for. Tasks whose predecessors have all
+                /// completed are pushed to the deque of the worker that released them. A worker
+                /// pops from the back of its own deque and steals from the front of the other
+                /// deques when it runs out of work, so independent branches of a wide graph are
+                /// spread over all workers while dependent chains stay on one core.
+                ///
+                /// The calling thread always participates as worker 0. If the helper threads are
+                /// already busy with a graph submitted by another thread, the graph is executed
+                /// on the calling thread alone, still in dependency order.
+                class CPU_BACKEND_API CPUInterOpScheduler
+                {
+                public:
+                    /// \brief Task body, called with the task index and the id of the worker
+                    ///        executing it. Worker ids are in [0, get_num_workers()).
+                    using TaskFunction = std::function<void(size_t, int)>;
+
+                    explicit CPUInterOpScheduler(int num_workers);
+                    ~CPUInterOpScheduler();
+
+                    CPUInterOpScheduler(const CPUInterOpScheduler&) = delete;
+                    CPUInterOpScheduler& operator=(const CPUInterOpScheduler&) = delete;
+
+                    int get_num_workers() const { return m_num_workers; }
+                    /// \brief Execute every task once, never before all of its predecessors.
+                    ///
+                    /// Returns once all tasks have completed. If a task throws, no further
+                    /// tasks are started and the first exception is rethrown on the calling
+                    /// thread.
+                    ///
+                    /// \param successors successors[i] lists the tasks that depend on task i
+                    /// \param num_predecessors num_predecessors[i] is the number of tasks that
+                    ///        list i as a successor
+                    /// \param task the task body
+                    void run(const std::vector<std::vector<size_t>>& successors,
+                             const std::vector<size_t>& num_predecessors,
+                             const TaskFunction& task);
+
+                private:
+                    struct Job;
+
+                    struct WorkQueue
+                    {
+                        std::mutex mutex;
+                        std::deque<size_t> tasks;
+                    };
+
+                    void helper_loop(int worker);
+                    void work(Job& job, int worker);
+                    void push(int worker, size_t task);
+                    bool pop(int worker, size_t& task);
+                    bool steal(int worker, size_t& task);
+                    void run_serial(const std::vector<std::vector<size_t>>& successors,
+                                    const std::vector<size_t>& num_predecessors,
+                                    const TaskFunction& task);
+
+                    void wake_idle_workers(bool all);
+
+                    int m_num_workers;
+                    std::unique_ptr<WorkQueue[]> m_queues;
+
+                    // Workers that find every queue empty sleep on m_idle_cv until a task is
+                    // queued or the job ends
+                    std::atomic<size_t> m_num_queued;
+                    std::atomic<int> m_num_idle;
+                    std::mutex m_idle_mutex;
+                    std::condition_variable m_idle_cv;
+                    std::vector<std::thread> m_helpers;
+
+                    // Serializes graphs that use the helper threads
+                    std::mutex m_run_mutex;
+
+                    // Protects the fields below, used to hand a job to the helpers
+                    std::mutex m_mutex;
+                    std::condition_variable m_job_cv;
+                    std::condition_variable m_done_cv;
+                    Job* m_job;
+                    uint64_t m_generation;
+                    int m_active_helpers;
+                    bool m_shutdown;
+                };
+            }
+        }
+    }
+}
@@ -18,10 +18,10 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <random>
 #include <vector>
 
 #include "ngraph/op/pad.hpp"
+#include "ngraph/state/philox.hpp"
 
 // CBLAS types and wrappers
 
@@ -288,8 +288,9 @@ namespace ngraph
                                       size_t nelems,
                                       bool training,
                                       const double value,
-                                      const std::vector<std::minstd_rand>& vmsr,
-                                      const bool use_seed);
+                                      const Philox4x32& generator,
+                                      const uint64_t offset,
+                                      int arena);
 
                 template <typename InputElementType, typename AxisElementType>
                 void reference_cumsum(void* input_tensor,
@@ -92,6 +92,15 @@ const char* runtime::cpu::CPUTensor::get_data_ptr() const
     return aligned_buffer;
 }
 
+void runtime::cpu::CPUTensor::set_data_ptr(void* memory_pointer)
+{
+    if (buffer != nullptr)
+    {
+        throw ngraph_error("Only a tensor made on a memory pointer can be moved to other memory");
+    }
+    aligned_buffer = static_cast<char*>(memory_pointer);
+}
+
 void runtime::cpu::CPUTensor::write(const void* source, size_t n)
 {
     if (n > buffer_size)
@@ -163,6 +172,17 @@ void runtime::cpu::CPUTensor::read(void* target, size_t n) const
     }
 }
 
+void* runtime::cpu::CPUTensor::get_host_data_ptr()
+{
+    auto cpu_tvl =
+        dynamic_cast<runtime::cpu::LayoutDescriptor*>(this->get_tensor_layout().get());
+    if (cpu_tvl && cpu_tvl->is_mkldnn_layout())
+    {
+        return nullptr;
+    }
+    return aligned_buffer;
+}
+
 void runtime::cpu::CPUTensor::copy_from(const ngraph::runtime::Tensor& source)
 {
     if (get_element_count() != source.get_element_count())
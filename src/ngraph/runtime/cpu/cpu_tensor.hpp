@@ -54,6 +54,12 @@ namespace ngraph
                 /// \param n Number of bytes to read, must be integral number of elements.
                 void read(void* p, size_t n) const override;
 
+                /// \brief Returns nullptr while the tensor holds an MKLDNN layout
+                void* get_host_data_ptr() override;
+
+                /// \brief Points a tensor made on memory_pointer at other memory of the same size
+                CPU_BACKEND_API void set_data_ptr(void* memory_pointer);
+
                 /// \brief copy bytes directly from source to this tensor
                 /// \param source The source tensor
                 void copy_from(const ngraph::runtime::Tensor& source) override;
@@ -0,0 +1,321 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define NGRAPH_CPU_HALF_INTRINSICS
+#endif
+
+#include "convert.hpp"
+
+using namespace std;
+
+namespace
+{
+    using HalfLoop = void (*)(const void*, void*, size_t);
+
+    // Work is split in blocks large enough to amortize the task overhead
+    constexpr size_t convert_block_size = 16384;
+
+    uint32_t float_bits(float value)
+    {
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    float bits_float(uint32_t bits)
+    {
+        float value;
+        memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    void bf16_to_f32_loop(const void* input, void* output, size_t count)
+    {
+        auto in = static_cast<const uint16_t*>(input);
+        auto out = static_cast<float*>(output);
+        for (size_t i = 0; i < count; i++)
+        {
+            out[i] = bits_float(static_cast<uint32_t>(in[i]) << 16);
+        }
+    }
+
+    void f32_to_bf16_loop(const void* input, void* output, size_t count)
+    {
+        auto in = static_cast<const float*>(input);
+        auto out = static_cast<uint16_t*>(output);
+        for (size_t i = 0; i < count; i++)
+        {
+            uint32_t bits = float_bits(in[i]);
+            if (in[i] != in[i])
+            {
+                // Keep NaNs quiet, rounding could otherwise carry into the exponent
+                out[i] = 0x7FC0;
+            }
+            else
+            {
+                out[i] = static_cast<uint16_t>((bits + 0x7FFF + ((bits >> 16) & 1)) >> 16);
+            }
+        }
+    }
+
+    void f16_to_f32_loop(const void* input, void* output, size_t count)
+    {
+        auto in = static_cast<const ngraph::float16*>(input);
+        auto out = static_cast<float*>(output);
+        for (size_t i = 0; i < count; i++)
+        {
+            out[i] = static_cast<float>(in[i]);
+        }
+    }
+
+    void f32_to_f16_loop(const void* input, void* output, size_t count)
+    {
+        auto in = static_cast<const float*>(input);
+        auto out = static_cast<ngraph::float16*>(output);
+        for (size_t i = 0; i < count; i++)
+        {
+            out[i] = ngraph::float16(in[i]);
+        }
+    }
+
+#ifdef NGRAPH_CPU_HALF_INTRINSICS
+    __attribute__((target("avx,f16c"))) void f16_to_f32_f16c(const void* input,
+                                                             void* output,
+                                                             size_t count)
+    {
+        auto in = static_cast<const uint16_t*>(input);
+        auto out = static_cast<float*>(output);
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            __m128i half = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+            _mm256_storeu_ps(out + i, _mm256_cvtph_ps(half));
+        }
+        if (i < count)
+        {
+            // The tail goes through the same instruction so that it rounds like the body
+            uint16_t half[8] = {};
+            float single[8];
+            memcpy(half, in + i, (count - i) * sizeof(uint16_t));
+            _mm256_storeu_ps(single,
+                             _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<__m128i*>(half))));
+            memcpy(out + i, single, (count - i) * sizeof(float));
+        }
+    }
+
+    __attribute__((target("avx,f16c"))) void f32_to_f16_f16c(const void* input,
+                                                             void* output,
+                                                             size_t count)
+    {
+        auto in = static_cast<const float*>(input);
+        auto out = static_cast<uint16_t*>(output);
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            __m128i half = _mm256_cvtps_ph(_mm256_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), half);
+        }
+        if (i < count)
+        {
+            float single[8] = {};
+            uint16_t half[8];
+            memcpy(single, in + i, (count - i) * sizeof(float));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(half),
+                             _mm256_cvtps_ph(_mm256_loadu_ps(single), _MM_FROUND_TO_NEAREST_INT));
+            memcpy(out + i, half, (count - i) * sizeof(uint16_t));
+        }
+    }
+
+    __attribute__((target("avx512f"))) void bf16_to_f32_avx512(const void* input,
+                                                               void* output,
+                                                               size_t count)
+    {
+        auto in = static_cast<const uint16_t*>(input);
+        auto out = static_cast<float*>(output);
+        size_t i = 0;
+        for (; i + 16 <= count; i += 16)
+        {
+            __m512i wide = _mm512_cvtepu16_epi32(
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i)));
+            _mm512_storeu_si512(out + i, _mm512_slli_epi32(wide, 16));
+        }
+        bf16_to_f32_loop(in + i, out + i, count - i);
+    }
+
+    __attribute__((target("avx512f"))) void f32_to_bf16_avx512(const void* input,
+                                                               void* output,
+                                                               size_t count)
+    {
+        auto in = static_cast<const float*>(input);
+        auto out = static_cast<uint16_t*>(output);
+        const __m512i one = _mm512_set1_epi32(1);
+        const __m512i bias = _mm512_set1_epi32(0x7FFF);
+        const __m512i quiet_nan = _mm512_set1_epi32(0x7FC0);
+        size_t i = 0;
+        for (; i + 16 <= count; i += 16)
+        {
+            __m512 single = _mm512_loadu_ps(in + i);
+            __m512i bits = _mm512_castps_si512(single);
+            __m512i lsb = _mm512_and_si512(_mm512_srli_epi32(bits, 16), one);
+            __m512i rounded =
+                _mm512_srli_epi32(_mm512_add_epi32(bits, _mm512_add_epi32(lsb, bias)), 16);
+            __mmask16 nan = _mm512_cmp_ps_mask(single, single, _CMP_UNORD_Q);
+            rounded = _mm512_mask_mov_epi32(rounded, nan, quiet_nan);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                                _mm512_cvtepi32_epi16(rounded));
+        }
+        f32_to_bf16_loop(in + i, out + i, count - i);
+    }
+#endif
+
+    struct HalfLoops
+    {
+        HalfLoops()
+        {
+#ifdef NGRAPH_CPU_HALF_INTRINSICS
+            __builtin_cpu_init();
+            // Every AVX2 capable processor also implements F16C
+            if (__builtin_cpu_supports("avx2"))
+            {
+                f16_to_f32 = f16_to_f32_f16c;
+                f32_to_f16 = f32_to_f16_f16c;
+            }
+            if (__builtin_cpu_supports("avx512f"))
+            {
+                bf16_to_f32 = bf16_to_f32_avx512;
+                f32_to_bf16 = f32_to_bf16_avx512;
+            }
+#endif
+        }
+
+        HalfLoop f16_to_f32 = f16_to_f32_loop;
+        HalfLoop f32_to_f16 = f32_to_f16_loop;
+        HalfLoop bf16_to_f32 = bf16_to_f32_loop;
+        HalfLoop f32_to_bf16 = f32_to_bf16_loop;
+    };
+
+    const HalfLoops& get_half_loops()
+    {
+        static HalfLoops loops;
+        return loops;
+    }
+
+    void convert_half(HalfLoop loop,
+                      const void* input,
+                      size_t input_size,
+                      void* output,
+                      size_t output_size,
+                      size_t count,
+                      int arena)
+    {
+        auto in = static_cast<const char*>(input);
+        auto out = static_cast<char*>(output);
+        auto convert_blocks = [&](Eigen::Index first, Eigen::Index last) {
+            size_t start = first * convert_block_size;
+            size_t end = min(count, static_cast<size_t>(last) * convert_block_size);
+            loop(in + start * input_size, out + start * output_size, end - start);
+        };
+
+        size_t num_blocks = (count + convert_block_size - 1) / convert_block_size;
+        Eigen::TensorOpCost cost(convert_block_size * input_size,
+                                 convert_block_size * output_size,
+                                 convert_block_size);
+        ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena).parallelFor(
+            num_blocks, cost, convert_blocks);
+    }
+}
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                void convert_f16_to_f32(void* input, void* output, size_t count, int arena)
+                {
+                    convert_half(get_half_loops().f16_to_f32,
+                                 input,
+                                 sizeof(float16),
+                                 output,
+                                 sizeof(float),
+                                 count,
+                                 arena);
+                }
+
+                void convert_f32_to_f16(void* input, void* output, size_t count, int arena)
+                {
+                    convert_half(get_half_loops().f32_to_f16,
+                                 input,
+                                 sizeof(float),
+                                 output,
+                                 sizeof(float16),
+                                 count,
+                                 arena);
+                }
+
+                void convert_bf16_to_f32(void* input, void* output, size_t count, int arena)
+                {
+                    convert_half(get_half_loops().bf16_to_f32,
+                                 input,
+                                 sizeof(bfloat16),
+                                 output,
+                                 sizeof(float),
+                                 count,
+                                 arena);
+                }
+
+                void convert_f32_to_bf16(void* input, void* output, size_t count, int arena)
+                {
+                    convert_half(get_half_loops().f32_to_bf16,
+                                 input,
+                                 sizeof(float),
+                                 output,
+                                 sizeof(bfloat16),
+                                 count,
+                                 arena);
+                }
+
+                void widen_half_block(const float16* input, float* output, size_t count)
+                {
+                    get_half_loops().f16_to_f32(input, output, count);
+                }
+
+                void widen_half_block(const bfloat16* input, float* output, size_t count)
+                {
+                    get_half_loops().bf16_to_f32(input, output, count);
+                }
+
+                void narrow_half_block(const float* input, float16* output, size_t count)
+                {
+                    get_half_loops().f32_to_f16(input, output, count);
+                }
+
+                void narrow_half_block(const float* input, bfloat16* output, size_t count)
+                {
+                    get_half_loops().f32_to_bf16(input, output, count);
+                }
+            }
+        }
+    }
+}
@@ -30,6 +30,20 @@ namespace ngraph
         {
             namespace kernel
             {
+                // Half precision conversions use F16C or AVX-512 when the host supports them and
+                // round to nearest even, so narrowing an f32 value never depends on the host
+                void convert_f16_to_f32(void* input, void* output, size_t count, int arena);
+                void convert_f32_to_f16(void* input, void* output, size_t count, int arena);
+                void convert_bf16_to_f32(void* input, void* output, size_t count, int arena);
+                void convert_f32_to_bf16(void* input, void* output, size_t count, int arena);
+
+                // Serial conversions of one block, for kernels that widen their half precision
+                // inputs and narrow their results block by block on the calling thread
+                void widen_half_block(const float16* input, float* output, size_t count);
+                void widen_half_block(const bfloat16* input, float* output, size_t count);
+                void narrow_half_block(const float* input, float16* output, size_t count);
+                void narrow_half_block(const float* input, bfloat16* output, size_t count);
+
                 template <typename InputElementType, typename OutputElementType>
                 void convert(void* input, void* output, size_t count, int arena)
                 {
@@ -16,9 +16,11 @@
 
 #pragma once
 
-#include <random>
+#include <algorithm>
 
+#include "ngraph/runtime/cpu/kernel/random.hpp"
 #include "ngraph/shape.hpp"
+#include "ngraph/state/philox.hpp"
 
 namespace ngraph
 {
@@ -28,7 +30,9 @@ namespace ngraph
         {
             namespace kernel
             {
-                // Note: this kernel is for doing upscale in train
+                // Note: this kernel is for doing upscale in train. The mask draws values
+                // [offset, offset + nelems) of the generator the same way GenerateMask does, so
+                // Dropout and the GenerateMask graph it replaces produce the same mask.
                 template <typename T, typename M>
                 void generate_dropout(T* input,
                                       T* out0,
@@ -36,59 +40,36 @@ namespace ngraph
                                       const size_t nelems,
                                       const bool training,
                                       const double keep_prob,
-                                      const std::vector<std::minstd_rand>& vmsr,
-                                      const bool use_seed)
+                                      const Philox4x32& generator,
+                                      const uint64_t offset,
+                                      int arena)
                 {
                     if (training)
-
                     {
-                        int32_t rnd_seed = rand();
-                        M dropout_prob = 1 - static_cast<M>(keep_prob);
-#ifdef _OPENMP
-                        size_t nthr =
-                            ngraph::runtime::cpu::executor::GetCPUExecutor().get_num_cores();
-                        size_t chunk_size = (nelems + nthr - 1) / nthr;
-
-#pragma omp parallel num_threads(nthr)
-                        {
-                            size_t tid = omp_get_thread_num();
-#else
-                        size_t chunk_size = nelems;
-                        {
-                            size_t tid = 0;
-#endif
-                            // Note :
-                            // In this implementation of dropout, we are trying to be same as PDPD
-                            // native implementation (and other frameworks).
-                            // https://github.com/NervanaSystems/ngraph-paddle/blob/14d88829b386c9f7601788c5539c08326dcbe2fe/paddle/fluid/operators/dropout_op.h#L58-L78
-                            // So, if framework passes same seed, then we will get same mask.
-                            std::minstd_rand msr;
-                            if (use_seed)
-                            {
-                                msr = vmsr[tid];
-                            }
-                            else
+                        uint64_t threshold = bernoulli_threshold(keep_prob);
+                        parallel_random_blocks(nelems, arena, [&](size_t start, size_t count) {
+                            const size_t block_size = 1024;
+                            uint32_t bits[block_size];
+                            for (size_t first = start; first < start + count; first += block_size)
                             {
-                                msr.seed(rnd_seed + tid);
-                            }
-                            std::uniform_real_distribution<> gen(0, 1);
-
-                            size_t idx_start = tid * chunk_size;
-                            size_t idx_end = std::min(idx_start + chunk_size, nelems);
-                            for (size_t idx = idx_start; idx < idx_end; ++idx)
-                            {
-                                if (static_cast<M>(gen(msr)) < dropout_prob)
+                                size_t n = std::min(block_size, start + count - first);
+                                generator.generate(bits, n, offset + first);
+                                for (size_t i = 0; i < n; i++)
                                 {
-                                    out1_mask[idx] = 0;
-                                    out0[idx] = 0;
-                                }
-                                else
-                                {
-                                    out1_mask[idx] = 1;
-                                    out0[idx] = input[idx] / static_cast<T>(keep_prob);
+                                    size_t idx = first + i;
+                                    if (bits[i] < threshold)
+                                    {
+                                        out1_mask[idx] = 1;
+                                        out0[idx] = input[idx] / static_cast<T>(keep_prob);
+                                    }
+                                    else
+                                    {
+                                        out1_mask[idx] = 0;
+                                        out0[idx] = 0;
+                                    }
                                 }
                             }
-                        }
+                        });
                     }
                     else
                     {
@@ -0,0 +1,232 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/op/fused_elementwise.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// \brief The loop nest of a FusedElementwise op, resolved at build time
+                struct FusedElementwiseLoop
+                {
+                    Shape shape;
+                    size_t count;
+                    // Per input, the step in the input for each axis of the output. Empty for
+                    // inputs that are not broadcast.
+                    std::vector<std::vector<size_t>> input_strides;
+                    std::vector<ngraph::op::FusedElementwise::Instruction> instructions;
+                    // Index of each input in CPURuntimeContext::buffer_data
+                    std::vector<size_t> input_buffers;
+                    // Per value, the index in CPURuntimeContext::buffer_data of the output
+                    // it is computed into, or fused_elementwise_no_output
+                    std::vector<size_t> value_buffers;
+                    size_t num_outputs;
+                };
+
+                constexpr size_t fused_elementwise_no_output = static_cast<size_t>(-1);
+
+                // Values are computed one block at a time so that the intermediates of a block
+                // stay in cache, instead of each op streaming a whole tensor through memory
+                constexpr size_t fused_elementwise_block_size = 1024;
+
+                // Scratch space of the thread evaluating blocks. It only grows, so after the
+                // first call per thread evaluating blocks does not allocate.
+                template <typename ElementType>
+                struct FusedElementwiseScratch
+                {
+                    std::vector<ElementType> blocks;
+                    std::vector<const ElementType*> values;
+                    std::vector<size_t> coordinate;
+                };
+
+                template <typename ElementType>
+                FusedElementwiseScratch<ElementType>& get_fused_elementwise_scratch(
+                    size_t num_values, size_t rank)
+                {
+                    static thread_local FusedElementwiseScratch<ElementType> scratch;
+                    if (scratch.blocks.size() < num_values * fused_elementwise_block_size)
+                    {
+                        scratch.blocks.resize(num_values * fused_elementwise_block_size);
+                    }
+                    if (scratch.values.size() < num_values)
+                    {
+                        scratch.values.resize(num_values);
+                    }
+                    if (scratch.coordinate.size() < rank)
+                    {
+                        scratch.coordinate.resize(rank);
+                    }
+                    return scratch;
+                }
+
+                template <typename ElementType>
+                void broadcast_block(const ElementType* input,
+                                     ElementType* output,
+                                     const Shape& shape,
+                                     const std::vector<size_t>& strides,
+                                     size_t start,
+                                     size_t count,
+                                     size_t* coordinate)
+                {
+                    size_t rank = shape.size();
+                    size_t offset = 0;
+                    size_t index = start;
+                    for (size_t axis = rank; axis-- > 0;)
+                    {
+                        coordinate[axis] = index % shape[axis];
+                        index /= shape[axis];
+                        offset += coordinate[axis] * strides[axis];
+                    }
+
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        output[i] = input[offset];
+                        for (size_t axis = rank; axis-- > 0;)
+                        {
+                            offset += strides[axis];
+                            if (++coordinate[axis] < shape[axis])
+                            {
+                                break;
+                            }
+                            offset -= strides[axis] * shape[axis];
+                            coordinate[axis] = 0;
+                        }
+                    }
+                }
+
+                template <typename ElementType>
+                void evaluate_block(ngraph::op::FusedElementwise::Opcode opcode,
+                                    const ElementType* arg0,
+                                    const ElementType* arg1,
+                                    ElementType* output,
+                                    size_t count)
+                {
+                    using Opcode = ngraph::op::FusedElementwise::Opcode;
+                    using ConstMap =
+                        Eigen::TensorMap<Eigen::Tensor<const ElementType, 1, Eigen::RowMajor>>;
+
+                    Eigen::array<Eigen::Index, 1> dims;
+                    dims[0] = count;
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> out(output,
+                                                                                          dims);
+                    ConstMap in0(arg0, dims);
+
+                    switch (opcode)
+                    {
+                    case Opcode::ADD: out = in0 + ConstMap(arg1, dims); break;
+                    case Opcode::SUBTRACT: out = in0 - ConstMap(arg1, dims); break;
+                    case Opcode::MULTIPLY: out = in0 * ConstMap(arg1, dims); break;
+                    case Opcode::DIVIDE: out = in0 / ConstMap(arg1, dims); break;
+                    case Opcode::MAXIMUM: out = in0.cwiseMax(ConstMap(arg1, dims)); break;
+                    case Opcode::MINIMUM: out = in0.cwiseMin(ConstMap(arg1, dims)); break;
+                    case Opcode::NEGATIVE: out = -in0; break;
+                    case Opcode::ABS: out = in0.abs(); break;
+                    case Opcode::EXP: out = in0.exp(); break;
+                    case Opcode::LOG: out = in0.log(); break;
+                    case Opcode::SQRT: out = in0.sqrt(); break;
+                    case Opcode::TANH: out = in0.tanh(); break;
+                    case Opcode::SIGMOID: out = in0.sigmoid(); break;
+                    case Opcode::RELU: out = in0.cwiseMax(ElementType(0)); break;
+                    }
+                }
+
+                template <typename ElementType>
+                void fused_elementwise(void** buffer_data,
+                                       const FusedElementwiseLoop& loop,
+                                       int arena)
+                {
+                    const size_t block_size = fused_elementwise_block_size;
+                    const size_t num_inputs = loop.input_buffers.size();
+                    const size_t num_values = num_inputs + loop.instructions.size();
+
+                    auto evaluate_blocks = [&](Eigen::Index first, Eigen::Index last) {
+                        auto& scratch = get_fused_elementwise_scratch<ElementType>(
+                            num_values, loop.shape.size());
+                        ElementType* blocks = scratch.blocks.data();
+                        const ElementType** values = scratch.values.data();
+                        for (Eigen::Index block = first; block < last; block++)
+                        {
+                            size_t start = block * block_size;
+                            size_t count = std::min(block_size, loop.count - start);
+                            for (size_t i = 0; i < num_inputs; i++)
+                            {
+                                auto input = static_cast<const ElementType*>(
+                                    buffer_data[loop.input_buffers[i]]);
+                                if (loop.input_strides[i].empty())
+                                {
+                                    values[i] = input + start;
+                                }
+                                else
+                                {
+                                    ElementType* data = blocks + i * block_size;
+                                    broadcast_block(input,
+                                                    data,
+                                                    loop.shape,
+                                                    loop.input_strides[i],
+                                                    start,
+                                                    count,
+                                                    scratch.coordinate.data());
+                                    values[i] = data;
+                                }
+                            }
+                            for (size_t i = 0; i < loop.instructions.size(); i++)
+                            {
+                                auto& instruction = loop.instructions[i];
+                                size_t value = num_inputs + i;
+                                // Values that are outputs are computed in place
+                                size_t buffer = loop.value_buffers[value];
+                                ElementType* data =
+                                    buffer == fused_elementwise_no_output
+                                        ? blocks + value * block_size
+                                        : static_cast<ElementType*>(buffer_data[buffer]) + start;
+                                evaluate_block(instruction.opcode,
+                                               values[instruction.operands[0]],
+                                               instruction.operands.size() > 1
+                                                   ? values[instruction.operands[1]]
+                                                   : nullptr,
+                                               data,
+                                               count);
+                                values[value] = data;
+                            }
+                        }
+                    };
+
+                    size_t num_blocks = (loop.count + block_size - 1) / block_size;
+                    Eigen::TensorOpCost cost(num_inputs * block_size * sizeof(ElementType),
+                                             loop.num_outputs * block_size * sizeof(ElementType),
+                                             loop.instructions.size() * block_size);
+                    executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        num_blocks, cost, evaluate_blocks);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,328 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "half_precision.hpp"
+#include "ngraph/runtime/cpu/kernel/convert.hpp"
+#include "ngraph/runtime/cpu/kernel/fused_elementwise.hpp"
+#include "ngraph/runtime/reference/dense_walk.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    // Tiles of the f32 dot product. A tile of the second argument is 64KB, so it stays in L2
+    // while the rows of the first argument stream past it.
+    constexpr size_t dot_rows_per_tile = 32;
+    constexpr size_t dot_columns_per_tile = 128;
+    constexpr size_t dot_depth_per_tile = 128;
+
+    // f32 scratch space of the calling thread. It only grows, so after the first call per thread
+    // the kernels do not allocate.
+    float* get_scratch(size_t size)
+    {
+        static thread_local vector<float> scratch;
+        if (scratch.size() < size)
+        {
+            scratch.resize(size);
+        }
+        return scratch.data();
+    }
+
+    // Folds arg into f32 accumulators initialized to init and narrows them into out
+    template <typename HalfType, typename OP>
+    void reduce_blocks(const HalfType* arg,
+                       HalfType* out,
+                       const Shape& in_shape,
+                       const Shape& out_shape,
+                       const AxisSet& reduction_axes,
+                       float init,
+                       OP op)
+    {
+        const size_t block_size = runtime::cpu::kernel::fused_elementwise_block_size;
+        size_t out_size = shape_size(out_shape);
+        float* accumulators = get_scratch(out_size + block_size);
+        float* values = accumulators + out_size;
+        fill(accumulators, accumulators + out_size, init);
+
+        runtime::reference::for_each_projected_run(
+            in_shape,
+            reduction_axes,
+            [&](size_t offset, size_t projected_offset, size_t count, size_t projected_step) {
+                for (size_t done = 0; done < count; done += block_size)
+                {
+                    size_t n = min(block_size, count - done);
+                    runtime::cpu::kernel::widen_half_block(arg + offset + done, values, n);
+                    if (projected_step == 0)
+                    {
+                        float& accumulator = accumulators[projected_offset];
+                        for (size_t i = 0; i < n; i++)
+                        {
+                            accumulator = op(accumulator, values[i]);
+                        }
+                    }
+                    else
+                    {
+                        float* run = accumulators + projected_offset + done;
+                        for (size_t i = 0; i < n; i++)
+                        {
+                            run[i] = op(run[i], values[i]);
+                        }
+                    }
+                }
+            });
+        runtime::cpu::kernel::narrow_half_block(accumulators, out, out_size);
+    }
+}
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                template <typename HalfType>
+                void half_elementwise(ngraph::op::FusedElementwise::Opcode opcode,
+                                      const void* input0,
+                                      const void* input1,
+                                      void* output,
+                                      size_t count,
+                                      int arena)
+                {
+                    const size_t block_size = fused_elementwise_block_size;
+                    auto in0 = static_cast<const HalfType*>(input0);
+                    auto in1 = static_cast<const HalfType*>(input1);
+                    auto out = static_cast<HalfType*>(output);
+
+                    auto evaluate_blocks = [&](Eigen::Index first, Eigen::Index last) {
+                        float* values0 = get_scratch(3 * block_size);
+                        float* values1 = values0 + block_size;
+                        float* results = values1 + block_size;
+                        for (Eigen::Index block = first; block < last; block++)
+                        {
+                            size_t start = block * block_size;
+                            size_t n = std::min(block_size, count - start);
+                            widen_half_block(in0 + start, values0, n);
+                            if (in1)
+                            {
+                                widen_half_block(in1 + start, values1, n);
+                            }
+                            evaluate_block<float>(
+                                opcode, values0, in1 ? values1 : nullptr, results, n);
+                            narrow_half_block(results, out + start, n);
+                        }
+                    };
+
+                    size_t num_blocks = (count + block_size - 1) / block_size;
+                    Eigen::TensorOpCost cost((in1 ? 2 : 1) * block_size * sizeof(HalfType),
+                                             block_size * sizeof(HalfType),
+                                             4 * block_size);
+                    executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        num_blocks, cost, evaluate_blocks);
+                }
+
+                template <typename HalfType>
+                void half_reduce(HalfReduction reduction,
+                                 const void* arg,
+                                 void* out,
+                                 const Shape& in_shape,
+                                 const Shape& out_shape,
+                                 const AxisSet& reduction_axes)
+                {
+                    auto in = static_cast<const HalfType*>(arg);
+                    auto result = static_cast<HalfType*>(out);
+                    switch (reduction)
+                    {
+                    case HalfReduction::SUM:
+                        reduce_blocks(in,
+                                      result,
+                                      in_shape,
+                                      out_shape,
+                                      reduction_axes,
+                                      0.0f,
+                                      [](float a, float b) { return a + b; });
+                        break;
+                    case HalfReduction::PRODUCT:
+                        reduce_blocks(in,
+                                      result,
+                                      in_shape,
+                                      out_shape,
+                                      reduction_axes,
+                                      1.0f,
+                                      [](float a, float b) { return a * b; });
+                        break;
+                    case HalfReduction::MAX:
+                        reduce_blocks(in,
+                                      result,
+                                      in_shape,
+                                      out_shape,
+                                      reduction_axes,
+                                      -numeric_limits<float>::infinity(),
+                                      [](float a, float b) { return b > a ? b : a; });
+                        break;
+                    case HalfReduction::MIN:
+                        reduce_blocks(in,
+                                      result,
+                                      in_shape,
+                                      out_shape,
+                                      reduction_axes,
+                                      numeric_limits<float>::infinity(),
+                                      [](float a, float b) { return b < a ? b : a; });
+                        break;
+                    }
+                }
+
+                template <typename HalfType>
+                void half_dot(const void* arg0,
+                              const void* arg1,
+                              void* out,
+                              const Shape& arg0_shape,
+                              const Shape& arg1_shape,
+                              const Shape& out_shape,
+                              size_t reduction_axes_count,
+                              int arena)
+                {
+                    auto a = static_cast<const HalfType*>(arg0);
+                    auto b = static_cast<const HalfType*>(arg1);
+                    auto c = static_cast<HalfType*>(out);
+
+                    // The output is laid out as the free axes of arg0 followed by those of arg1
+                    size_t depth = shape_size(Shape(arg1_shape.begin(),
+                                                    arg1_shape.begin() + reduction_axes_count));
+                    size_t columns = shape_size(Shape(arg1_shape.begin() + reduction_axes_count,
+                                                      arg1_shape.end()));
+                    size_t rows = columns == 0 ? 0 : shape_size(out_shape) / columns;
+                    if (rows == 0 || columns == 0)
+                    {
+                        return;
+                    }
+
+                    size_t row_tiles = (rows + dot_rows_per_tile - 1) / dot_rows_per_tile;
+                    size_t column_tiles =
+                        (columns + dot_columns_per_tile - 1) / dot_columns_per_tile;
+
+                    auto multiply_tiles = [&](Eigen::Index first, Eigen::Index last) {
+                        float* a_tile = get_scratch(dot_rows_per_tile * dot_depth_per_tile +
+                                                    dot_depth_per_tile * dot_columns_per_tile +
+                                                    dot_rows_per_tile * dot_columns_per_tile);
+                        float* b_tile = a_tile + dot_rows_per_tile * dot_depth_per_tile;
+                        float* c_tile = b_tile + dot_depth_per_tile * dot_columns_per_tile;
+                        for (Eigen::Index tile = first; tile < last; tile++)
+                        {
+                            size_t row0 = (tile / column_tiles) * dot_rows_per_tile;
+                            size_t column0 = (tile % column_tiles) * dot_columns_per_tile;
+                            size_t m = std::min(dot_rows_per_tile, rows - row0);
+                            size_t n = std::min(dot_columns_per_tile, columns - column0);
+
+                            fill(c_tile, c_tile + m * dot_columns_per_tile, 0.0f);
+                            for (size_t k0 = 0; k0 < depth; k0 += dot_depth_per_tile)
+                            {
+                                size_t k = std::min(dot_depth_per_tile, depth - k0);
+                                for (size_t i = 0; i < m; i++)
+                                {
+                                    widen_half_block(a + (row0 + i) * depth + k0,
+                                                     a_tile + i * dot_depth_per_tile,
+                                                     k);
+                                }
+                                for (size_t p = 0; p < k; p++)
+                                {
+                                    widen_half_block(b + (k0 + p) * columns + column0,
+                                                     b_tile + p * dot_columns_per_tile,
+                                                     n);
+                                }
+                                for (size_t i = 0; i < m; i++)
+                                {
+                                    float* c_row = c_tile + i * dot_columns_per_tile;
+                                    for (size_t p = 0; p < k; p++)
+                                    {
+                                        float a_value = a_tile[i * dot_depth_per_tile + p];
+                                        const float* b_row = b_tile + p * dot_columns_per_tile;
+                                        for (size_t j = 0; j < n; j++)
+                                        {
+                                            c_row[j] += a_value * b_row[j];
+                                        }
+                                    }
+                                }
+                            }
+                            for (size_t i = 0; i < m; i++)
+                            {
+                                narrow_half_block(c_tile + i * dot_columns_per_tile,
+                                                  c + (row0 + i) * columns + column0,
+                                                  n);
+                            }
+                        }
+                    };
+
+                    size_t tile_rows = std::min(rows, dot_rows_per_tile);
+                    size_t tile_columns = std::min(columns, dot_columns_per_tile);
+                    Eigen::TensorOpCost cost(
+                        (tile_rows + tile_columns) * depth * sizeof(HalfType),
+                        tile_rows * tile_columns * sizeof(HalfType),
+                        2 * tile_rows * tile_columns * depth);
+                    executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        row_tiles * column_tiles, cost, multiply_tiles);
+                }
+
+                template void half_elementwise<float16>(ngraph::op::FusedElementwise::Opcode,
+                                                        const void*,
+                                                        const void*,
+                                                        void*,
+                                                        size_t,
+                                                        int);
+                template void half_elementwise<bfloat16>(ngraph::op::FusedElementwise::Opcode,
+                                                         const void*,
+                                                         const void*,
+                                                         void*,
+                                                         size_t,
+                                                         int);
+                template void half_reduce<float16>(HalfReduction,
+                                                   const void*,
+                                                   void*,
+                                                   const Shape&,
+                                                   const Shape&,
+                                                   const AxisSet&);
+                template void half_reduce<bfloat16>(HalfReduction,
+                                                    const void*,
+                                                    void*,
+                                                    const Shape&,
+                                                    const Shape&,
+                                                    const AxisSet&);
+                template void half_dot<float16>(const void*,
+                                                const void*,
+                                                void*,
+                                                const Shape&,
+                                                const Shape&,
+                                                const Shape&,
+                                                size_t,
+                                                int);
+                template void half_dot<bfloat16>(const void*,
+                                                 const void*,
+                                                 void*,
+                                                 const Shape&,
+                                                 const Shape&,
+                                                 const Shape&,
+                                                 size_t,
+                                                 int);
+            }
+        }
+    }
+}
@@ -0,0 +1,185 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <type_traits>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/cpu/kernel/abs.hpp"
+#include "ngraph/runtime/cpu/kernel/add.hpp"
+#include "ngraph/runtime/cpu/kernel/divide.hpp"
+#include "ngraph/runtime/cpu/kernel/exp.hpp"
+#include "ngraph/runtime/cpu/kernel/log.hpp"
+#include "ngraph/runtime/cpu/kernel/maximum.hpp"
+#include "ngraph/runtime/cpu/kernel/minimum.hpp"
+#include "ngraph/runtime/cpu/kernel/multiply.hpp"
+#include "ngraph/runtime/cpu/kernel/negative.hpp"
+#include "ngraph/runtime/cpu/kernel/reduce_max.hpp"
+#include "ngraph/runtime/cpu/kernel/reduce_min.hpp"
+#include "ngraph/runtime/cpu/kernel/reduce_product.hpp"
+#include "ngraph/runtime/cpu/kernel/reduce_sum.hpp"
+#include "ngraph/runtime/cpu/kernel/relu.hpp"
+#include "ngraph/runtime/cpu/kernel/sqrt.hpp"
+#include "ngraph/runtime/cpu/kernel/subtract.hpp"
+#include "ngraph/runtime/cpu/kernel/tanh.hpp"
+#include "ngraph/runtime/cpu/op/fused_elementwise.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/type/bfloat16.hpp"
+#include "ngraph/type/float16.hpp"
+
+// Kernels over f16 and bf16 tensors. They load half precision values block by block, compute and
+// accumulate in f32 and store half precision results, so no f32 copy of a whole tensor is ever
+// made. The kernels selected with SELECT_KERNEL_HALF are specialized below for both types.
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                enum class HalfReduction
+                {
+                    SUM,
+                    PRODUCT,
+                    MAX,
+                    MIN
+                };
+
+                template <typename HalfType>
+                void half_elementwise(ngraph::op::FusedElementwise::Opcode opcode,
+                                      const void* input0,
+                                      const void* input1,
+                                      void* output,
+                                      size_t count,
+                                      int arena);
+
+                template <typename HalfType>
+                void half_reduce(HalfReduction reduction,
+                                 const void* arg,
+                                 void* out,
+                                 const Shape& in_shape,
+                                 const Shape& out_shape,
+                                 const AxisSet& reduction_axes);
+
+                /// \brief Dot over half precision tensors, computed in f32 tiles of the
+                ///        flattened M x K by K x N product
+                template <typename HalfType>
+                void half_dot(const void* arg0,
+                              const void* arg1,
+                              void* out,
+                              const Shape& arg0_shape,
+                              const Shape& arg1_shape,
+                              const Shape& out_shape,
+                              size_t reduction_axes_count,
+                              int arena);
+
+                template <typename ElementType>
+                typename std::enable_if<std::is_same<ElementType, float16>::value ||
+                                        std::is_same<ElementType, bfloat16>::value>::type
+                    divide(void* input0,
+                           void* input1,
+                           void* output,
+                           size_t count,
+                           bool /* pythondiv */,
+                           int arena)
+                {
+                    half_elementwise<ElementType>(ngraph::op::FusedElementwise::Opcode::DIVIDE,
+                                                  input0,
+                                                  input1,
+                                                  output,
+                                                  count,
+                                                  arena);
+                }
+
+#define HALF_UNARY_KERNEL(K, OPCODE, HALF)                                                         \
+    template <>                                                                                    \
+    inline void K<HALF>(void* input0, void* output, size_t count, int arena)                       \
+    {                                                                                              \
+        half_elementwise<HALF>(                                                                    \
+            ngraph::op::FusedElementwise::Opcode::OPCODE, input0, nullptr, output, count, arena);  \
+    }
+
+#define HALF_BINARY_KERNEL(K, OPCODE, HALF)                                                        \
+    template <>                                                                                    \
+    inline void K<HALF>(void* input0, void* input1, void* output, size_t count, int arena)         \
+    {                                                                                              \
+        half_elementwise<HALF>(                                                                    \
+            ngraph::op::FusedElementwise::Opcode::OPCODE, input0, input1, output, count, arena);   \
+    }
+
+#define HALF_REDUCTION_KERNEL(K, REDUCTION, HALF)                                                  \
+    template <>                                                                                    \
+    inline void K<HALF>(void* arg,                                                                 \
+                        void* out,                                                                 \
+                        const Shape& in_shape,                                                     \
+                        const Shape& out_shape,                                                    \
+                        const AxisSet& reduction_axes,                                             \
+                        int /* arena */)                                                           \
+    {                                                                                              \
+        half_reduce<HALF>(                                                                         \
+            HalfReduction::REDUCTION, arg, out, in_shape, out_shape, reduction_axes);              \
+    }
+
+#define HALF_CHECKED_SQRT_KERNEL(HALF)                                                             \
+    template <>                                                                                    \
+    inline void checked_sqrt<HALF>(void* input, void* output, size_t count, int arena)             \
+    {                                                                                              \
+        HALF* elts = static_cast<HALF*>(input);                                                    \
+        if (std::any_of(                                                                           \
+                elts, elts + count, [](HALF i) { return static_cast<float>(i) < 0.0f; }))          \
+        {                                                                                          \
+            throw ngraph_error("Square root of negative value");                                   \
+        }                                                                                          \
+        half_elementwise<HALF>(                                                                    \
+            ngraph::op::FusedElementwise::Opcode::SQRT, input, nullptr, output, count, arena);     \
+    }
+
+#define HALF_KERNELS(HALF)                                                                         \
+    HALF_BINARY_KERNEL(add, ADD, HALF)                                                             \
+    HALF_BINARY_KERNEL(subtract, SUBTRACT, HALF)                                                   \
+    HALF_BINARY_KERNEL(multiply, MULTIPLY, HALF)                                                   \
+    HALF_BINARY_KERNEL(maximum, MAXIMUM, HALF)                                                     \
+    HALF_BINARY_KERNEL(minimum, MINIMUM, HALF)                                                     \
+    HALF_UNARY_KERNEL(abs, ABS, HALF)                                                              \
+    HALF_UNARY_KERNEL(negative, NEGATIVE, HALF)                                                    \
+    HALF_UNARY_KERNEL(sqrt, SQRT, HALF)                                                            \
+    HALF_CHECKED_SQRT_KERNEL(HALF)                                                                 \
+    HALF_UNARY_KERNEL(exp, EXP, HALF)                                                              \
+    HALF_UNARY_KERNEL(log, LOG, HALF)                                                              \
+    HALF_UNARY_KERNEL(tanh, TANH, HALF)                                                            \
+    HALF_UNARY_KERNEL(relu, RELU, HALF)                                                            \
+    HALF_REDUCTION_KERNEL(sum, SUM, HALF)                                                          \
+    HALF_REDUCTION_KERNEL(product, PRODUCT, HALF)                                                  \
+    HALF_REDUCTION_KERNEL(max, MAX, HALF)                                                          \
+    HALF_REDUCTION_KERNEL(min, MIN, HALF)
+
+                HALF_KERNELS(float16)
+                HALF_KERNELS(bfloat16)
+
+#undef HALF_KERNELS
+#undef HALF_REDUCTION_KERNEL
+#undef HALF_CHECKED_SQRT_KERNEL
+#undef HALF_BINARY_KERNEL
+#undef HALF_UNARY_KERNEL
+            }
+        }
+    }
+}
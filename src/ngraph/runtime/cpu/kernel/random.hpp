@@ -0,0 +1,122 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/reference/generate_mask.hpp"
+#include "ngraph/runtime/reference/random_uniform.hpp"
+#include "ngraph/state/philox.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                constexpr size_t random_block_size = 16384;
+
+                // Calls generate_block(start, count) for blocks of [0, count) on the threads of
+                // the arena. Generators are counter based, so the values of a block depend only
+                // on its position and not on the number of threads.
+                template <typename BlockFunction>
+                void parallel_random_blocks(size_t count, int arena, BlockFunction generate_block)
+                {
+                    auto generate_blocks = [&](Eigen::Index first, Eigen::Index last) {
+                        size_t start = first * random_block_size;
+                        size_t end = std::min(count, static_cast<size_t>(last) * random_block_size);
+                        generate_block(start, end - start);
+                    };
+                    size_t num_blocks = (count + random_block_size - 1) / random_block_size;
+                    Eigen::TensorOpCost cost(0, random_block_size, 16 * random_block_size);
+                    executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        num_blocks, cost, generate_blocks);
+                }
+
+                template <typename T>
+                void generate_mask(
+                    T* out, size_t count, BernoulliRNGState* rng_state, bool training, int arena)
+                {
+                    if (!training)
+                    {
+                        std::fill(out, out + count, static_cast<T>(1));
+                        return;
+                    }
+                    uint64_t offset = rng_state->advance(count);
+                    parallel_random_blocks(count, arena, [&](size_t start, size_t n) {
+                        reference::generate_mask_range(out + start,
+                                                       n,
+                                                       rng_state->get_generator(),
+                                                       offset + start,
+                                                       rng_state->get_probability());
+                    });
+                }
+
+                template <typename T>
+                void generate_mask_no_state(
+                    T* out, size_t count, bool training, uint64_t seed, double prob, int arena)
+                {
+                    if (!training)
+                    {
+                        std::fill(out, out + count, static_cast<T>(1));
+                        return;
+                    }
+                    Philox4x32 generator(seed);
+                    parallel_random_blocks(count, arena, [&](size_t start, size_t n) {
+                        reference::generate_mask_range(out + start, n, generator, start, prob);
+                    });
+                }
+
+                template <typename T>
+                void random_uniform(T* out,
+                                    T min_val,
+                                    T max_val,
+                                    size_t count,
+                                    UniformRNGState* rng_state,
+                                    int arena)
+                {
+                    uint64_t offset = rng_state->advance(count);
+                    parallel_random_blocks(count, arena, [&](size_t start, size_t n) {
+                        reference::random_uniform_range(out + start,
+                                                        min_val,
+                                                        max_val,
+                                                        n,
+                                                        rng_state->get_generator(),
+                                                        offset + start);
+                    });
+                }
+
+                template <typename T>
+                void random_uniform_with_fixed_seed(
+                    T* out, T min_val, T max_val, size_t count, size_t fixed_seed, int arena)
+                {
+                    Philox4x32 generator(fixed_seed);
+                    parallel_random_blocks(count, arena, [&](size_t start, size_t n) {
+                        reference::random_uniform_range(
+                            out + start, min_val, max_val, n, generator, start);
+                    });
+                }
+            }
+        }
+    }
+}
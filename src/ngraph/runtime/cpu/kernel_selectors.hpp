@@ -27,6 +27,10 @@
 #define SELECT_KERNEL_RANK(KV, CIT, COT, R, K) EXPAND_RANK7(K, KV, R, KERNEL_CIT_COT_R, CIT, COT)
 #define SELECT_KERNEL_ET_RANK(KV, ET, R, K) EXPAND_ET11_AND_RANK7(K, KV, ET, R, KERNEL_CT_R)
 
+// All element types plus f16 and bf16. Use for kernels that have half precision
+// specializations in kernel/half_precision.hpp
+#define SELECT_KERNEL_HALF(KV, ET, K) EXPAND_ET13_FIXED_ARGS(K, KV, ET, KERNEL_CT)
+
 // Subset of element types and ranks. Use for more complex/larger kernels
 #define SELECT_RANK35_ET4(KV, ET, R1, R2, K)                                                       \
     EXPAND_RANK35_AND_ET4(K, KV, R1, R2, ET, KERNEL_CT_R1_R2)
@@ -172,6 +176,18 @@
     else                                                                                           \
         throw ngraph_error("Unsupported element type " + ET.c_type_string() + " for kernel " #K);
 
+#define EXPAND_ET13_FIXED_ARGS(K, KV, ET, S)                                                       \
+    if (ET == element::f16)                                                                        \
+    {                                                                                              \
+        EXPAND_MACRO(S(K, KV, float16));                                                           \
+    }                                                                                              \
+    else if (ET == element::bf16)                                                                  \
+    {                                                                                              \
+        EXPAND_MACRO(S(K, KV, bfloat16));                                                          \
+    }                                                                                              \
+    else                                                                                           \
+        EXPAND_ET11_FIXED_ARGS(K, KV, ET, S)
+
 // Expand only selected datatypes. Named macros (e.g., F32_SELECT) are expanded based on build-flags
 #define EXPAND_ETS(K, KV, ET, S)                                                                   \
     if (BOOLEAN_EN && ET == element::boolean)                                                      \
@@ -154,6 +154,20 @@ size_t MKLDNNEmitter::get_max_scratchpad_size() const
     return m_max_scratchpad_size;
 }
 
+size_t MKLDNNEmitter::get_num_scratchpad_users() const
+{
+    return m_num_scratchpad_users;
+}
+
+void MKLDNNEmitter::record_scratchpad_size(size_t size)
+{
+    m_max_scratchpad_size = size > m_max_scratchpad_size ? size : m_max_scratchpad_size;
+    if (size > 0)
+    {
+        m_num_scratchpad_users++;
+    }
+}
+
 mkldnn::memory::desc
     MKLDNNEmitter::build_blocked_memory_descriptor(const mkldnn::memory::dims& dim,
                                                    const mkldnn::memory::dims& strides,
@@ -1497,7 +1511,7 @@ size_t MKLDNNEmitter::query_scratchpad_sum(const mkldnn::sum::primitive_desc pd)
 {
     mkldnn::memory::desc scratchpad_md = pd.scratchpad_desc();
     auto size = scratchpad_md.get_size();
-    m_max_scratchpad_size = size > m_max_scratchpad_size ? size : m_max_scratchpad_size;
+    record_scratchpad_size(size);
     return size;
 }
 
@@ -1505,7 +1519,7 @@ size_t MKLDNNEmitter::query_scratchpad_concat(const mkldnn::concat::primitive_de
 {
     mkldnn::memory::desc scratchpad_md = pd.scratchpad_desc();
     auto size = scratchpad_md.get_size();
-    m_max_scratchpad_size = size > m_max_scratchpad_size ? size : m_max_scratchpad_size;
+    record_scratchpad_size(size);
     return size;
 }
 
@@ -1536,11 +1550,11 @@ size_t MKLDNNEmitter::query_scratchpad_max_pooling_backward(
         bwd_desc, attr, executor::global_cpu_engine, fwd_pd);
     mkldnn::memory::desc scratchpad_md = pd.scratchpad_desc();
     size_t size = scratchpad_md.get_size();
-    m_max_scratchpad_size = size > m_max_scratchpad_size ? size : m_max_scratchpad_size;
     mkldnn::memory::desc fwd_scratchpad_md = fwd_pd.scratchpad_desc();
     size_t f_size = fwd_scratchpad_md.get_size();
-    m_max_scratchpad_size = f_size > m_max_scratchpad_size ? f_size : m_max_scratchpad_size;
-    return size > f_size ? size : f_size;
+    size = size > f_size ? size : f_size;
+    record_scratchpad_size(size);
+    return size;
 }
 
 size_t MKLDNNEmitter::query_scratchpad_max_pooling_with_indices_backward(
@@ -154,6 +154,9 @@ namespace ngraph
                 size_t get_mkldnn_descriptors_size();
                 std::vector<size_t>& get_primitive_deps(size_t index);
                 size_t get_max_scratchpad_size() const;
+                /// \brief Number of scratchpad queries so far that returned a nonzero size. The
+                ///        primitives of all of them share the scratchpad buffer of a context.
+                size_t get_num_scratchpad_users() const;
 
                 size_t build_quantized_inner_product_forward(
                     const mkldnn::memory::desc& input_data_desc,
@@ -1820,6 +1823,8 @@ namespace ngraph
 #endif
 
             private:
+                void record_scratchpad_size(size_t size);
+
                 std::vector<mkldnn::memory*> m_mkldnn_memories;
                 std::vector<mkldnn::primitive*> m_mkldnn_primitives;
                 std::vector<mkldnn::stream> m_mkldnn_streams;
@@ -1830,6 +1835,7 @@ namespace ngraph
                 size_t m_workspaces_size = 0;
                 size_t m_mkldnn_descriptors_size = 0;
                 size_t m_max_scratchpad_size = 0;
+                size_t m_num_scratchpad_users = 0;
             };
         }
     }
@@ -86,7 +86,7 @@
 #define GET_SIZE                                                                                   \
     mkldnn::memory::desc scratchpad_md = pd.scratchpad_desc();                                     \
     size_t size = scratchpad_md.get_size();                                                        \
-    m_max_scratchpad_size = size > m_max_scratchpad_size ? size : m_max_scratchpad_size;           \
+    record_scratchpad_size(size);                                                                  \
     return size;
 
 #define MKLDNN_ERROR_MESSAGE std::string(e.message)
@@ -0,0 +1,107 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/op/fused_elementwise.hpp"
+#include "ngraph/shape_util.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr NodeTypeInfo op::FusedElementwise::type_info;
+
+op::FusedElementwise::FusedElementwise(const OutputVector& args,
+                                       const vector<AxisSet>& broadcast_axes,
+                                       const vector<Instruction>& instructions,
+                                       const vector<size_t>& results,
+                                       const Shape& shape)
+    : Op(args)
+    , m_broadcast_axes(broadcast_axes)
+    , m_instructions(instructions)
+    , m_results(results)
+    , m_shape(shape)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::FusedElementwise::validate_and_infer_types()
+{
+    size_t num_inputs = get_input_size();
+    NODE_VALIDATION_CHECK(this,
+                          m_broadcast_axes.size() == num_inputs,
+                          "Expected broadcast axes for each of the ",
+                          num_inputs,
+                          " inputs, got ",
+                          m_broadcast_axes.size());
+    NODE_VALIDATION_CHECK(this, num_inputs > 0, "Expected at least one input");
+
+    auto element_type = get_input_element_type(0);
+    for (size_t i = 0; i < num_inputs; i++)
+    {
+        NODE_VALIDATION_CHECK(this,
+                              get_input_element_type(i) == element_type,
+                              "Input ",
+                              i,
+                              " has element type ",
+                              get_input_element_type(i),
+                              ", expected ",
+                              element_type);
+        NODE_VALIDATION_CHECK(this,
+                              get_input_shape(i) == reduce(m_shape, m_broadcast_axes[i]),
+                              "Input ",
+                              i,
+                              " with shape ",
+                              get_input_shape(i),
+                              " cannot be broadcast to ",
+                              m_shape,
+                              " along axes ",
+                              m_broadcast_axes[i]);
+    }
+
+    for (size_t i = 0; i < m_instructions.size(); i++)
+    {
+        for (auto operand : m_instructions[i].operands)
+        {
+            NODE_VALIDATION_CHECK(this,
+                                  operand < num_inputs + i,
+                                  "Instruction ",
+                                  i,
+                                  " reads value ",
+                                  operand,
+                                  " before it is defined");
+        }
+    }
+
+    set_output_size(m_results.size());
+    for (size_t i = 0; i < m_results.size(); i++)
+    {
+        NODE_VALIDATION_CHECK(this,
+                              m_results[i] >= num_inputs &&
+                                  m_results[i] < num_inputs + m_instructions.size(),
+                              "Output ",
+                              i,
+                              " does not refer to an instruction: ",
+                              m_results[i]);
+        set_output_type(i, element_type, m_shape);
+    }
+}
+
+shared_ptr<Node> op::FusedElementwise::clone_with_new_inputs(const OutputVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<FusedElementwise>(
+        new_args, m_broadcast_axes, m_instructions, m_results, m_shape);
+}
@@ -0,0 +1,91 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/op/op.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief A group of elementwise operations evaluated in a single pass over memory.
+        ///
+        /// The group is a straight-line program. Its values are numbered with the inputs of the
+        /// op first, followed by the result of each instruction. Every value has the output
+        /// shape; an input with broadcast axes is broadcast to it on the fly, as the Broadcast
+        /// it replaces would have done. Each output of the op is the result of an instruction.
+        class FusedElementwise : public Op
+        {
+        public:
+            enum class Opcode
+            {
+                ADD,
+                SUBTRACT,
+                MULTIPLY,
+                DIVIDE,
+                MAXIMUM,
+                MINIMUM,
+                NEGATIVE,
+                ABS,
+                EXP,
+                LOG,
+                SQRT,
+                TANH,
+                SIGMOID,
+                RELU
+            };
+
+            struct Instruction
+            {
+                Opcode opcode;
+                std::vector<size_t> operands;
+            };
+
+            CPU_BACKEND_API
+            static constexpr NodeTypeInfo type_info{"FusedElementwise", 0};
+            const NodeTypeInfo& get_type_info() const override { return type_info; }
+            /// \brief Constructs a FusedElementwise operation.
+            ///
+            /// \param args The inputs of the group.
+            /// \param broadcast_axes The axes each input is broadcast along, empty if none.
+            /// \param instructions The program, in evaluation order.
+            /// \param results The value produced by each output.
+            /// \param shape The shape of every value in the group.
+            FusedElementwise(const OutputVector& args,
+                             const std::vector<AxisSet>& broadcast_axes,
+                             const std::vector<Instruction>& instructions,
+                             const std::vector<size_t>& results,
+                             const Shape& shape);
+
+            void validate_and_infer_types() override;
+
+            const std::vector<AxisSet>& get_broadcast_axes() const { return m_broadcast_axes; }
+            const std::vector<Instruction>& get_instructions() const { return m_instructions; }
+            const std::vector<size_t>& get_results() const { return m_results; }
+            virtual std::shared_ptr<Node>
+                clone_with_new_inputs(const OutputVector& new_args) const override;
+
+        private:
+            std::vector<AxisSet> m_broadcast_axes;
+            std::vector<Instruction> m_instructions;
+            std::vector<size_t> m_results;
+            Shape m_shape;
+        };
+    }
+}
@@ -0,0 +1,513 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/abs.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/exp.hpp"
+#include "ngraph/op/log.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/negative.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/op/sigmoid.hpp"
+#include "ngraph/op/sqrt.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/tanh.hpp"
+#include "ngraph/runtime/cpu/mkldnn_utils.hpp"
+#include "ngraph/runtime/cpu/op/fused_elementwise.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_elementwise_fusion.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+using Opcode = op::FusedElementwise::Opcode;
+
+// Each elementwise op in DEX mode is a separate kernel that streams its whole input and output
+// through memory, so a chain like Multiply->Add->Tanh->Multiply is bandwidth bound. This pass
+// grows groups of elementwise ops in topological order: an op joins the group of one of its
+// arguments if that cannot create a cycle, i.e. none of its other arguments depends on the
+// group through an op outside of it, counting the edges the other fused groups add.
+// Broadcasts feeding a group are not materialized; their arguments become broadcast inputs of
+// the group instead.
+//
+// The cycle check works on the graph of the ops visited so far with every group contracted
+// into one vertex. The vertices are kept in a topological order: an argument ordered before the
+// group cannot depend on it, and otherwise only the vertices ordered between the two are
+// searched. When an op joins a group, the order of those vertices is repaired the way the
+// Pearce-Kelly algorithm does for an inserted edge, so no check walks the whole graph.
+
+namespace
+{
+    struct Group
+    {
+        // In topological order
+        NodeVector members;
+        // The vertex of the group in ContractedGraph, the position of its first member
+        size_t vertex;
+    };
+
+    // The ops visited so far, in ordered_ops, with every group contracted into one vertex. A
+    // vertex is identified by the position of its op, or of the first member of its group.
+    class ContractedGraph
+    {
+    public:
+        ContractedGraph(const NodeVector& ops)
+            : m_ops(ops)
+            , m_order(ops.size())
+            , m_vertex_group(ops.size(), npos)
+            , m_marked(ops.size(), false)
+        {
+            for (size_t i = 0; i < ops.size(); i++)
+            {
+                m_positions[ops[i].get()] = i;
+            }
+        }
+
+        const vector<Group>& get_groups() const { return m_groups; }
+        // The group of node, or npos
+        size_t get_group(Node* node) const
+        {
+            auto it = m_group_of.find(node);
+            return it == m_group_of.end() ? npos : it->second;
+        }
+
+        // Makes the op at position visited, it follows every vertex in the order
+        void visit(size_t position)
+        {
+            m_order[position] = position;
+            m_visited = position + 1;
+        }
+
+        // Whether node, the op visited last, can join group without creating a cycle. If it
+        // can, the order is repaired to also hold once it did.
+        bool can_join(Node* node, size_t group)
+        {
+            size_t group_vertex = m_groups[group].vertex;
+            for (auto& input : node->inputs())
+            {
+                size_t vertex = get_vertex(input.get_source_output().get_node());
+                if (vertex != group_vertex && !add_edge(vertex, group_vertex))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // Puts the op visited last in a group of its own
+        size_t add_group(Node* node)
+        {
+            size_t position = m_positions.at(node);
+            m_groups.push_back({NodeVector{}, position});
+            m_vertex_group[position] = m_groups.size() - 1;
+            join(node, m_groups.size() - 1);
+            return m_groups.size() - 1;
+        }
+
+        void join(Node* node, size_t group)
+        {
+            m_groups[group].members.push_back(m_ops[m_positions.at(node)]);
+            m_group_of[node] = group;
+        }
+
+        static const size_t npos;
+
+    private:
+        size_t get_vertex(Node* node) const
+        {
+            size_t group = get_group(node);
+            return group == npos ? m_positions.at(node) : m_groups[group].vertex;
+        }
+
+        // Calls f with the vertex of every op that reads, or is read by when !successors, an op
+        // of vertex, ignoring ops that were not visited yet
+        template <typename F>
+        void for_each_neighbour(size_t vertex, bool successors, F f) const
+        {
+            auto visit_node = [&](Node* node) {
+                auto it = m_positions.find(node);
+                if (it != m_positions.end() && it->second < m_visited)
+                {
+                    f(get_vertex(node));
+                }
+            };
+            auto visit_members = [&](Node* member) {
+                if (successors)
+                {
+                    for (auto& output : member->outputs())
+                    {
+                        for (auto& input : output.get_target_inputs())
+                        {
+                            visit_node(input.get_node());
+                        }
+                    }
+                    for (Node* control_dependent : member->get_control_dependents())
+                    {
+                        visit_node(control_dependent);
+                    }
+                }
+                else
+                {
+                    for (auto& input : member->inputs())
+                    {
+                        visit_node(input.get_source_output().get_node());
+                    }
+                    for (auto& control_dependency : member->get_control_dependencies())
+                    {
+                        visit_node(control_dependency.get());
+                    }
+                }
+            };
+            if (m_vertex_group[vertex] == npos)
+            {
+                visit_members(m_ops[vertex].get());
+            }
+            else
+            {
+                for (auto& member : m_groups[m_vertex_group[vertex]].members)
+                {
+                    visit_members(member.get());
+                }
+            }
+        }
+
+        // Collects in region the vertices reachable from vertex, forwards or backwards, that
+        // are ordered strictly between lower and upper. Returns false if the search reaches
+        // stop.
+        bool search(size_t vertex,
+                    bool forwards,
+                    size_t lower,
+                    size_t upper,
+                    size_t stop,
+                    vector<size_t>& region)
+        {
+            size_t first = region.size();
+            vector<size_t> stack{vertex};
+            bool reached_stop = false;
+            while (!stack.empty() && !reached_stop)
+            {
+                size_t current = stack.back();
+                stack.pop_back();
+                for_each_neighbour(current, forwards, [&](size_t next) {
+                    if (next == stop)
+                    {
+                        reached_stop = true;
+                    }
+                    else if (!m_marked[next] && m_order[next] > lower && m_order[next] < upper)
+                    {
+                        m_marked[next] = true;
+                        region.push_back(next);
+                        stack.push_back(next);
+                    }
+                });
+            }
+            for (size_t i = first; i < region.size(); i++)
+            {
+                m_marked[region[i]] = false;
+            }
+            return !reached_stop;
+        }
+
+        // Inserts the edge from -> to into the order, false if it would close a cycle
+        bool add_edge(size_t from, size_t to)
+        {
+            size_t lower = m_order[to];
+            size_t upper = m_order[from];
+            if (upper < lower)
+            {
+                return true;
+            }
+            // Only the vertices between to and from in the order can be on a path between them
+            vector<size_t> forward_region{to};
+            if (!search(to, true, lower, upper, from, forward_region))
+            {
+                return false;
+            }
+            vector<size_t> backward_region{from};
+            search(from, false, lower, upper, npos, backward_region);
+
+            // from and what leads to it move ahead of to and what follows it, in the slots the
+            // two regions already held
+            auto by_order = [&](size_t a, size_t b) { return m_order[a] < m_order[b]; };
+            sort(forward_region.begin(), forward_region.end(), by_order);
+            sort(backward_region.begin(), backward_region.end(), by_order);
+            vector<size_t> slots;
+            for (size_t vertex : backward_region)
+            {
+                slots.push_back(m_order[vertex]);
+            }
+            for (size_t vertex : forward_region)
+            {
+                slots.push_back(m_order[vertex]);
+            }
+            sort(slots.begin(), slots.end());
+            size_t slot = 0;
+            for (size_t vertex : backward_region)
+            {
+                m_order[vertex] = slots[slot++];
+            }
+            for (size_t vertex : forward_region)
+            {
+                m_order[vertex] = slots[slot++];
+            }
+            return true;
+        }
+
+        const NodeVector& m_ops;
+        unordered_map<Node*, size_t> m_positions;
+        // Per vertex, its position in the topological order of the contracted graph
+        vector<size_t> m_order;
+        // Per vertex, its group or npos
+        vector<size_t> m_vertex_group;
+        vector<bool> m_marked;
+        vector<Group> m_groups;
+        unordered_map<Node*, size_t> m_group_of;
+        size_t m_visited{0};
+    };
+
+    const size_t ContractedGraph::npos = numeric_limits<size_t>::max();
+}
+
+static bool get_opcode(const Node* node, Opcode& opcode)
+{
+    static const unordered_map<NodeTypeInfo, Opcode> s_opcodes{
+        {op::Add::type_info, Opcode::ADD},
+        {op::Subtract::type_info, Opcode::SUBTRACT},
+        {op::Multiply::type_info, Opcode::MULTIPLY},
+        {op::Divide::type_info, Opcode::DIVIDE},
+        {op::Maximum::type_info, Opcode::MAXIMUM},
+        {op::Minimum::type_info, Opcode::MINIMUM},
+        {op::Negative::type_info, Opcode::NEGATIVE},
+        {op::Abs::type_info, Opcode::ABS},
+        {op::Exp::type_info, Opcode::EXP},
+        {op::Log::type_info, Opcode::LOG},
+        {op::Sqrt::type_info, Opcode::SQRT},
+        {op::Tanh::type_info, Opcode::TANH},
+        {op::Sigmoid::type_info, Opcode::SIGMOID},
+        {op::Relu::type_info, Opcode::RELU}};
+
+    auto it = s_opcodes.find(node->get_type_info());
+    if (it == s_opcodes.end())
+    {
+        return false;
+    }
+    opcode = it->second;
+    return true;
+}
+
+static bool is_fusible(const shared_ptr<Node>& node)
+{
+    Opcode opcode;
+    if (!get_opcode(node.get(), opcode) || node->get_output_size() != 1 ||
+        !node->get_control_dependencies().empty() || !node->get_control_dependents().empty() ||
+        node->get_output_partial_shape(0).is_dynamic())
+    {
+        return false;
+    }
+    auto element_type = node->get_output_element_type(0);
+    if (element_type != element::f32 && element_type != element::f64)
+    {
+        return false;
+    }
+
+    auto& shape = node->get_output_shape(0);
+    for (auto& input : node->inputs())
+    {
+        auto source = input.get_source_output();
+        if (source.get_shape() != shape)
+        {
+            return false;
+        }
+        // Chains of MKLDNN ops keep their blocked layouts, converting them to the native layout
+        // for the fused loop would cost more than the fusion saves
+        if (runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node.get()) &&
+            runtime::cpu::mkldnn_utils::use_mkldnn_kernel(source.get_node()))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// The value read by a group member, looking through a broadcast
+static Output<Node> get_group_input(const Input<Node>& input, AxisSet& broadcast_axes)
+{
+    auto source = input.get_source_output();
+    if (auto broadcast = as_type<op::Broadcast>(source.get_node()))
+    {
+        broadcast_axes = broadcast->get_broadcast_axes();
+        return broadcast->input_value(0);
+    }
+    broadcast_axes = AxisSet{};
+    return source;
+}
+
+bool runtime::cpu::pass::CPUElementwiseFusion::run_on_function(shared_ptr<Function> function)
+{
+    const size_t npos = ContractedGraph::npos;
+    auto ops = function->get_ordered_ops();
+    ContractedGraph graph(ops);
+    for (size_t i = 0; i < ops.size(); i++)
+    {
+        auto& node = ops[i];
+        graph.visit(i);
+        if (!is_fusible(node))
+        {
+            continue;
+        }
+
+        size_t target = npos;
+        for (auto& input : node->inputs())
+        {
+            size_t group = graph.get_group(input.get_source_output().get_node());
+            if (group == npos)
+            {
+                continue;
+            }
+            bool fusible = true;
+            for (auto& other : node->inputs())
+            {
+                // A broadcast of a member would have to be materialized inside the loop nest
+                AxisSet broadcast_axes;
+                Node* source = get_group_input(other, broadcast_axes).get_node();
+                if (graph.get_group(source) == group && !broadcast_axes.empty())
+                {
+                    fusible = false;
+                    break;
+                }
+            }
+            if (fusible && graph.can_join(node.get(), group))
+            {
+                target = group;
+                break;
+            }
+        }
+        if (target == npos)
+        {
+            graph.add_group(node.get());
+        }
+        else
+        {
+            graph.join(node.get(), target);
+        }
+    }
+
+    auto& groups = graph.get_groups();
+    bool replaced = false;
+    for (size_t group = 0; group < groups.size(); group++)
+    {
+        auto& members = groups[group].members;
+
+        OutputVector args;
+        vector<AxisSet> args_broadcast_axes;
+        auto find_arg = [&](const Output<Node>& value, const AxisSet& broadcast_axes) {
+            for (size_t i = 0; i < args.size(); i++)
+            {
+                if (args[i] == value && args_broadcast_axes[i] == broadcast_axes)
+                {
+                    return i;
+                }
+            }
+            return npos;
+        };
+        for (auto& member : members)
+        {
+            for (auto& input : member->inputs())
+            {
+                AxisSet broadcast_axes;
+                auto value = get_group_input(input, broadcast_axes);
+                bool internal =
+                    broadcast_axes.empty() && graph.get_group(value.get_node()) == group;
+                if (!internal && find_arg(value, broadcast_axes) == npos)
+                {
+                    args.push_back(value);
+                    args_broadcast_axes.push_back(broadcast_axes);
+                }
+            }
+        }
+
+        bool has_broadcast = false;
+        for (auto& broadcast_axes : args_broadcast_axes)
+        {
+            has_broadcast = has_broadcast || !broadcast_axes.empty();
+        }
+        // A single op is already one pass over memory unless it also absorbs a broadcast
+        if (members.size() < 2 && !has_broadcast)
+        {
+            continue;
+        }
+
+        unordered_map<Node*, size_t> value_of;
+        vector<op::FusedElementwise::Instruction> instructions;
+        vector<size_t> results;
+        NodeVector result_members;
+        for (auto& member : members)
+        {
+            op::FusedElementwise::Instruction instruction;
+            get_opcode(member.get(), instruction.opcode);
+            for (auto& input : member->inputs())
+            {
+                AxisSet broadcast_axes;
+                auto value = get_group_input(input, broadcast_axes);
+                auto it = value_of.find(value.get_node());
+                instruction.operands.push_back(broadcast_axes.empty() && it != value_of.end()
+                                                   ? it->second
+                                                   : find_arg(value, broadcast_axes));
+            }
+            value_of[member.get()] = args.size() + instructions.size();
+            instructions.push_back(instruction);
+
+            for (auto& input : member->output(0).get_target_inputs())
+            {
+                if (graph.get_group(input.get_node()) != group)
+                {
+                    results.push_back(value_of[member.get()]);
+                    result_members.push_back(member);
+                    break;
+                }
+            }
+        }
+
+        auto fused = make_shared<op::FusedElementwise>(args,
+                                                       args_broadcast_axes,
+                                                       instructions,
+                                                       results,
+                                                       members.front()->get_output_shape(0));
+        NGRAPH_DEBUG << "Fused " << members.size() << " elementwise ops into "
+                     << fused->get_name();
+        for (size_t i = 0; i < result_members.size(); i++)
+        {
+            for (auto& input : result_members[i]->output(0).get_target_inputs())
+            {
+                if (graph.get_group(input.get_node()) != group)
+                {
+                    input.replace_source_output(fused->output(i));
+                }
+            }
+        }
+        replaced = true;
+    }
+    return replaced;
+}
@@ -0,0 +1,236 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <map>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/abs.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/convert.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/exp.hpp"
+#include "ngraph/op/get_output_element.hpp"
+#include "ngraph/op/log.hpp"
+#include "ngraph/op/max.hpp"
+#include "ngraph/op/max_pool.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/min.hpp"
+#include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/negative.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/op/product.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/op/sqrt.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/sum.hpp"
+#include "ngraph/op/tanh.hpp"
+#include "ngraph/runtime/cpu/mkldnn_utils.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_half_precision_lowering.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Dot, the arithmetic reductions and the common elementwise ops have kernels that load half
+// precision values, compute in f32 and store half precision results (kernel/half_precision.hpp),
+// so they are left alone. The other CPU kernels are instantiated for f32 and wider types only.
+// Each other op that reads or writes a half precision value is cloned over f32 arguments, and
+// the half precision results are recovered with a narrowing Convert. Only a chain of lowered
+// elementwise ops passes the f32 values on directly; every other lowered op reads the half
+// precision value through a widening Convert, so the f32 copy of a result dies right after it is
+// narrowed and activations between ops are stored in half precision.
+
+namespace
+{
+    bool is_half(const element::Type& type)
+    {
+        return type == element::f16 || type == element::bf16;
+    }
+
+    // MKLDNN implements a few ops in bf16 on processors with native bf16 support
+    bool has_native_bf16_kernel(Node& node)
+    {
+        if (node.get_input_element_type(0) != element::bf16 ||
+            !runtime::cpu::mkldnn_utils::is_bf16_supported())
+        {
+            return false;
+        }
+        if (is_type<op::Convolution>(&node))
+        {
+            return runtime::cpu::mkldnn_utils::can_use_mkldnn_conv<op::Convolution>(&node);
+        }
+        if (auto max_pool = as_type<op::MaxPool>(&node))
+        {
+            auto rank = node.get_input_shape(0).size();
+            auto window_rank = max_pool->get_window_shape().size();
+            return (rank == 4 && window_rank == 2) || (rank == 5 && window_rank == 3);
+        }
+        return false;
+    }
+
+    // Ops with kernels over half precision tensors, see kernel/half_precision.hpp
+    bool has_native_half_kernel(Node& node)
+    {
+        if (!(is_type<op::Add>(&node) || is_type<op::Subtract>(&node) ||
+              is_type<op::Multiply>(&node) || is_type<op::Divide>(&node) ||
+              is_type<op::Maximum>(&node) || is_type<op::Minimum>(&node) ||
+              is_type<op::Abs>(&node) || is_type<op::Negative>(&node) || is_type<op::Sqrt>(&node) ||
+              is_type<op::Exp>(&node) || is_type<op::Log>(&node) || is_type<op::Tanh>(&node) ||
+              is_type<op::Relu>(&node) || is_type<op::Sum>(&node) || is_type<op::Product>(&node) ||
+              is_type<op::Max>(&node) || is_type<op::Min>(&node) || is_type<op::Dot>(&node)))
+        {
+            return false;
+        }
+        auto type = node.get_output_element_type(0);
+        for (auto& input : node.inputs())
+        {
+            if (input.get_element_type() != type)
+            {
+                return false;
+            }
+        }
+        return is_half(type);
+    }
+
+    bool needs_lowering(Node& node)
+    {
+        if (is_type<op::Parameter>(&node) || is_type<op::Result>(&node) ||
+            is_type<op::Constant>(&node) || is_type<op::Convert>(&node) ||
+            is_type<op::GetOutputElement>(&node))
+        {
+            return false;
+        }
+
+        bool uses_half = false;
+        for (auto& input : node.inputs())
+        {
+            uses_half = uses_half || is_half(input.get_element_type());
+        }
+        for (auto& output : node.outputs())
+        {
+            uses_half = uses_half || is_half(output.get_element_type());
+            for (auto& target : output.get_target_inputs())
+            {
+                // Outputs selected by index cannot be redirected to a Convert
+                if (is_type<op::GetOutputElement>(target.get_node()))
+                {
+                    return false;
+                }
+            }
+        }
+        return uses_half && !has_native_half_kernel(node) && !has_native_bf16_kernel(node);
+    }
+
+    bool is_elementwise(const Node& node)
+    {
+        return node.is_unary_elementwise_arithmetic() || node.is_binary_elementwise_arithmetic();
+    }
+}
+
+bool runtime::cpu::pass::CPUHalfPrecisionLowering::run_on_function(shared_ptr<Function> function)
+{
+    bool replaced = false;
+    // The f32 value behind each narrowing Convert inserted after an elementwise op
+    map<Output<Node>, Output<Node>> widened;
+
+    for (auto& node : function->get_ordered_ops())
+    {
+        if (!needs_lowering(*node))
+        {
+            continue;
+        }
+
+        // The clone is validated over f32 placeholders for the half precision arguments, so
+        // nothing is attached to the graph until the op is known to lower
+        OutputVector args;
+        for (auto& input : node->inputs())
+        {
+            auto value = input.get_source_output();
+            if (is_half(value.get_element_type()))
+            {
+                value = make_shared<op::Parameter>(element::f32, value.get_partial_shape());
+            }
+            args.push_back(value);
+        }
+
+        shared_ptr<Node> lowered;
+        try
+        {
+            lowered = node->copy_with_new_inputs(args);
+        }
+        catch (const ngraph_error& error)
+        {
+            NGRAPH_DEBUG << "Leaving " << node->get_name() << " in half precision: "
+                         << error.what();
+            continue;
+        }
+
+        bool lowers = true;
+        for (auto& output : node->outputs())
+        {
+            auto type = lowered->get_output_element_type(output.get_index());
+            // An output type that is an attribute of the op rather than following its arguments
+            // would stay half precision
+            lowers = lowers && (is_half(output.get_element_type())
+                                    ? type == element::f32
+                                    : type == output.get_element_type());
+        }
+        if (!lowers)
+        {
+            NGRAPH_DEBUG << "Leaving " << node->get_name() << " in half precision";
+            continue;
+        }
+
+        for (auto& input : node->inputs())
+        {
+            auto value = input.get_source_output();
+            if (is_half(value.get_element_type()))
+            {
+                auto it = is_elementwise(*node) ? widened.find(value) : widened.end();
+                lowered->input(input.get_index())
+                    .replace_source_output(
+                        it != widened.end()
+                            ? it->second
+                            : make_shared<op::Convert>(value, element::f32)->output(0));
+            }
+        }
+
+        OutputVector replacements;
+        for (auto& output : node->outputs())
+        {
+            auto value = lowered->output(output.get_index());
+            if (is_half(output.get_element_type()))
+            {
+                auto narrowed = make_shared<op::Convert>(value, output.get_element_type());
+                if (is_elementwise(*node))
+                {
+                    widened[narrowed->output(0)] = value;
+                }
+                value = narrowed->output(0);
+            }
+            replacements.push_back(value);
+        }
+
+        replace_node(node, replacements);
+        replaced = true;
+    }
+    return replaced;
+}
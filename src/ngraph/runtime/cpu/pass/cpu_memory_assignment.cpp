@@ -36,9 +36,11 @@ runtime::cpu::pass::CPUMemoryAssignment::CPUMemoryAssignment(
         bufferID_to_tensorSets,
     unordered_map<descriptor::Tensor*, size_t>& tensor_to_bufferID,
     size_t alignment,
-    bool disable_memory_sharing)
+    bool disable_memory_sharing,
+    chrono::microseconds planning_budget)
     : m_alignment(alignment)
     , m_disable_memory_sharing(disable_memory_sharing)
+    , m_planning_budget(planning_budget)
     , m_bufferID_to_tensorSets(bufferID_to_tensorSets)
     , m_tensor_to_bufferID(tensor_to_bufferID)
 {
@@ -585,7 +587,7 @@ void runtime::cpu::pass::CPUMemoryAssignment::liveness_analysis(
     for (auto it = ops.begin(); it != ops.end(); it++)
     {
         const shared_ptr<Node>& node = *it;
-        node->liveness_new_list.clear();
+        node->get_liveness_new_list().clear();
 
         for (auto node_output : node->outputs())
         {
@@ -593,7 +595,7 @@ void runtime::cpu::pass::CPUMemoryAssignment::liveness_analysis(
             auto bufferID = get_bufferID(tensor);
             if (allocated_sets.find(bufferID) == allocated_sets.end())
             {
-                node->liveness_new_list.insert(tensor);
+                node->get_liveness_new_list().insert(tensor);
                 allocated_sets.insert(bufferID);
             }
         }
@@ -603,7 +605,7 @@ void runtime::cpu::pass::CPUMemoryAssignment::liveness_analysis(
     for (auto it = ops.rbegin(); it != ops.rend(); it++)
     {
         const shared_ptr<Node>& node = *it;
-        node->liveness_free_list.clear();
+        node->get_liveness_free_list().clear();
 
         for (auto input_value : node->input_values())
         {
@@ -611,7 +613,7 @@ void runtime::cpu::pass::CPUMemoryAssignment::liveness_analysis(
             auto bufferID = get_bufferID(tensor);
             if (freed_sets.find(bufferID) == freed_sets.end())
             {
-                node->liveness_free_list.insert(tensor);
+                node->get_liveness_free_list().insert(tensor);
                 freed_sets.insert(bufferID);
             }
         }
@@ -627,8 +629,11 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
 
     // memory assignment using liveness analysis result
 
-    // memory manager for non-cacheable ops, memory allocation will be freed when not longer in use
-    ngraph::pass::MemoryManager mm(m_alignment, m_disable_memory_sharing);
+    // planner for non-cacheable ops, buffers are placed once every lifetime is known and share
+    // memory when their lifetimes do not overlap
+    ngraph::pass::StaticMemoryPlanner planner(m_alignment, m_planning_budget);
+    // bufferID -> planner buffer, a destructive oi pair maps the output set to the input buffer
+    unordered_map<size_t, size_t> planned_buffers;
     // memory manager for cacheable ops, memory allocation will never be freed
     ngraph::pass::MemoryManager mm_caching(m_alignment, true);
 
@@ -657,8 +662,9 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
         }
     }
 
-    for (shared_ptr<Node> node : function->get_ordered_ops())
+    for (size_t step = 0; step < ops.size(); step++)
     {
+        const shared_ptr<Node>& node = ops[step];
         if (node->is_parameter() || node->is_constant() || node->is_output())
         {
             continue;
@@ -676,8 +682,9 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
                 auto input_tensor = &node->input_value(oi_pair.input).get_tensor();
                 auto input_op = node->input_value(oi_pair.input).get_node_shared_ptr();
 
-                if (oi_pair.destructive && node->liveness_free_list.count(input_tensor) != 0 &&
-                    node->liveness_new_list.count(output_tensor) != 0)
+                if (oi_pair.destructive &&
+                    node->get_liveness_free_list().count(input_tensor) != 0 &&
+                    node->get_liveness_new_list().count(output_tensor) != 0)
                 {
                     if (auto input_op_annotations = input_op->get_op_annotations())
                     {
@@ -756,15 +763,25 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
                     // do not combine those two sets.
                     // change the label of output tensor set to that of input tensor set
                     output_buffer_it->second.first = input_buffer_it->second.first;
-                    for (auto& ele_t : output_set)
+                    auto planned_input = planned_buffers.find(input_bufferID);
+                    if (planned_input != planned_buffers.end())
                     {
-                        ele_t->set_pool_offset(offset);
+                        // the output set gets its offset when the input buffer is placed
+                        size_t buffer = planned_input->second;
+                        planned_buffers[output_bufferID] = buffer;
+                    }
+                    else
+                    {
+                        for (auto& ele_t : output_set)
+                        {
+                            ele_t->set_pool_offset(offset);
+                        }
                     }
                 }
             }
         }
 
-        for (descriptor::Tensor* tensor : node->liveness_new_list)
+        for (descriptor::Tensor* tensor : node->get_liveness_new_list())
         {
             if (no_new.find(tensor) != no_new.end())
             {
@@ -786,22 +803,22 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
             if (m_tensor_caching.count(tensor) != 0)
             {
                 offset = mm_caching.allocate(size);
+                tensor->set_pool_offset(offset);
+                for (auto& e : tensor_set)
+                {
+                    e->set_pool_offset(offset);
+                }
             }
             else
             {
-                offset = mm.allocate(size);
-            }
-            tensor->set_pool_offset(offset);
-            for (auto& e : tensor_set)
-            {
-                e->set_pool_offset(offset);
+                planned_buffers[bufferID] = planner.add_buffer(size, step);
             }
         }
 
         // when reusing memory, free when done
         if (!m_disable_memory_sharing && node->is_op())
         {
-            for (descriptor::Tensor* tensor : node->liveness_free_list)
+            for (descriptor::Tensor* tensor : node->get_liveness_free_list())
             {
                 if (no_free.find(tensor) != no_free.end())
                 {
@@ -810,12 +827,27 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
                 if (m_tensor_caching.empty() ||
                     (!m_tensor_caching.empty() && m_tensor_caching.count(tensor) == 0))
                 {
-                    mm.free(tensor->get_pool_offset());
+                    planner.set_last_use(planned_buffers.at(get_bufferID(tensor)), step);
                 }
             }
         }
     }
 
+    planner.plan();
+    for (auto& planned : planned_buffers)
+    {
+        auto buffer_it = m_bufferID_to_tensorSets.find(planned.first);
+        NGRAPH_CHECK(buffer_it != m_bufferID_to_tensorSets.end());
+        for (auto& ele_t : buffer_it->second.second)
+        {
+            ele_t->set_pool_offset(planner.get_offset(planned.second));
+        }
+    }
+    m_report = planner.get_report();
+    stringstream report;
+    planner.dump(report);
+    NGRAPH_DEBUG << "cpu_memory_assignment: " << report.str();
+
     // update offsets in concat and slice tensors set.
     // In place concatenation optimization
     process_in_place_concat(ops);
@@ -824,7 +856,7 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
     process_in_place_slice(ops);
 
     // update the offset for intermediate tensors in tensor_caching
-    auto start = mm.max_allocated();
+    auto start = planner.max_allocated();
     for (auto item : m_tensor_caching)
     {
         auto bufferID = get_bufferID(item);
@@ -838,13 +870,14 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
         }
     }
 
-    NGRAPH_DEBUG << "cpu_memory_assignemnt: max allocated for mm is " << mm.max_allocated();
+    NGRAPH_DEBUG << "cpu_memory_assignment: max allocated for planner is "
+                 << planner.max_allocated();
     NGRAPH_DEBUG << "cpu_memory_assignment: max allocated for mm_caching is "
                  << mm_caching.max_allocated();
     NGRAPH_DEBUG << "cpu_memory_assignment: max allocated in total is "
-                 << mm.max_allocated() + mm_caching.max_allocated();
+                 << planner.max_allocated() + mm_caching.max_allocated();
 
-    function->set_temporary_pool_size(mm.max_allocated() + mm_caching.max_allocated());
+    function->set_temporary_pool_size(planner.max_allocated() + mm_caching.max_allocated());
 
     return false;
 }
@@ -22,6 +22,7 @@
 #include <unordered_map>
 #include <unordered_set>
 
+#include "ngraph/pass/memory_layout.hpp"
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/util.hpp"
 
@@ -45,9 +46,14 @@ public:
         std::unordered_map<size_t, std::pair<TensorRole, std::unordered_set<descriptor::Tensor*>>>&,
         std::unordered_map<descriptor::Tensor*, size_t>&,
         size_t alignment = 1,
-        bool disable_memory_sharing = false);
+        bool disable_memory_sharing = false,
+        std::chrono::microseconds planning_budget =
+            ngraph::pass::StaticMemoryPlanner::get_default_time_budget());
     bool run_on_function(std::shared_ptr<ngraph::Function>) override;
 
+    /// \brief The report of the plan made for the non-cacheable buffers of the last function
+    const ngraph::pass::StaticMemoryPlanner::Report& get_report() const { return m_report; }
+
 private:
     // Find in-place concat ops and set appropriate memory pool offset for its arguments
     void process_in_place_concat(std::vector<std::shared_ptr<Node>> nodes);
@@ -71,6 +77,8 @@ private:
 
     size_t m_alignment;
     bool m_disable_memory_sharing;
+    std::chrono::microseconds m_planning_budget;
+    ngraph::pass::StaticMemoryPlanner::Report m_report;
     std::set<descriptor::Tensor*> m_tensor_caching;
     std::unordered_map<size_t,
                        std::pair<ngraph::TensorRole, std::unordered_set<descriptor::Tensor*>>>&
@@ -14,8 +14,14 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <limits>
+
 #include "ngraph/runtime/dynamic/dynamic_backend.hpp"
 #include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
 #include "ngraph/op/avg_pool.hpp"
 #include "ngraph/op/broadcast.hpp"
 #include "ngraph/op/convolution.hpp"
@@ -110,213 +116,524 @@ static size_t count_dyn_nodes(const shared_ptr<ngraph::Function>& f)
     return count;
 }
 
-bool runtime::dynamic::DynamicExecutable::call(
-    const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
-    const std::vector<std::shared_ptr<runtime::Tensor>>& inputs)
+// Estimated footprint of a compiled clone, used for the cache byte budget
+static size_t estimate_size_in_bytes(const shared_ptr<Function>& f)
 {
-    // TODO: Get cached executable out if it exists.
-    // We will cache on:
-    // (1) all shapes;
-    // (2) all values of shape-relevant input tensors.
+    size_t size = 0;
+    for (auto& op : f->get_ops())
+    {
+        for (size_t i = 0; i < op->get_output_size(); i++)
+        {
+            size += shape_size(op->get_output_shape(i)) * op->get_output_element_type(i).size();
+        }
+    }
+    return size;
+}
+
+// Copy the leading `region` of a row-major tensor into another row-major tensor. Used to pad
+// inputs up to a bucket shape and to slice padded outputs back down.
+static void copy_region(const char* src,
+                        const Shape& src_shape,
+                        char* dst,
+                        const Shape& dst_shape,
+                        const Shape& region,
+                        size_t element_size)
+{
+    size_t rank = region.size();
+    if (rank == 0)
+    {
+        memcpy(dst, src, element_size);
+        return;
+    }
+    if (shape_size(region) == 0)
+    {
+        return;
+    }
 
-    std::vector<int> merged_input_shapes;
-    std::ostringstream key;
-    size_t loop_count = 0;
-    for (auto& input : inputs)
+    auto src_strides = row_major_strides(src_shape);
+    auto dst_strides = row_major_strides(dst_shape);
+    size_t row_bytes = region[rank - 1] * element_size;
+    vector<size_t> index(rank - 1, 0);
+    while (true)
     {
-        if (m_wrapped_function->get_parameters()[loop_count]->is_relevant_to_shapes())
+        size_t src_offset = 0;
+        size_t dst_offset = 0;
+        for (size_t d = 0; d < rank - 1; d++)
         {
-            // Caching on values of Shape relevant inputs
-            int size = input->get_size_in_bytes() / (input->get_element_type().bitwidth() / 8);
-            std::vector<int64_t> data(size);
-            input->read(data.data(), input->get_size_in_bytes());
-            for (int i = 0; i < input->get_element_count(); i++)
-            {
-                merged_input_shapes.emplace_back(data[i]);
-            }
+            src_offset += index[d] * src_strides[d];
+            dst_offset += index[d] * dst_strides[d];
         }
-        else
+        memcpy(dst + dst_offset * element_size, src + src_offset * element_size, row_bytes);
+
+        size_t d = rank - 1;
+        while (d > 0 && ++index[d - 1] == region[d - 1])
         {
-            // Caching on all remaining shapes
-            for (int i = 0; i < input->get_shape().size(); i++)
-            {
-                merged_input_shapes.emplace_back(input->get_shape()[i]);
-            }
+            index[d - 1] = 0;
+            d--;
+        }
+        if (d == 0)
+        {
+            break;
         }
-        // -1 is the separator.
-        // So if shape of Input 1 = {2, 2, 3, 3} & Input 2 = {4, 5}
-        // the key would be 2, 2, 3, 3, -1, 4, 5, -1
-        merged_input_shapes.emplace_back(-1);
-        loop_count++;
+    }
+}
+
+struct runtime::dynamic::DynamicExecutable::Specialization
+{
+    vector<element::Type> element_types;
+    vector<Shape> shapes;
+    // Values of the shape-relevant inputs, nullptr for all others
+    vector<shared_ptr<AlignedBuffer>> values;
+};
+
+runtime::dynamic::DynamicExecutable::~DynamicExecutable()
+{
+    wait_for_compilations();
+}
+
+void runtime::dynamic::DynamicExecutable::set_shape_buckets(
+    size_t parameter_index,
+    size_t axis,
+    const vector<size_t>& edges,
+    const vector<pair<size_t, size_t>>& output_axes)
+{
+    auto& parameters = m_wrapped_function->get_parameters();
+    NGRAPH_CHECK(parameter_index < parameters.size(),
+                 "Shape buckets: parameter index ",
+                 parameter_index,
+                 " is out of range");
+    NGRAPH_CHECK(!parameters[parameter_index]->is_relevant_to_shapes(),
+                 "Shape buckets: values of parameter ",
+                 parameter_index,
+                 " are relevant to shapes and cannot be padded");
+    NGRAPH_CHECK(!edges.empty(), "Shape buckets: no bucket edges given");
+    for (auto& output_axis : output_axes)
+    {
+        NGRAPH_CHECK(output_axis.first < get_results().size(),
+                     "Shape buckets: result index ",
+                     output_axis.first,
+                     " is out of range");
     }
 
-    std::copy(merged_input_shapes.begin(),
-              merged_input_shapes.end(),
-              std::ostream_iterator<int>(key, ", "));
+    ShapeBuckets buckets{parameter_index, axis, edges, output_axes};
+    sort(buckets.edges.begin(), buckets.edges.end());
+    buckets.edges.erase(unique(buckets.edges.begin(), buckets.edges.end()), buckets.edges.end());
+
+    wait_for_compilations();
+    m_shape_buckets.erase(remove_if(m_shape_buckets.begin(),
+                                    m_shape_buckets.end(),
+                                    [&](const ShapeBuckets& b) {
+                                        return b.parameter_index == parameter_index &&
+                                               b.axis == axis;
+                                    }),
+                          m_shape_buckets.end());
+    m_shape_buckets.push_back(buckets);
+}
 
-    if (m_lru->is_cached(merged_input_shapes))
+void runtime::dynamic::DynamicExecutable::wait_for_compilations()
+{
+    while (true)
     {
-        std::vector<std::shared_ptr<runtime::Tensor>> wrapped_inputs;
-        std::vector<std::shared_ptr<runtime::Tensor>> wrapped_outputs;
+        list<future<void>> compilations;
+        {
+            lock_guard<mutex> lock(m_compile_mutex);
+            compilations.swap(m_compilations);
+        }
+        if (compilations.empty())
+        {
+            break;
+        }
+        for (auto& compilation : compilations)
+        {
+            compilation.wait();
+        }
+    }
+}
 
-        std::shared_ptr<Function> clone = m_lru->get_cloned_function(merged_input_shapes);
-        const ResultVector& results = clone->get_results();
-        for (auto& result : results)
+vector<Shape>
+    runtime::dynamic::DynamicExecutable::get_bucket_shapes(const vector<Shape>& input_shapes) const
+{
+    vector<Shape> shapes = input_shapes;
+    for (auto& buckets : m_shape_buckets)
+    {
+        Shape& shape = shapes[buckets.parameter_index];
+        NGRAPH_CHECK(buckets.axis < shape.size(),
+                     "Shape buckets: axis ",
+                     buckets.axis,
+                     " is out of range for input ",
+                     buckets.parameter_index,
+                     " with shape ",
+                     shape);
+        auto edge = lower_bound(buckets.edges.begin(), buckets.edges.end(), shape[buckets.axis]);
+        if (edge != buckets.edges.end())
         {
-            NGRAPH_CHECK(result->get_output_partial_shape(0).is_static(),
-                         "Shape staticization failed for result node ",
-                         *result);
+            shape[buckets.axis] = *edge;
         }
-        NGRAPH_CHECK(results.size() == outputs.size());
+    }
+    return shapes;
+}
 
-        for (size_t i = 0; i < outputs.size(); i++)
+vector<int>
+    runtime::dynamic::DynamicExecutable::get_cache_key(const Specialization& specialization) const
+{
+    // We cache on:
+    // (1) all shapes;
+    // (2) all values of shape-relevant input tensors.
+    //
+    // -1 is the separator.
+    // So if shape of Input 1 = {2, 2, 3, 3} & Input 2 = {4, 5}
+    // the key would be 2, 2, 3, 3, -1, 4, 5, -1
+    vector<int> key;
+    for (size_t i = 0; i < specialization.shapes.size(); i++)
+    {
+        if (auto& value = specialization.values[i])
         {
-            if (auto dynamic_tensor =
-                    std::dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(outputs[i]))
-            {
-                dynamic_tensor->make_storage(results[i]->get_output_element_type(0),
-                                             results[i]->get_output_shape(0));
-                wrapped_outputs.push_back(dynamic_tensor->get_wrapped_tensor());
-            }
-            else
+            // Caching on the bytes of shape-relevant inputs, so any element type works
+            auto data = static_cast<const uint8_t*>(value->get_ptr());
+            key.insert(key.end(), data, data + value->size());
+        }
+        else
+        {
+            for (auto dim : specialization.shapes[i])
             {
-                wrapped_outputs.push_back(outputs[i]);
+                key.push_back(static_cast<int>(dim));
             }
         }
-
-        return m_lru->get_cached_entry(merged_input_shapes)->call(wrapped_outputs, inputs);
+        key.push_back(-1);
     }
-    else
+    return key;
+}
+
+void runtime::dynamic::DynamicExecutable::compile(const Specialization& specialization,
+                                                  shared_ptr<Executable>& exec,
+                                                  shared_ptr<Function>& clone)
+{
+    vector<PartialShape> arg_shapes(specialization.shapes.begin(), specialization.shapes.end());
+    vector<void*> arg_value_base_pointers;
+    for (auto& value : specialization.values)
     {
-        NGRAPH_CHECK(m_wrapped_function->get_parameters().size() == inputs.size());
+        arg_value_base_pointers.push_back(value ? value->get_ptr() : nullptr);
+    }
 
-        std::vector<std::shared_ptr<runtime::Tensor>> wrapped_inputs;
-        std::vector<element::Type> arg_element_types;
-        std::vector<PartialShape> arg_shapes;
+    clone = specialize_function(
+        m_wrapped_function, specialization.element_types, arg_shapes, arg_value_base_pointers);
 
-        std::shared_ptr<Function> clone;
-        {
-            // We'll use AlignedBuffers to back the base pointers, storing them in this vector for
-            // RAII
-            // purposes.
-            std::vector<AlignedBuffer> arg_buffers;
-            arg_buffers.reserve(inputs.size());
-            std::vector<void*> arg_value_base_pointers(inputs.size());
+    pass::Manager passes;
+    passes.register_pass<pass::ConstantFolding>();
+    passes.register_pass<pass::DynElimination>();
+    passes.register_pass<pass::Opset0Downgrade>(); // Converts dynamic v1 variants to v0 ops
+    passes.set_per_pass_validation(false);
+
+    // FIXME(amprocte): Vile, temporary hack: we need to do repeated rounds of
+    // ConstantFolding/DynElimination until everything that DynElimination is supposed to
+    // eliminate has actually been eliminated. We could do this by monitoring the return values
+    // of the passes (keep iterating until both CF and DE report no changes), but that did not
+    // seem to work so here we are. Probably a better fix is to somehow combine the matchers in
+    // CF
+    // and DE into one pass.
+    size_t num_dyn_nodes_last_pass = std::numeric_limits<size_t>::max();
+
+    while (num_dyn_nodes_last_pass != 0)
+    {
+        passes.run_passes(clone);
+        auto num_dyn_nodes_this_pass = count_dyn_nodes(clone);
 
-            size_t i = 0;
+        NGRAPH_CHECK(num_dyn_nodes_this_pass < num_dyn_nodes_last_pass,
+                     "Could not eliminate all Dyn nodes (",
+                     num_dyn_nodes_this_pass,
+                     " remaining)");
 
-            for (auto& input : inputs)
-            {
-                if (m_wrapped_function->get_parameters()[i]->is_relevant_to_shapes())
-                {
-                    // TODO(amprocte): Move has_storage() to runtime::Tensor?
-                    if (auto dynamic_tensor =
-                            std::dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(input))
-                    {
-                        NGRAPH_CHECK(dynamic_tensor->has_storage());
-                    }
-
-                    arg_buffers.emplace_back(input->get_size_in_bytes(), /*alignment=*/64);
-                    arg_value_base_pointers[i] = arg_buffers.back().get_ptr();
-
-                    // TODO(amprocte): For host-resident tensors we should be able to skip the read,
-                    // but no API for that yet.
-                    input->read(arg_value_base_pointers[i], input->get_size_in_bytes());
-                }
-                else
-                {
-                    arg_value_base_pointers[i] = nullptr;
-                }
+        num_dyn_nodes_last_pass = num_dyn_nodes_this_pass;
+    }
 
-                if (auto dynamic_tensor =
-                        std::dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(input))
-                {
-                    NGRAPH_CHECK(dynamic_tensor->has_storage());
-                    arg_element_types.push_back(
-                        dynamic_tensor->get_wrapped_tensor()->get_element_type());
-                    arg_shapes.push_back(dynamic_tensor->get_wrapped_tensor()->get_shape());
-                    wrapped_inputs.push_back(dynamic_tensor->get_wrapped_tensor());
-                }
-                else
-                {
-                    arg_element_types.push_back(input->get_element_type());
-                    arg_shapes.push_back(input->get_shape());
-                    wrapped_inputs.push_back(input);
-                }
+    pass::Manager pass_val;
+    pass_val.register_pass<pass::Validate>();
+    pass_val.run_passes(clone);
 
-                i++;
-            }
+    for (auto& result : clone->get_results())
+    {
+        NGRAPH_CHECK(result->get_output_partial_shape(0).is_static(),
+                     "Shape staticization failed for result node ",
+                     *result);
+    }
 
-            clone = specialize_function(
-                m_wrapped_function, arg_element_types, arg_shapes, arg_value_base_pointers);
+    exec = m_wrapped_backend->compile(clone, m_enable_performance_collection);
+    // Put compiled executable in the cache.
+    m_lru->add_entry(
+        get_cache_key(specialization), exec, clone, estimate_size_in_bytes(clone));
+}
+
+void runtime::dynamic::DynamicExecutable::compile_in_background(
+    const shared_ptr<Specialization>& specialization)
+{
+    auto key = get_cache_key(*specialization);
+    lock_guard<mutex> lock(m_compile_mutex);
+    if (!m_compiling.insert(key).second)
+    {
+        // This bucket is already being compiled
+        return;
+    }
+    m_compilations.remove_if([](const future<void>& compilation) {
+        return compilation.wait_for(chrono::seconds(0)) == future_status::ready;
+    });
+    m_compilations.push_back(async(launch::async, [this, specialization, key]() {
+        try
+        {
+            shared_ptr<Executable> exec;
+            shared_ptr<Function> clone;
+            compile(*specialization, exec, clone);
+        }
+        catch (const exception& e)
+        {
+            NGRAPH_WARN << "Background compilation failed, the next call will retry: "
+                        << e.what();
         }
+        lock_guard<mutex> compile_lock(m_compile_mutex);
+        m_compiling.erase(key);
+    }));
+}
 
-        pass::Manager passes;
-        passes.register_pass<pass::ConstantFolding>();
-        passes.register_pass<pass::DynElimination>();
-        passes.register_pass<pass::Opset0Downgrade>(); // Converts dynamic v1 variants to v0 ops
-        passes.set_per_pass_validation(false);
+bool runtime::dynamic::DynamicExecutable::find_larger_bucket(const Specialization& specialization,
+                                                             shared_ptr<Executable>& exec,
+                                                             shared_ptr<Function>& clone,
+                                                             vector<Shape>& shapes)
+{
+    // Position in the cache key of every bucketed dimension. Inputs keyed on their values
+    // cannot be padded, their dimensions are not in the key.
+    vector<size_t> key_offsets(specialization.shapes.size());
+    for (size_t i = 0, offset = 0; i < specialization.shapes.size(); i++)
+    {
+        key_offsets[i] = offset;
+        auto& value = specialization.values[i];
+        offset += (value ? value->size() : specialization.shapes[i].size()) + 1;
+    }
+    vector<const ShapeBuckets*> buckets;
+    vector<size_t> positions;
+    for (auto& shape_buckets : m_shape_buckets)
+    {
+        if (!specialization.values[shape_buckets.parameter_index])
+        {
+            buckets.push_back(&shape_buckets);
+            positions.push_back(key_offsets[shape_buckets.parameter_index] + shape_buckets.axis);
+        }
+    }
+    if (buckets.empty())
+    {
+        return false;
+    }
 
-        // FIXME(amprocte): Vile, temporary hack: we need to do repeated rounds of
-        // ConstantFolding/DynElimination until everything that DynElimination is supposed to
-        // eliminate has actually been eliminated. We could do this by monitoring the return values
-        // of the passes (keep iterating until both CF and DE report no changes), but that did not
-        // seem to work so here we are. Probably a better fix is to somehow combine the matchers in
-        // CF
-        // and DE into one pass.
-        size_t num_dyn_nodes_last_pass = std::numeric_limits<size_t>::max();
+    // A cached entry can serve this call when its key only differs in bucketed dimensions that
+    // are at least as large, keep the one with the fewest padded elements
+    auto key = get_cache_key(specialization);
+    vector<bool> is_bucketed(key.size(), false);
+    for (size_t position : positions)
+    {
+        is_bucketed[position] = true;
+    }
+    vector<int> best_key;
+    size_t best_size = numeric_limits<size_t>::max();
+    for (auto& cached_key : m_lru->get_cached_keys())
+    {
+        if (cached_key.size() != key.size())
+        {
+            continue;
+        }
+        bool fits = true;
+        for (size_t i = 0; fits && i < key.size(); i++)
+        {
+            fits = is_bucketed[i] ? cached_key[i] >= key[i] : cached_key[i] == key[i];
+        }
+        for (size_t b = 0; fits && b < buckets.size(); b++)
+        {
+            // Beyond the last edge only the exact size fits
+            size_t dim = static_cast<size_t>(key[positions[b]]);
+            fits = dim <= buckets[b]->edges.back() || cached_key[positions[b]] == key[positions[b]];
+        }
+        if (!fits)
+        {
+            continue;
+        }
 
-        while (num_dyn_nodes_last_pass != 0)
+        vector<Shape> candidate_shapes = specialization.shapes;
+        for (size_t b = 0; b < buckets.size(); b++)
+        {
+            candidate_shapes[buckets[b]->parameter_index][buckets[b]->axis] =
+                static_cast<size_t>(cached_key[positions[b]]);
+        }
+        size_t size = 0;
+        for (auto& shape : candidate_shapes)
+        {
+            size += shape_size(shape);
+        }
+        if (size < best_size)
         {
-            passes.run_passes(clone);
-            auto num_dyn_nodes_this_pass = count_dyn_nodes(clone);
+            best_key = cached_key;
+            best_size = size;
+            shapes = candidate_shapes;
+        }
+    }
+
+    // The entry may have been evicted since it was probed
+    return !best_key.empty() && m_lru->get_entry(best_key, exec, clone);
+}
+
+bool runtime::dynamic::DynamicExecutable::call(
+    const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+    const std::vector<std::shared_ptr<runtime::Tensor>>& inputs)
+{
+    NGRAPH_CHECK(m_wrapped_function->get_parameters().size() == inputs.size());
 
-            NGRAPH_CHECK(num_dyn_nodes_this_pass < num_dyn_nodes_last_pass,
-                         "Could not eliminate all Dyn nodes (",
-                         num_dyn_nodes_this_pass,
-                         " remaining)");
+    auto specialization = make_shared<Specialization>();
+    std::vector<std::shared_ptr<runtime::Tensor>> wrapped_inputs;
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        auto input = inputs[i];
+        // TODO(amprocte): Move has_storage() to runtime::Tensor?
+        if (auto dynamic_tensor = std::dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(input))
+        {
+            NGRAPH_CHECK(dynamic_tensor->has_storage());
+            input = dynamic_tensor->get_wrapped_tensor();
+        }
+        wrapped_inputs.push_back(input);
+        specialization->element_types.push_back(input->get_element_type());
+        specialization->shapes.push_back(input->get_shape());
 
-            num_dyn_nodes_last_pass = num_dyn_nodes_this_pass;
+        shared_ptr<AlignedBuffer> value;
+        if (m_wrapped_function->get_parameters()[i]->is_relevant_to_shapes())
+        {
+            value = make_shared<AlignedBuffer>(input->get_size_in_bytes(), /*alignment=*/64);
+            // TODO(amprocte): For host-resident tensors we should be able to skip the read,
+            // but no API for that yet.
+            input->read(value->get_ptr(), input->get_size_in_bytes());
         }
+        specialization->values.push_back(value);
+    }
+
+    auto input_shapes = specialization->shapes;
+    specialization->shapes = get_bucket_shapes(input_shapes);
+    auto padded_shapes = specialization->shapes;
 
-        pass::Manager pass_val;
-        pass_val.register_pass<pass::Validate>();
-        pass_val.run_passes(clone);
+    shared_ptr<Executable> exec;
+    shared_ptr<Function> clone;
+    if (!m_lru->get_entry(get_cache_key(*specialization), exec, clone))
+    {
+        if (m_async_compilation &&
+            find_larger_bucket(*specialization, exec, clone, padded_shapes))
+        {
+            compile_in_background(specialization);
+        }
+        else
+        {
+            compile(*specialization, exec, clone);
+        }
+    }
 
-        std::vector<std::shared_ptr<runtime::Tensor>> wrapped_outputs;
+    return call_padded(exec, clone, outputs, wrapped_inputs, input_shapes, padded_shapes);
+}
 
-        const ResultVector& results = clone->get_results();
-        for (auto& result : results)
+bool runtime::dynamic::DynamicExecutable::call_padded(
+    const shared_ptr<Executable>& exec,
+    const shared_ptr<Function>& clone,
+    const vector<shared_ptr<runtime::Tensor>>& outputs,
+    const vector<shared_ptr<runtime::Tensor>>& inputs,
+    const vector<Shape>& input_shapes,
+    const vector<Shape>& padded_shapes)
+{
+    std::vector<std::shared_ptr<runtime::Tensor>> padded_inputs;
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        if (input_shapes[i] == padded_shapes[i])
         {
-            NGRAPH_CHECK(result->get_output_partial_shape(0).is_static(),
-                         "Shape staticization failed for result node ",
-                         *result);
+            padded_inputs.push_back(inputs[i]);
+            continue;
         }
-        NGRAPH_CHECK(results.size() == outputs.size());
+        auto& element_type = inputs[i]->get_element_type();
+        vector<char> data(inputs[i]->get_size_in_bytes());
+        inputs[i]->read(data.data(), data.size());
+        vector<char> padded_data(shape_size(padded_shapes[i]) * element_type.size(), 0);
+        copy_region(data.data(),
+                    input_shapes[i],
+                    padded_data.data(),
+                    padded_shapes[i],
+                    input_shapes[i],
+                    element_type.size());
+        auto padded = m_wrapped_backend->create_tensor(element_type, padded_shapes[i]);
+        padded->write(padded_data.data(), padded_data.size());
+        padded_inputs.push_back(padded);
+    }
+
+    const ResultVector& results = clone->get_results();
+    NGRAPH_CHECK(results.size() == outputs.size());
 
-        for (size_t i = 0; i < outputs.size(); i++)
+    std::vector<std::shared_ptr<runtime::Tensor>> wrapped_outputs;
+    std::vector<Shape> output_shapes;
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        auto& element_type = results[i]->get_output_element_type(0);
+        const Shape& padded_shape = results[i]->get_output_shape(0);
+        Shape output_shape = padded_shape;
+        for (auto& buckets : m_shape_buckets)
         {
-            if (auto dynamic_tensor =
-                    std::dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(outputs[i]))
-            {
-                dynamic_tensor->make_storage(results[i]->get_output_element_type(0),
-                                             results[i]->get_output_shape(0));
-                wrapped_outputs.push_back(dynamic_tensor->get_wrapped_tensor());
-            }
-            else
+            for (auto& output_axis : buckets.output_axes)
             {
-                wrapped_outputs.push_back(outputs[i]);
+                if (output_axis.first == i)
+                {
+                    NGRAPH_CHECK(output_axis.second < output_shape.size(),
+                                 "Shape buckets: axis ",
+                                 output_axis.second,
+                                 " is out of range for result ",
+                                 i);
+                    output_shape[output_axis.second] =
+                        input_shapes[buckets.parameter_index][buckets.axis];
+                }
             }
         }
+        output_shapes.push_back(output_shape);
+
+        if (auto dynamic_tensor =
+                std::dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(outputs[i]))
+        {
+            dynamic_tensor->make_storage(element_type, output_shape);
+        }
+        if (output_shape != padded_shape)
+        {
+            wrapped_outputs.push_back(m_wrapped_backend->create_tensor(element_type, padded_shape));
+        }
+        else if (auto dynamic_tensor =
+                     std::dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(outputs[i]))
+        {
+            wrapped_outputs.push_back(dynamic_tensor->get_wrapped_tensor());
+        }
+        else
+        {
+            wrapped_outputs.push_back(outputs[i]);
+        }
+    }
 
-        auto compiled_executable =
-            m_wrapped_backend->compile(clone, m_enable_performance_collection);
-        // Put compiled executable in the cache.
-        m_lru->add_entry(merged_input_shapes, compiled_executable, clone);
-        auto result = compiled_executable->call(wrapped_outputs, wrapped_inputs);
+    auto result = exec->call(wrapped_outputs, padded_inputs);
 
-        return result;
+    // Slice padded outputs back to the shapes of the unpadded inputs
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        auto& padded_shape = wrapped_outputs[i]->get_shape();
+        if (output_shapes[i] == padded_shape)
+        {
+            continue;
+        }
+        size_t element_size = wrapped_outputs[i]->get_element_type().size();
+        vector<char> padded_data(wrapped_outputs[i]->get_size_in_bytes());
+        wrapped_outputs[i]->read(padded_data.data(), padded_data.size());
+        vector<char> data(shape_size(output_shapes[i]) * element_size);
+        copy_region(padded_data.data(),
+                    padded_shape,
+                    data.data(),
+                    output_shapes[i],
+                    output_shapes[i],
+                    element_size);
+        outputs[i]->write(data.data(), data.size());
     }
+
+    return result;
 }
 
 runtime::dynamic::DynamicTensor::DynamicTensor(
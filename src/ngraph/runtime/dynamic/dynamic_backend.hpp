@@ -16,9 +16,14 @@
 
 #pragma once
 
+#include <future>
+#include <list>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "ngraph/runtime/backend.hpp"
@@ -87,23 +92,85 @@ private:
 /// 2. compiles the clone using the wrapped backend;
 /// 3. fowards the input tensors to the clone executable for actual execution.
 ///
+/// Compiled clones are cached on the input shapes and the values of shape-relevant inputs.
+/// Dimensions registered with `set_shape_buckets` are padded up to bucket edges first, so
+/// that nearby sizes share one compiled clone. With `set_async_compilation` new buckets are
+/// compiled on a background thread while calls are served by a larger compiled bucket.
+///
 /// `DynamicExecutable` objects are produced by `DynamicBackend::compile()`.
 ///
-class ngraph::runtime::dynamic::DynamicExecutable : public ngraph::runtime::Executable
+class NGRAPH_API ngraph::runtime::dynamic::DynamicExecutable : public ngraph::runtime::Executable
 {
 public:
     DynamicExecutable(std::shared_ptr<Function> wrapped_function,
                       std::shared_ptr<ngraph::runtime::Backend> wrapped_backend,
                       bool enable_performance_collection = false);
+    ~DynamicExecutable() override;
     virtual bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                       const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
 
+    /// \brief Pad dimension `axis` of parameter `parameter_index` up to the next of `edges`.
+    ///
+    /// Inputs are zero-padded to the bucket size before the call, and every output dimension
+    /// listed in `output_axes` as a {result index, axis} pair is sliced back to the unpadded
+    /// size afterwards. This is only correct if the padding does not change the unpadded part
+    /// of the outputs, e.g. for elementwise ops or masked sequence models. Sizes larger than
+    /// the last edge are compiled exactly. The parameter must not be shape-relevant.
+    void set_shape_buckets(size_t parameter_index,
+                           size_t axis,
+                           const std::vector<size_t>& edges,
+                           const std::vector<std::pair<size_t, size_t>>& output_axes);
+    /// \brief Compile new buckets on a background thread.
+    ///
+    /// Until the bucket is compiled, calls are served by the smallest larger bucket that is
+    /// already compiled. Calls for which no such bucket exists still compile synchronously.
+    void set_async_compilation(bool enable) { m_async_compilation = enable; }
+    /// \brief Evict cached clones, least recently used first, once their estimated size
+    ///        exceeds `byte_budget`. 0 means unbounded.
+    void set_cache_byte_budget(size_t byte_budget) { m_lru->set_byte_budget(byte_budget); }
+    /// \brief Block until all background compilations have finished.
+    void wait_for_compilations();
+    size_t get_num_cached_executables() { return m_lru->get_num_entries(); }
 private:
+    struct ShapeBuckets
+    {
+        size_t parameter_index;
+        size_t axis;
+        std::vector<size_t> edges;
+        std::vector<std::pair<size_t, size_t>> output_axes;
+    };
+
+    struct Specialization;
+
+    std::vector<Shape> get_bucket_shapes(const std::vector<Shape>& input_shapes) const;
+    std::vector<int> get_cache_key(const Specialization& specialization) const;
+    void compile(const Specialization& specialization,
+                 std::shared_ptr<Executable>& exec,
+                 std::shared_ptr<Function>& clone);
+    void compile_in_background(const std::shared_ptr<Specialization>& specialization);
+    bool find_larger_bucket(const Specialization& specialization,
+                            std::shared_ptr<Executable>& exec,
+                            std::shared_ptr<Function>& clone,
+                            std::vector<Shape>& shapes);
+    bool call_padded(const std::shared_ptr<Executable>& exec,
+                     const std::shared_ptr<Function>& clone,
+                     const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                     const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
+                     const std::vector<Shape>& input_shapes,
+                     const std::vector<Shape>& padded_shapes);
+
     std::shared_ptr<ngraph::Function> m_wrapped_function;
     std::shared_ptr<ngraph::runtime::Backend> m_wrapped_backend;
     std::shared_ptr<ngraph::runtime::LRUCache> m_lru =
         std::make_shared<ngraph::runtime::LRUCache>();
     bool m_enable_performance_collection;
+    std::vector<ShapeBuckets> m_shape_buckets;
+    bool m_async_compilation = false;
+
+    // Protects the background compilation state below
+    std::mutex m_compile_mutex;
+    std::set<std::vector<int>> m_compiling;
+    std::list<std::future<void>> m_compilations;
 };
 
 ///
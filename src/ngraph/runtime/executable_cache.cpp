@@ -0,0 +1,518 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <sys/stat.h>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#ifdef _WIN32
+#include <sys/utime.h>
+#else
+#include <utime.h>
+#endif
+
+#include "ngraph/attribute_visitor.hpp"
+#include "ngraph/env_util.hpp"
+#include "ngraph/except.hpp"
+#include "ngraph/file_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/executable_cache.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    // SHA-256, so that two different graphs never share an entry in practice. Unlike std::hash
+    // the result is the same in every process and on every platform, which is what an on-disk
+    // key needs.
+    class KeyHasher
+    {
+    public:
+        void update(const void* data, size_t size)
+        {
+            auto bytes = static_cast<const uint8_t*>(data);
+            m_length += size;
+            while (size > 0)
+            {
+                size_t count = min(size, sizeof(m_block) - m_block_size);
+                copy(bytes, bytes + count, m_block + m_block_size);
+                m_block_size += count;
+                bytes += count;
+                size -= count;
+                if (m_block_size == sizeof(m_block))
+                {
+                    process_block();
+                }
+            }
+        }
+
+        void update(uint64_t value) { update(&value, sizeof(value)); }
+        void update(const string& value)
+        {
+            update(static_cast<uint64_t>(value.size()));
+            update(value.data(), value.size());
+        }
+
+        string get_key()
+        {
+            uint64_t bit_length = m_length * 8;
+            uint8_t padding = 0x80;
+            update(&padding, 1);
+            padding = 0;
+            while (m_block_size != sizeof(m_block) - sizeof(bit_length))
+            {
+                update(&padding, 1);
+            }
+            uint8_t length_bytes[sizeof(bit_length)];
+            for (size_t i = 0; i < sizeof(bit_length); i++)
+            {
+                length_bytes[i] = static_cast<uint8_t>(bit_length >> (56 - 8 * i));
+            }
+            update(length_bytes, sizeof(length_bytes));
+
+            ostringstream key;
+            key << hex << setfill('0');
+            for (uint32_t word : m_state)
+            {
+                key << setw(8) << word;
+            }
+            return key.str();
+        }
+
+    private:
+        static uint32_t rotate_right(uint32_t x, int n) { return (x >> n) | (x << (32 - n)); }
+        void process_block()
+        {
+            static const uint32_t k[64] = {
+                0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
+                0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+                0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
+                0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+                0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+                0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+                0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+                0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+                0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
+                0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+                0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+            uint32_t w[64];
+            for (size_t i = 0; i < 16; i++)
+            {
+                w[i] = (uint32_t(m_block[4 * i]) << 24) | (uint32_t(m_block[4 * i + 1]) << 16) |
+                       (uint32_t(m_block[4 * i + 2]) << 8) | uint32_t(m_block[4 * i + 3]);
+            }
+            for (size_t i = 16; i < 64; i++)
+            {
+                uint32_t s0 =
+                    rotate_right(w[i - 15], 7) ^ rotate_right(w[i - 15], 18) ^ (w[i - 15] >> 3);
+                uint32_t s1 =
+                    rotate_right(w[i - 2], 17) ^ rotate_right(w[i - 2], 19) ^ (w[i - 2] >> 10);
+                w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+            }
+
+            uint32_t v[8];
+            copy(m_state, m_state + 8, v);
+            for (size_t i = 0; i < 64; i++)
+            {
+                uint32_t s1 =
+                    rotate_right(v[4], 6) ^ rotate_right(v[4], 11) ^ rotate_right(v[4], 25);
+                uint32_t ch = (v[4] & v[5]) ^ (~v[4] & v[6]);
+                uint32_t t1 = v[7] + s1 + ch + k[i] + w[i];
+                uint32_t s0 =
+                    rotate_right(v[0], 2) ^ rotate_right(v[0], 13) ^ rotate_right(v[0], 22);
+                uint32_t maj = (v[0] & v[1]) ^ (v[0] & v[2]) ^ (v[1] & v[2]);
+                uint32_t t2 = s0 + maj;
+                copy_backward(v, v + 7, v + 8);
+                v[4] += t1;
+                v[0] = t1 + t2;
+            }
+            for (size_t i = 0; i < 8; i++)
+            {
+                m_state[i] += v[i];
+            }
+            m_block_size = 0;
+        }
+
+        uint32_t m_state[8] = {0x6a09e667,
+                               0xbb67ae85,
+                               0x3c6ef372,
+                               0xa54ff53a,
+                               0x510e527f,
+                               0x9b05688c,
+                               0x1f83d9ab,
+                               0x5be0cd19};
+        uint8_t m_block[64];
+        size_t m_block_size = 0;
+        uint64_t m_length = 0;
+    };
+
+    class AttributeHasher : public AttributeVisitor
+    {
+    public:
+        AttributeHasher(KeyHasher& hasher)
+            : m_hasher(hasher)
+        {
+        }
+
+        bool is_complete() const { return m_complete; }
+        void on_attribute(const string& name, string& value) override
+        {
+            m_hasher.update(name);
+            m_hasher.update(value);
+        }
+
+        void on_attribute(const string& name, bool& value) override
+        {
+            m_hasher.update(name);
+            m_hasher.update(static_cast<uint64_t>(value));
+        }
+
+        void on_adapter(const string& name, ValueAccessor<void>& adapter) override
+        {
+            // Element types and shapes are already covered by the node outputs. Any other
+            // opaque attribute cannot be hashed, so the function must not be cached.
+            auto& type_info = adapter.get_type_info();
+            if (type_info != AttributeAdapter<element::Type>::type_info &&
+                type_info != AttributeAdapter<PartialShape>::type_info)
+            {
+                NGRAPH_DEBUG << "Executable cache: cannot hash attribute " << name;
+                m_complete = false;
+            }
+        }
+
+        void on_adapter(const string& name, ValueAccessor<string>& adapter) override
+        {
+            m_hasher.update(name);
+            m_hasher.update(adapter.get());
+        }
+
+        void on_adapter(const string& name, ValueAccessor<int64_t>& adapter) override
+        {
+            m_hasher.update(name);
+            m_hasher.update(static_cast<uint64_t>(adapter.get()));
+        }
+
+        void on_adapter(const string& name, ValueAccessor<double>& adapter) override
+        {
+            m_hasher.update(name);
+            double value = adapter.get();
+            m_hasher.update(&value, sizeof(value));
+        }
+
+        void on_adapter(const string& name, ValueAccessor<vector<int64_t>>& adapter) override
+        {
+            m_hasher.update(name);
+            auto& value = adapter.get();
+            m_hasher.update(static_cast<uint64_t>(value.size()));
+            m_hasher.update(value.data(), value.size() * sizeof(int64_t));
+        }
+
+        void on_adapter(const string& name, ValueAccessor<vector<float>>& adapter) override
+        {
+            m_hasher.update(name);
+            auto& value = adapter.get();
+            m_hasher.update(static_cast<uint64_t>(value.size()));
+            m_hasher.update(value.data(), value.size() * sizeof(float));
+        }
+
+        void on_adapter(const string& name, ValueAccessor<vector<string>>& adapter) override
+        {
+            m_hasher.update(name);
+            auto& value = adapter.get();
+            m_hasher.update(static_cast<uint64_t>(value.size()));
+            for (auto& s : value)
+            {
+                m_hasher.update(s);
+            }
+        }
+
+    private:
+        KeyHasher& m_hasher;
+        bool m_complete = true;
+    };
+}
+
+constexpr uint64_t runtime::ExecutableCache::s_default_max_bytes;
+
+runtime::ExecutableCache::ExecutableCache(const string& directory, uint64_t max_bytes)
+    : m_directory(directory)
+    , m_max_bytes(max_bytes)
+{
+    file_util::make_directory(m_directory);
+}
+
+shared_ptr<runtime::ExecutableCache> runtime::ExecutableCache::create_from_environment()
+{
+    string directory = getenv_string("NGRAPH_EXECUTABLE_CACHE_DIR");
+    if (directory.empty())
+    {
+        return nullptr;
+    }
+    uint64_t max_bytes = s_default_max_bytes;
+    string max_bytes_string = getenv_string("NGRAPH_EXECUTABLE_CACHE_MAX_BYTES");
+    if (!max_bytes_string.empty())
+    {
+        char* end;
+        errno = 0;
+        long long value = strtoll(max_bytes_string.c_str(), &end, 0);
+        if (errno || *end || value < 0)
+        {
+            throw ngraph_error("Environment variable \"NGRAPH_EXECUTABLE_CACHE_MAX_BYTES\"=\"" +
+                               max_bytes_string + "\" is not a valid number of bytes");
+        }
+        max_bytes = static_cast<uint64_t>(value);
+    }
+    return make_shared<ExecutableCache>(directory, max_bytes);
+}
+
+string runtime::ExecutableCache::compute_key(const shared_ptr<Function>& func,
+                                             const pass::PassConfig& pass_config,
+                                             const string& backend_id)
+{
+    KeyHasher hasher;
+    hasher.update(backend_id);
+    for (auto& enable : pass_config.get_enables())
+    {
+        hasher.update(enable.first);
+        hasher.update(static_cast<uint64_t>(enable.second));
+    }
+    for (auto& attribute : pass_config.get_pass_attributes())
+    {
+        hasher.update(attribute.first);
+        hasher.update(static_cast<uint64_t>(attribute.second));
+    }
+
+    // Nodes are identified by their position in topological order rather than by name, so
+    // the same graph built again in another process gets the same key
+    unordered_map<const Node*, uint64_t> node_index;
+    AttributeHasher attribute_hasher(hasher);
+    for (auto& node : func->get_ordered_ops())
+    {
+        node_index.insert({node.get(), node_index.size()});
+        auto& type_info = node->get_type_info();
+        hasher.update(string(type_info.name));
+        hasher.update(type_info.version);
+
+        for (auto& input : node->inputs())
+        {
+            auto output = input.get_source_output();
+            hasher.update(node_index.at(output.get_node()));
+            hasher.update(static_cast<uint64_t>(output.get_index()));
+        }
+        vector<uint64_t> control_dependencies;
+        for (auto& dependency : node->get_control_dependencies())
+        {
+            control_dependencies.push_back(node_index.at(dependency.get()));
+        }
+        sort(control_dependencies.begin(), control_dependencies.end());
+        hasher.update(control_dependencies.data(),
+                      control_dependencies.size() * sizeof(uint64_t));
+
+        for (auto& output : node->outputs())
+        {
+            hasher.update(output.get_element_type().get_type_name());
+            ostringstream shape;
+            shape << output.get_partial_shape();
+            hasher.update(shape.str());
+        }
+
+        if (auto constant = as_type_ptr<op::Constant>(node))
+        {
+            size_t size = (shape_size(constant->get_shape()) *
+                               constant->get_element_type().bitwidth() +
+                           7) /
+                          8;
+            hasher.update(constant->get_data_ptr(), size);
+        }
+        else if (!node->visit_attributes(attribute_hasher) || !attribute_hasher.is_complete())
+        {
+            NGRAPH_DEBUG << "Executable cache: attributes of " << *node
+                         << " cannot be hashed, not caching " << func->get_name();
+            return "";
+        }
+    }
+
+    for (auto& parameter : func->get_parameters())
+    {
+        hasher.update(node_index.at(parameter.get()));
+    }
+    for (auto& result : func->get_results())
+    {
+        hasher.update(node_index.at(result.get()));
+    }
+    return hasher.get_key();
+}
+
+string runtime::ExecutableCache::compute_key(const string& data)
+{
+    KeyHasher hasher;
+    hasher.update(data.data(), data.size());
+    return hasher.get_key();
+}
+
+string runtime::ExecutableCache::get_path(const string& key) const
+{
+    return file_util::path_join(m_directory, key + ".ngexec");
+}
+
+bool runtime::ExecutableCache::read(const string& key, string& data) const
+{
+    ifstream in(get_path(key), ios::binary);
+    if (!in)
+    {
+        return false;
+    }
+    ostringstream contents;
+    contents << in.rdbuf();
+    data = contents.str();
+    // The modification time orders entries for eviction
+    utime(get_path(key).c_str(), nullptr);
+    return true;
+}
+
+bool runtime::ExecutableCache::write(const string& key, const string& data) const
+{
+    static atomic<uint64_t> s_write_count{0};
+    string path = get_path(key);
+    ostringstream temp_path;
+    temp_path << path << ".tmp." << hash<thread::id>()(this_thread::get_id()) << "."
+              << chrono::steady_clock::now().time_since_epoch().count() << "." << s_write_count++;
+    {
+        ofstream out(temp_path.str(), ios::binary);
+        out.write(data.data(), data.size());
+        if (!out)
+        {
+            NGRAPH_WARN << "Executable cache: failed to write " << temp_path.str();
+            out.close();
+            std::remove(temp_path.str().c_str());
+            return false;
+        }
+    }
+    // rename() replaces the entry atomically, readers see either the old or the new file
+    if (rename(temp_path.str().c_str(), path.c_str()) != 0)
+    {
+        NGRAPH_WARN << "Executable cache: failed to create " << path;
+        std::remove(temp_path.str().c_str());
+        return false;
+    }
+    evict(path);
+    return true;
+}
+
+void runtime::ExecutableCache::evict(const string& keep_path) const
+{
+    struct Entry
+    {
+        string path;
+        uint64_t size;
+        time_t used;
+    };
+    vector<Entry> entries;
+    uint64_t total_size = 0;
+    const string suffix = ".ngexec";
+    file_util::iterate_files(m_directory, [&](const string& file, bool is_dir) {
+        struct stat status;
+        if (is_dir || file.size() < suffix.size() ||
+            file.compare(file.size() - suffix.size(), suffix.size(), suffix) != 0 ||
+            stat(file.c_str(), &status) != 0)
+        {
+            return;
+        }
+        total_size += status.st_size;
+        if (file != keep_path)
+        {
+            entries.push_back({file, static_cast<uint64_t>(status.st_size), status.st_mtime});
+        }
+    });
+    if (total_size <= m_max_bytes)
+    {
+        return;
+    }
+
+    // Least recently used first
+    sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+        return a.used < b.used;
+    });
+    for (auto& entry : entries)
+    {
+        if (total_size <= m_max_bytes)
+        {
+            break;
+        }
+        std::remove(entry.path.c_str());
+        total_size -= entry.size;
+    }
+}
+
+void runtime::ExecutableCache::remove(const string& key) const
+{
+    std::remove(get_path(key).c_str());
+}
+
+shared_ptr<runtime::Executable> runtime::ExecutableCache::load(const string& key,
+                                                               Backend& backend) const
+{
+    string data;
+    if (!read(key, data))
+    {
+        return nullptr;
+    }
+    shared_ptr<Executable> exec;
+    try
+    {
+        istringstream in(data);
+        exec = backend.load(in);
+    }
+    catch (const exception& e)
+    {
+        NGRAPH_WARN << "Executable cache: discarding unreadable entry " << key << ": "
+                    << e.what();
+    }
+    if (!exec)
+    {
+        remove(key);
+    }
+    return exec;
+}
+
+bool runtime::ExecutableCache::save(const string& key, Executable& exec) const
+{
+    ostringstream out;
+    try
+    {
+        exec.save(out);
+    }
+    catch (const exception& e)
+    {
+        NGRAPH_DEBUG << "Executable cache: executable cannot be saved: " << e.what();
+        return false;
+    }
+    return write(key, out.str());
+}
@@ -0,0 +1,97 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "ngraph/function.hpp"
+#include "ngraph/pass/pass_config.hpp"
+#include "ngraph/runtime/executable.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class Backend;
+
+        /// \brief On-disk cache of compiled executables, shared by all processes pointing at the
+        ///        same directory.
+        ///
+        /// Entries are keyed by the SHA-256 of everything that affects compilation: the graph
+        /// structure, every node's attributes and constant values, the pass configuration and
+        /// a backend identifier that must include the backend version. Entries are written to a
+        /// temporary file and renamed into place, so concurrent writers and readers never see
+        /// a partial entry. The cache is opt-in through NGRAPH_EXECUTABLE_CACHE_DIR.
+        ///
+        /// Once the entries take more than the byte budget, the least recently used ones are
+        /// removed after each write. Reading an entry marks it as used.
+        class NGRAPH_API ExecutableCache
+        {
+        public:
+            static constexpr uint64_t s_default_max_bytes = uint64_t(1) << 30;
+
+            explicit ExecutableCache(const std::string& directory,
+                                     uint64_t max_bytes = s_default_max_bytes);
+
+            /// \brief Cache in the directory named by NGRAPH_EXECUTABLE_CACHE_DIR, limited to
+            ///        NGRAPH_EXECUTABLE_CACHE_MAX_BYTES bytes if that is set
+            /// \return nullptr if the directory is not set
+            static std::shared_ptr<ExecutableCache> create_from_environment();
+
+            /// \brief Compute the cache key of a function
+            /// \param func The function to compile
+            /// \param pass_config The pass configuration used to compile it
+            /// \param backend_id Identifies the backend, its version and any option that
+            ///        changes the compiled result
+            /// \return The key, or an empty string if the function contains a node whose
+            ///         attributes cannot be visited and so must not be cached
+            static std::string compute_key(const std::shared_ptr<Function>& func,
+                                           const pass::PassConfig& pass_config,
+                                           const std::string& backend_id);
+            /// \brief Compute the cache key of an arbitrary blob, such as generated source
+            static std::string compute_key(const std::string& data);
+
+            const std::string& get_directory() const { return m_directory; }
+            uint64_t get_max_bytes() const { return m_max_bytes; }
+            /// \brief Read the entry stored under `key`
+            /// \return false if there is no such entry
+            bool read(const std::string& key, std::string& data) const;
+            /// \brief Store `data` under `key`, replacing any previous entry
+            /// \return false if the entry could not be written
+            bool write(const std::string& key, const std::string& data) const;
+            /// \brief Remove the entry stored under `key`, e.g. after it failed to load
+            void remove(const std::string& key) const;
+
+            /// \brief Load an executable previously stored with save()
+            /// \return nullptr if there is no entry or it cannot be loaded by `backend`
+            std::shared_ptr<Executable> load(const std::string& key, Backend& backend) const;
+            /// \brief Save an executable with Executable::save
+            /// \return false if the executable does not support saving or cannot be written
+            bool save(const std::string& key, Executable& exec) const;
+
+        private:
+            std::string get_path(const std::string& key) const;
+            // Removes least recently used entries other than keep_path until under budget
+            void evict(const std::string& keep_path) const;
+
+            std::string m_directory;
+            uint64_t m_max_bytes;
+        };
+    }
+}
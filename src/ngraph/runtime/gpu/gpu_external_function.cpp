@@ -371,10 +371,10 @@ void runtime::gpu::GPUExternalFunction::emit_temp_mem_pool_allocation(
     size_t worst_case_tmp_size = 0;
     for (shared_ptr<Node> node : m_function_ordered_ops.at(current_function))
     {
-        if (node->liveness_new_list.size() > 0)
+        if (node->get_liveness_new_list().size() > 0)
         {
             temporaries_used = true;
-            for (descriptor::Tensor* tensor : node->liveness_new_list)
+            for (descriptor::Tensor* tensor : node->get_liveness_new_list())
             {
                 worst_case_tmp_size += tensor->size();
             }
@@ -391,7 +391,7 @@ void runtime::gpu::GPUExternalFunction::emit_temp_mem_pool_allocation(
         // Add temporaries to the variable name map
         for (shared_ptr<Node> node : m_function_ordered_ops.at(current_function))
         {
-            for (descriptor::Tensor* tensor : node->liveness_new_list)
+            for (descriptor::Tensor* tensor : node->get_liveness_new_list())
             {
                 stringstream ss;
                 ss << "((" << tensor->get_element_type().c_type_string() << "*)(pool_base_ptr + "
@@ -299,7 +299,7 @@ void runtime::gpu::GPUInternalFunction::build_functions()
         bool temporaries_used = false;
         for (shared_ptr<Node> node : m_function_ordered_ops.at(current_function))
         {
-            if (node->liveness_new_list.size() > 0)
+            if (node->get_liveness_new_list().size() > 0)
             {
                 temporaries_used = true;
                 break;
@@ -309,7 +309,7 @@ void runtime::gpu::GPUInternalFunction::build_functions()
         {
             for (shared_ptr<Node> node : m_function_ordered_ops.at(current_function))
             {
-                for (descriptor::Tensor* tensor : node->liveness_new_list)
+                for (descriptor::Tensor* tensor : node->get_liveness_new_list())
                 {
                     m_variable_name_map[tensor->get_name()] =
                         std::make_tuple(TensorRole::INTERMEDIATE,
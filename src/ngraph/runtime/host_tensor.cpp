@@ -17,6 +17,7 @@
 #include <cstring>
 #include <memory>
 
+#include "ngraph/check.hpp"
 #include "ngraph/chrome_trace.hpp"
 #include "ngraph/descriptor/layout/dense_tensor_layout.hpp"
 #include "ngraph/runtime/host_tensor.hpp"
@@ -117,3 +118,15 @@ void runtime::HostTensor::read(void* target, size_t n) const
     const char* source = get_data_ptr();
     memcpy(target, source, n);
 }
+
+void* runtime::HostTensor::get_host_data_ptr()
+{
+    return get_data_ptr();
+}
+
+void runtime::HostTensor::set_data_ptr(void* memory_pointer)
+{
+    NGRAPH_CHECK(m_allocated_buffer_pool == nullptr,
+                 "Only a tensor made on a memory pointer can be moved to other memory");
+    m_aligned_buffer_pool = static_cast<char*>(memory_pointer);
+}
@@ -69,6 +69,11 @@ public:
     /// \param n Number of bytes to read, must be integral number of elements.
     void read(void* p, size_t n) const override;
 
+    void* get_host_data_ptr() override;
+
+    /// \brief Points a tensor made on memory_pointer at other memory of the same size
+    void set_data_ptr(void* memory_pointer);
+
 private:
     HostTensor(const HostTensor&) = delete;
     HostTensor(HostTensor&&) = delete;
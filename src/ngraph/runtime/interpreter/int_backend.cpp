@@ -61,7 +61,26 @@ shared_ptr<runtime::Executable>
     runtime::interpreter::INTBackend::compile(shared_ptr<Function> function,
                                               bool enable_performance_collection)
 {
-    return make_shared<INTExecutable>(function, enable_performance_collection);
+    string key;
+    if (m_executable_cache && !enable_performance_collection)
+    {
+        key = ExecutableCache::compute_key(
+            function, pass::PassConfig(), "INTERPRETER " + get_version());
+        if (!key.empty())
+        {
+            if (auto exec = m_executable_cache->load(key, *this))
+            {
+                return exec;
+            }
+        }
+    }
+
+    auto exec = make_shared<INTExecutable>(function, enable_performance_collection);
+    if (!key.empty())
+    {
+        m_executable_cache->save(key, *exec);
+    }
+    return exec;
 }
 
 bool runtime::interpreter::INTBackend::is_supported(const Node& node) const
@@ -69,6 +88,11 @@ bool runtime::interpreter::INTBackend::is_supported(const Node& node) const
     return m_unsupported_op_name_list.find(node.description()) == m_unsupported_op_name_list.end();
 }
 
+bool runtime::interpreter::INTBackend::is_supported_property(const Property prop) const
+{
+    return prop == Property::memory_attach;
+}
+
 std::shared_ptr<runtime::Executable> runtime::interpreter::INTBackend::load(istream& in)
 {
     shared_ptr<Executable> exec;
@@ -84,15 +108,25 @@ std::shared_ptr<runtime::Executable> runtime::interpreter::INTBackend::load(istr
             break;
         }
     }
-    if (save_info == "INTERPRETER Save File 1.0")
+    // 1.0 saves the model as json, 1.1 in the binary format
+    if (save_info == "INTERPRETER Save File 1.0" || save_info == "INTERPRETER Save File 1.1")
     {
         for (const cpio::FileInfo& info : file_info)
         {
             if (info.get_name() == "model")
             {
-                vector<char> buffer = reader.read(info);
-                string model_string = string(buffer.data(), buffer.size());
-                exec = shared_ptr<INTExecutable>(new INTExecutable(model_string));
+                if (save_info == "INTERPRETER Save File 1.0")
+                {
+                    vector<char> buffer = reader.read(info);
+                    string model_string = string(buffer.data(), buffer.size());
+                    exec = shared_ptr<INTExecutable>(new INTExecutable(model_string));
+                }
+                else
+                {
+                    // The binary model is decoded straight from the archive
+                    in.seekg(info.get_offset(), ios_base::beg);
+                    exec = shared_ptr<INTExecutable>(new INTExecutable(in));
+                }
                 break;
             }
         }
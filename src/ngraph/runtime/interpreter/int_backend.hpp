@@ -25,6 +25,7 @@
 #include "ngraph/runtime/interpreter/int_backend_visibility.hpp"
 
 #include "ngraph/runtime/backend_manager.hpp"
+#include "ngraph/runtime/executable_cache.hpp"
 #include "ngraph/runtime/tensor.hpp"
 
 namespace ngraph
@@ -59,9 +60,12 @@ public:
     std::shared_ptr<Executable> load(std::istream& input_stream) override;
 
     bool is_supported(const Node& node) const override;
+    bool is_supported_property(const Property prop) const override;
 
     bool set_config(const std::map<std::string, std::string>& config, std::string& error) override;
 
 private:
     std::set<std::string> m_unsupported_op_name_list;
+    std::shared_ptr<ExecutableCache> m_executable_cache =
+        ExecutableCache::create_from_environment();
 };
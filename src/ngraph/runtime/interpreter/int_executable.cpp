@@ -26,6 +26,7 @@
 #include "ngraph/pass/like_replacement.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/memory_layout.hpp"
 #include "ngraph/pass/opset0_downgrade.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
 #include "ngraph/serializer.hpp"
@@ -70,20 +71,24 @@ runtime::interpreter::INTExecutable::INTExecutable(const shared_ptr<Function>& f
 #else
     m_function = clone_function(*function);
 #endif
+    // TensorIterator is executed natively instead of being unrolled
+    auto is_supported = [](const Node& node) { return is_type<op::TensorIterator>(&node); };
     pass::Manager pass_manager;
     pass_manager.register_pass<pass::LikeReplacement>();
-    pass_manager.register_pass<pass::FusedOpDecomposition>();
+    pass_manager.register_pass<pass::FusedOpDecomposition>(is_supported);
     pass_manager.register_pass<pass::Opset0Downgrade>();
     // Need to decompose any v0 fused ops, which were produced by the downgrade pass
-    pass_manager.register_pass<pass::FusedOpDecomposition>();
+    pass_manager.register_pass<pass::FusedOpDecomposition>(is_supported);
     pass_manager.register_pass<pass::AssignLayout<DenseTensorLayout>>();
     pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::MemoryLayout>(get_alignment());
     pass_manager.run_passes(m_function);
     for (auto node : m_function->get_ordered_ops())
     {
         m_nodes.push_back(node);
     }
     set_parameters_and_results(*m_function);
+    build_execution_plan();
 }
 
 runtime::interpreter::INTExecutable::INTExecutable(const std::string& model_string)
@@ -91,107 +96,93 @@ runtime::interpreter::INTExecutable::INTExecutable(const std::string& model_stri
     , m_performance_counters_enabled{false}
 {
     m_function = deserialize(model_string);
+    prepare_loaded_function();
+}
+
+runtime::interpreter::INTExecutable::INTExecutable(istream& model_stream)
+    : m_is_compiled{true}
+    , m_performance_counters_enabled{false}
+{
+    m_function = deserialize(model_stream);
+    prepare_loaded_function();
+}
+
+void runtime::interpreter::INTExecutable::prepare_loaded_function()
+{
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::MemoryLayout>(get_alignment());
+    pass_manager.run_passes(m_function);
     for (auto node : m_function->get_ordered_ops())
     {
         m_nodes.push_back(node);
     }
     set_parameters_and_results(*m_function);
+    build_execution_plan();
 }
 
-bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
-                                               const vector<shared_ptr<runtime::Tensor>>& inputs)
+void runtime::interpreter::INTExecutable::build_execution_plan()
 {
-    event::Duration d1("call", "Interpreter");
-
-    // convert inputs to HostTensor
-    vector<shared_ptr<HostTensor>> func_inputs;
-    for (auto tensor : inputs)
-    {
-        auto host_tensor = static_pointer_cast<runtime::HostTensor>(tensor);
-        func_inputs.push_back(host_tensor);
-    }
-    if (m_nan_check_enabled)
-    {
-        perform_nan_check(func_inputs);
-    }
-
-    // convert outputs to HostTensor
-    vector<shared_ptr<HostTensor>> func_outputs;
-    for (auto tensor : outputs)
-    {
-        auto host_tensor = static_pointer_cast<runtime::HostTensor>(tensor);
-        func_outputs.push_back(host_tensor);
-    }
-
-    // map function params -> HostTensor
-    unordered_map<descriptor::Tensor*, shared_ptr<HostTensor>> tensor_map;
-    size_t input_count = 0;
+    // Input and output slots follow the call arguments, a parameter listed twice keeps the
+    // slot of its first position
+    unordered_map<descriptor::Tensor*, size_t> slots;
+    size_t num_slots = 0;
     for (auto param : get_parameters())
     {
         for (size_t i = 0; i < param->get_output_size(); ++i)
         {
-            descriptor::Tensor* tensor = &param->output(i).get_tensor();
-            tensor_map.insert({tensor, func_inputs[input_count++]});
+            slots.insert({&param->output(i).get_tensor(), num_slots++});
         }
     }
-
-    // map function outputs -> HostTensor
-    for (size_t output_count = 0; output_count < get_results().size(); ++output_count)
+    m_num_input_slots = num_slots;
+    for (auto result : get_results())
     {
-        auto output = get_results()[output_count];
-        if (!is_type<op::Result>(output))
+        if (!is_type<op::Result>(result))
         {
             throw ngraph_error("One of function's outputs isn't op::Result");
         }
-        descriptor::Tensor* tensor = &output->output(0).get_tensor();
-        tensor_map.insert({tensor, func_outputs[output_count]});
+        slots.insert({&result->output(0).get_tensor(), num_slots++});
     }
+    m_num_io_slots = num_slots;
+
+    auto get_slot = [&](descriptor::Tensor* tensor) {
+        auto it = slots.find(tensor);
+        if (it == slots.end())
+        {
+            it = slots.insert({tensor, m_num_io_slots + m_slot_tensors.size()}).first;
+            m_slot_tensors.push_back(tensor);
+        }
+        return it->second;
+    };
 
-    // for each ordered op in the graph
     for (auto op : m_nodes)
     {
-        event::Duration d2(op->description(), "Interpreter");
         if (op->is_parameter())
         {
             continue;
         }
-
-        // get op inputs from map
-        vector<shared_ptr<HostTensor>> op_inputs;
-        for (auto input : op->inputs())
+        if (auto constant = as_type_ptr<op::Constant>(op))
         {
-            descriptor::Tensor* tensor = &input.get_tensor();
-            op_inputs.push_back(tensor_map.at(tensor));
+            // Constants are read-only for every kernel, so their data is used in place
+            descriptor::Tensor* tensor = &constant->output(0).get_tensor();
+            m_constant_slots[get_slot(tensor)] =
+                make_shared<runtime::HostTensor>(tensor->get_element_type(),
+                                                 tensor->get_shape(),
+                                                 const_cast<void*>(constant->get_data_ptr()),
+                                                 tensor->get_name());
+            continue;
         }
 
-        // get op outputs from map or create
-        vector<shared_ptr<HostTensor>> op_outputs;
-        for (size_t i = 0; i < op->get_output_size(); ++i)
-        {
-            descriptor::Tensor* tensor = &op->output(i).get_tensor();
-            shared_ptr<HostTensor> host_tensor;
-            auto it = tensor_map.find(tensor);
-            if (it == tensor_map.end())
-            {
-                const Shape& shape = op->get_output_shape(i);
-                const element::Type& type = op->get_output_element_type(i);
-                string name = op->output(i).get_tensor().get_name();
-                host_tensor = make_shared<runtime::HostTensor>(type, shape, name);
-                tensor_map.insert({tensor, host_tensor});
-            }
-            else
-            {
-                host_tensor = it->second;
-            }
-            op_outputs.push_back(host_tensor);
-        }
+        Instruction instruction;
+        instruction.node = op;
+        instruction.name = op->description();
+        instruction.type_id = get_typeid(*op);
 
         // get op type
-        element::Type type;
         if (is_type<op::Convert>(op) || is_type<op::Quantize>(op) || is_type<op::Dequantize>(op) ||
             is_type<op::ArgMin>(op) || is_type<op::ArgMax>(op))
         {
-            type = op->get_input_element_type(0);
+            instruction.type = op->get_input_element_type(0);
         }
         else if (is_type<op::Equal>(op) || is_type<op::Greater>(op) || is_type<op::GreaterEq>(op) ||
                  is_type<op::Less>(op) || is_type<op::LessEq>(op) || is_type<op::NotEqual>(op))
@@ -199,35 +190,236 @@ bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::
             // Get the type of the second input, not the first
             // All BinaryElementwiseComparision ops have the same type for inputs
             // Select has bool for first input and the type we are interested in for the second
-            type = op->get_input_element_type(1);
+            instruction.type = op->get_input_element_type(1);
         }
         else if (is_type<op::TopK>(op))
         {
-            type = op->get_output_element_type(1);
+            instruction.type = op->get_output_element_type(1);
         }
         else
         {
-            type = op->get_output_element_type(0);
+            instruction.type = op->get_output_element_type(0);
+        }
+        instruction.kernel = get_kernel(instruction.type);
+        if (auto ti = as_type_ptr<op::TensorIterator>(op))
+        {
+            // The body is compiled once and called for every iteration
+            auto body = ti->get_body();
+            auto body_function =
+                make_shared<Function>(body->get_results(), body->get_parameters());
+            m_tensor_iterators[op.get()] = make_shared<TensorIteratorRunner>(
+                *ti,
+                make_shared<INTExecutable>(body_function, m_performance_counters_enabled),
+                [](const element::Type& type, const Shape& shape, void* data) {
+                    return make_shared<runtime::HostTensor>(type, shape, data);
+                },
+                [](runtime::Tensor& tensor, void* data) {
+                    static_cast<runtime::HostTensor&>(tensor).set_data_ptr(data);
+                });
+            instruction.kernel = &INTExecutable::tensor_iterator;
+        }
+
+        for (auto input : op->inputs())
+        {
+            instruction.inputs.push_back(get_slot(&input.get_tensor()));
+        }
+        for (auto output : op->outputs())
+        {
+            instruction.outputs.push_back(get_slot(&output.get_tensor()));
         }
 
+        for (size_t i = 0; i < instruction.inputs.size(); ++i)
+        {
+            if (instruction.inputs[i] < m_num_io_slots)
+            {
+                m_io_bindings.push_back({instruction.inputs[i], m_plan.size(), i, false});
+            }
+        }
+        for (size_t i = 0; i < instruction.outputs.size(); ++i)
+        {
+            if (instruction.outputs[i] < m_num_io_slots)
+            {
+                m_io_bindings.push_back({instruction.outputs[i], m_plan.size(), i, true});
+            }
+        }
+        m_plan.push_back(move(instruction));
+    }
+}
+
+runtime::interpreter::INTExecutable::Kernel
+    runtime::interpreter::INTExecutable::get_kernel(const element::Type& type)
+{
+    Kernel kernel = nullptr;
+    switch (type)
+    {
+    case element::Type_t::boolean: kernel = &INTExecutable::op_engine<char>; break;
+    case element::Type_t::f32: kernel = &INTExecutable::op_engine<float>; break;
+    case element::Type_t::f64: kernel = &INTExecutable::op_engine<double>; break;
+    case element::Type_t::i8: kernel = &INTExecutable::op_engine<int8_t>; break;
+    case element::Type_t::i16: kernel = &INTExecutable::op_engine<int16_t>; break;
+    case element::Type_t::i32: kernel = &INTExecutable::op_engine<int32_t>; break;
+    case element::Type_t::i64: kernel = &INTExecutable::op_engine<int64_t>; break;
+    case element::Type_t::u8: kernel = &INTExecutable::op_engine<uint8_t>; break;
+    case element::Type_t::u16: kernel = &INTExecutable::op_engine<uint16_t>; break;
+    case element::Type_t::u32: kernel = &INTExecutable::op_engine<uint32_t>; break;
+    case element::Type_t::u64: kernel = &INTExecutable::op_engine<uint64_t>; break;
+    case element::Type_t::undefined:
+    case element::Type_t::dynamic:
+    case element::Type_t::u1:
+    case element::Type_t::bf16:
+    case element::Type_t::f16: break;
+    }
+    return kernel;
+}
+
+unique_ptr<runtime::interpreter::INTExecutable::Arena>
+    runtime::interpreter::INTExecutable::acquire_arena()
+{
+    {
+        lock_guard<mutex> lock(m_arena_mutex);
+        if (!m_free_arenas.empty())
+        {
+            unique_ptr<Arena> arena = move(m_free_arenas.back());
+            m_free_arenas.pop_back();
+            return arena;
+        }
+    }
+
+    unique_ptr<Arena> arena(new Arena());
+    arena->buffer.reset(new AlignedBuffer(get_arena_size(), get_alignment()));
+    vector<shared_ptr<HostTensor>> slot_tensors(m_num_io_slots + m_slot_tensors.size());
+    for (size_t i = 0; i < m_slot_tensors.size(); ++i)
+    {
+        descriptor::Tensor* tensor = m_slot_tensors[i];
+        size_t slot = m_num_io_slots + i;
+        auto constant = m_constant_slots.find(slot);
+        if (constant != m_constant_slots.end())
+        {
+            slot_tensors[slot] = constant->second;
+        }
+        else
+        {
+            slot_tensors[slot] = make_shared<runtime::HostTensor>(
+                tensor->get_element_type(),
+                tensor->get_shape(),
+                arena->buffer->get_ptr(tensor->get_pool_offset()),
+                tensor->get_name());
+        }
+    }
+
+    for (const Instruction& instruction : m_plan)
+    {
+        arena->inputs.emplace_back();
+        for (size_t slot : instruction.inputs)
+        {
+            arena->inputs.back().push_back(slot_tensors[slot]);
+        }
+        arena->outputs.emplace_back();
+        for (size_t slot : instruction.outputs)
+        {
+            arena->outputs.back().push_back(slot_tensors[slot]);
+        }
+    }
+    return arena;
+}
+
+void runtime::interpreter::INTExecutable::release_arena(unique_ptr<Arena> arena)
+{
+    // Don't keep the caller's tensors alive between calls
+    for (const IOBinding& binding : m_io_bindings)
+    {
+        auto& args = binding.is_output ? arena->outputs : arena->inputs;
+        args[binding.instruction][binding.position] = nullptr;
+    }
+    lock_guard<mutex> lock(m_arena_mutex);
+    m_free_arenas.push_back(move(arena));
+}
+
+bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                               const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    event::SampledCall sampled_call;
+    event::Duration d1("call", "Interpreter");
+
+    if (m_nan_check_enabled)
+    {
+        vector<shared_ptr<HostTensor>> func_inputs;
+        for (auto tensor : inputs)
+        {
+            func_inputs.push_back(static_pointer_cast<runtime::HostTensor>(tensor));
+        }
+        perform_nan_check(func_inputs);
+    }
+    NGRAPH_CHECK(inputs.size() == m_num_input_slots &&
+                     outputs.size() == m_num_io_slots - m_num_input_slots,
+                 "Interpreter: wrong number of inputs or outputs");
+
+    // intermediates and constants are already bound in the arena
+    unique_ptr<Arena> arena = acquire_arena();
+    for (const IOBinding& binding : m_io_bindings)
+    {
+        const shared_ptr<runtime::Tensor>& tensor =
+            binding.slot < m_num_input_slots ? inputs[binding.slot]
+                                             : outputs[binding.slot - m_num_input_slots];
+        auto& args = binding.is_output ? arena->outputs : arena->inputs;
+        args[binding.instruction][binding.position] =
+            static_pointer_cast<runtime::HostTensor>(tensor);
+    }
+
+    // for each ordered op in the graph
+    for (size_t i = 0; i < m_plan.size(); ++i)
+    {
+        const Instruction& instruction = m_plan[i];
+        const Node& op = *instruction.node;
+        const vector<shared_ptr<HostTensor>>& op_inputs = arena->inputs[i];
+        const vector<shared_ptr<HostTensor>>& op_outputs = arena->outputs[i];
+        event::Duration d2(instruction.name, "Interpreter");
+
         if (m_performance_counters_enabled)
         {
-            m_timer_map[op].start();
+            m_timer_map[instruction.node].start();
+        }
+        if (instruction.kernel)
+        {
+            (this->*instruction.kernel)(instruction.type_id, op, op_outputs, op_inputs);
+        }
+        else
+        {
+            generate_calls(instruction.type, op, op_outputs, op_inputs);
         }
-        generate_calls(type, *op.get(), op_outputs, op_inputs);
         if (m_performance_counters_enabled)
         {
-            m_timer_map[op].stop();
+            m_timer_map[instruction.node].stop();
         }
         if (m_nan_check_enabled)
         {
-            perform_nan_check(op_outputs, op.get());
+            perform_nan_check(op_outputs, &op);
         }
     }
+    release_arena(move(arena));
 
     return true;
 }
 
+void runtime::interpreter::INTExecutable::tensor_iterator(
+    OP_TYPEID /* type_id */,
+    const Node& node,
+    const vector<shared_ptr<HostTensor>>& out,
+    const vector<shared_ptr<HostTensor>>& args)
+{
+    vector<void*> inputs;
+    for (auto& arg : args)
+    {
+        inputs.push_back(arg->get_data_ptr());
+    }
+    vector<void*> outputs;
+    for (auto& output : out)
+    {
+        outputs.push_back(output->get_data_ptr());
+    }
+    m_tensor_iterators.at(&node)->run(inputs, outputs);
+}
+
 void runtime::interpreter::INTExecutable::generate_calls(const element::Type& type,
                                                          const Node& op,
                                                          const vector<shared_ptr<HostTensor>>& out,
@@ -325,9 +517,11 @@ void runtime::interpreter::INTExecutable::perform_nan_check(
 void runtime::interpreter::INTExecutable::save(ostream& out)
 {
     cpio::Writer writer(out);
-    string si = "INTERPRETER Save File 1.0";
+    string si = "INTERPRETER Save File 1.1";
     writer.write("save_info", si.data(), si.size());
-    string model = serialize(m_function, 0);
+    stringstream ss;
+    serialize_binary(ss, m_function);
+    string model = ss.str();
     writer.write("model", model.data(), model.size());
 }
 
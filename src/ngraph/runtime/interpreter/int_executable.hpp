@@ -19,8 +19,10 @@
 #include <initializer_list>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "ngraph/ops.hpp"
@@ -117,6 +119,7 @@
 #include "ngraph/runtime/reference/topk.hpp"
 #include "ngraph/runtime/reference/xor.hpp"
 #include "ngraph/runtime/tensor.hpp"
+#include "ngraph/runtime/tensor_iterator_runner.hpp"
 #include "ngraph/state/bernoulli_rng_state.hpp"
 #include "ngraph/state/uniform_rng_state.hpp"
 
@@ -172,8 +175,61 @@ public:
     std::vector<std::shared_ptr<runtime::Tensor>>
         create_output_tensor(size_t output_index, size_t pipeline_depth) override;
 
+    /// \brief Size in bytes of the arena holding all intermediate tensors of one call
+    size_t get_arena_size() const { return m_function->get_temporary_pool_size(); }
 protected:
     INTExecutable(const std::string& model_string);
+    /// \brief Loads the model that starts at the current position of model_stream
+    INTExecutable(std::istream& model_stream);
+
+    using Kernel = void (INTExecutable::*)(OP_TYPEID,
+                                           const Node&,
+                                           const std::vector<std::shared_ptr<HostTensor>>&,
+                                           const std::vector<std::shared_ptr<HostTensor>>&);
+
+    /// \brief One op of the execution plan, resolved when the executable is compiled.
+    ///
+    /// Inputs and outputs are slot indices. Slots [0, m_num_io_slots) are the function inputs
+    /// followed by the function outputs, the remaining slots are intermediates and constants.
+    struct Instruction
+    {
+        std::shared_ptr<Node> node;
+        std::string name;
+        OP_TYPEID type_id;
+        element::Type type;
+        // nullptr if the element type is not supported; generate_calls reports the error
+        Kernel kernel;
+        std::vector<size_t> inputs;
+        std::vector<size_t> outputs;
+    };
+
+    /// \brief Position of a function input or output in the argument lists of an instruction
+    struct IOBinding
+    {
+        size_t slot;
+        size_t instruction;
+        size_t position;
+        bool is_output;
+    };
+
+    /// \brief Backing memory and bound argument lists for one call.
+    ///
+    /// Tensor offsets are planned once by pass::MemoryLayout, so tensors whose lifetimes do
+    /// not overlap share memory. The argument lists of every instruction are built when the
+    /// arena is created; only the entries listed in m_io_bindings change between calls.
+    struct Arena
+    {
+        std::unique_ptr<AlignedBuffer> buffer;
+        std::vector<std::vector<std::shared_ptr<HostTensor>>> inputs;
+        std::vector<std::vector<std::shared_ptr<HostTensor>>> outputs;
+    };
+
+    /// \brief Runs the passes a loaded function needs and builds its execution plan
+    void prepare_loaded_function();
+    void build_execution_plan();
+    std::unique_ptr<Arena> acquire_arena();
+    void release_arena(std::unique_ptr<Arena> arena);
+    static Kernel get_kernel(const element::Type& type);
 
     std::shared_ptr<ngraph::op::Parameter> get_parameter(size_t index) const;
     std::shared_ptr<ngraph::op::Result> get_result(size_t index) const;
@@ -185,13 +241,31 @@ protected:
     std::unordered_map<std::shared_ptr<const Node>, stopwatch> m_timer_map;
     std::vector<std::shared_ptr<Node>> m_nodes;
     std::unordered_map<const Node*, std::shared_ptr<State>> m_states;
+    // TensorIterators with their compiled bodies, built with the execution plan
+    std::unordered_map<const Node*, std::shared_ptr<TensorIteratorRunner>> m_tensor_iterators;
     std::set<std::string> m_unsupported_op_name_list;
+    std::vector<Instruction> m_plan;
+    std::vector<IOBinding> m_io_bindings;
+    size_t m_num_input_slots = 0;
+    size_t m_num_io_slots = 0;
+    // Tensor of every intermediate slot, indexed by slot - m_num_io_slots
+    std::vector<descriptor::Tensor*> m_slot_tensors;
+    std::unordered_map<size_t, std::shared_ptr<HostTensor>> m_constant_slots;
+    // Arenas not in use by a call. Concurrent calls each take their own arena.
+    std::vector<std::unique_ptr<Arena>> m_free_arenas;
+    std::mutex m_arena_mutex;
 
     static OP_TYPEID get_typeid(const Node& node);
 
     static void perform_nan_check(const std::vector<std::shared_ptr<HostTensor>>&,
                                   const Node* op = nullptr);
 
+    /// \brief Kernel of TensorIterator, which runs the compiled body for every iteration
+    void tensor_iterator(OP_TYPEID type_id,
+                         const Node& node,
+                         const std::vector<std::shared_ptr<HostTensor>>& out,
+                         const std::vector<std::shared_ptr<HostTensor>>& args);
+
     virtual void generate_calls(const element::Type& type,
                                 const Node& op,
                                 const std::vector<std::shared_ptr<HostTensor>>& outputs,
@@ -202,6 +276,15 @@ protected:
                    const std::vector<std::shared_ptr<HostTensor>>& out,
                    const std::vector<std::shared_ptr<HostTensor>>& args)
     {
+        op_engine<T>(get_typeid(node), node, out, args);
+    }
+
+    template <typename T>
+    void op_engine(OP_TYPEID type_id,
+                   const Node& node,
+                   const std::vector<std::shared_ptr<HostTensor>>& out,
+                   const std::vector<std::shared_ptr<HostTensor>>& args)
+    {
 // We want to check that every OP_TYPEID enumeration is included in the list.
 // These GCC flags enable compile-time checking so that if an enumeration
 // is not in the list an error is generated.
@@ -210,7 +293,7 @@ protected:
 #pragma GCC diagnostic error "-Wswitch"
 #pragma GCC diagnostic error "-Wswitch-enum"
 #endif
-        switch (get_typeid(node))
+        switch (type_id)
         {
         case OP_TYPEID::Abs:
         {
@@ -1881,7 +1964,7 @@ protected:
         case OP_TYPEID::Squeeze:
         case OP_TYPEID::Stack:
         case OP_TYPEID::Unsqueeze:
-        // Tensor Iterator not yet supported
+        // TensorIterator runs through INTExecutable::tensor_iterator for every element type
         case OP_TYPEID::TensorIterator:
         case OP_TYPEID::UnknownOp:
             throw unsupported_op("Unsupported op '" + node.description() + "'");
@@ -60,11 +60,11 @@ namespace
             PLAIDML_DEBUG << "Output: descriptor::Tensor " << tensor << " "
                           << op.get_output_shape(out_idx) << op.get_output_element_type(out_idx);
         }
-        for (auto* t : op.liveness_new_list)
+        for (auto* t : op.get_liveness_new_list())
         {
             PLAIDML_DEBUG << "New tensor: " << t;
         }
-        for (auto* t : op.liveness_free_list)
+        for (auto* t : op.get_liveness_free_list())
         {
             PLAIDML_DEBUG << "Retire tensor: " << t;
         }
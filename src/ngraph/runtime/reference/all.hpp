@@ -19,6 +19,7 @@
 #include <cmath>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/dense_walk.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -33,22 +34,11 @@ namespace ngraph
                                    const Shape& out_shape,
                                    const AxisSet& reduction_axes)
             {
-                CoordinateTransform output_transform(out_shape);
+                std::fill(out, out + shape_size(out_shape), 1);
 
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = 1;
-                }
-
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes);
-                    out[output_transform.index(output_coord)] =
-                        out[output_transform.index(output_coord)] &&
-                        arg[input_transform.index(input_coord)];
-                }
+                reduce_dense(arg, out, in_shape, reduction_axes, [](char& all, char x) {
+                    all = all && x;
+                });
             }
         }
     }
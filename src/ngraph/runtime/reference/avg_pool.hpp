@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cfenv>
 #include <cmath>
 #include <numeric>
@@ -24,6 +25,7 @@
 
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/dense_walk.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph
@@ -134,118 +136,71 @@ namespace ngraph
             {
                 auto old_mode = std::fegetround();
                 std::fesetround(FE_TONEAREST);
-                // At the outermost level we will walk over every output coordinate O.
-                CoordinateTransform output_transform(out_shape);
 
-                for (const Coordinate& out_coord : output_transform)
+                // The output coordinate (N,chan,i_1,...,i_n) averages the input coordinates
+                //
+                //   (N,chan,s_1*i_1-p_1+w_1,...,s_n*i_n-p_n+w_n) for 0 <= w_j < window_shape_j
+                //
+                // Coordinates in the padding area add nothing to the sum, and only count as
+                // elements if include_padding_in_avg_computation is set. Every (N,chan) image
+                // is a contiguous block of both the input and the output.
+                size_t n_spatial_dimensions = arg_shape.size() - 2;
+                Shape arg_image_shape(arg_shape.begin() + 2, arg_shape.end());
+                Shape out_image_shape(out_shape.begin() + 2, out_shape.end());
+                size_t arg_image_size = shape_size(arg_image_shape);
+                size_t out_image_size = shape_size(out_image_shape);
+                DenseWindow window(arg_image_shape,
+                                   window_shape,
+                                   window_movement_strides,
+                                   Strides(n_spatial_dimensions, 1),
+                                   CoordinateDiff(padding_below.begin(), padding_below.end()));
+
+                std::vector<size_t> out_coord(n_spatial_dimensions);
+                for (size_t image = 0; image < out_shape[0] * out_shape[1]; image++)
                 {
-                    // Our output coordinate O will have the form:
-                    //
-                    //   (N,chan,i_1,...,i_n)
-
-                    size_t batch_index = out_coord[0];
-                    size_t channel = out_coord[1];
-
-                    // For the input data we need to iterate the coordinate:
-                    //
-                    //   I:
-                    //
-                    // over the range (noninclusive on the right):
-                    //
-                    //   (N,chan,s_1*i_1,s_2*i_2,...,s_n*i_n) ->
-                    //
-                    //     (N+1,chan+1,s_1*i_1 + window_shape_1,...,s_n*i_n + window_shape_n)
-                    //
-                    // with unit stride.
-                    //
-                    // We iterate this over the *padded* data, so below we will need to check for
-                    // coordinates that fall in the padding area.
-
-                    size_t n_spatial_dimensions = arg_shape.size() - 2;
-
-                    Coordinate input_batch_transform_start(2 + n_spatial_dimensions);
-                    Coordinate input_batch_transform_end(2 + n_spatial_dimensions);
-                    Strides input_batch_transform_source_strides(2 + n_spatial_dimensions, 1);
-                    AxisVector input_batch_transform_source_axis_order(2 + n_spatial_dimensions);
-                    CoordinateDiff input_batch_transform_padding_below(2 + n_spatial_dimensions);
-                    CoordinateDiff input_batch_transform_padding_above(2 + n_spatial_dimensions);
-
-                    input_batch_transform_start[0] = batch_index;
-                    input_batch_transform_end[0] = batch_index + 1;
-                    input_batch_transform_start[1] = channel;
-                    input_batch_transform_end[1] = channel + 1;
-                    input_batch_transform_padding_below[0] = 0;
-                    input_batch_transform_padding_below[1] = 0;
-                    input_batch_transform_padding_above[0] = 0;
-                    input_batch_transform_padding_above[1] = 0;
-
-                    for (size_t i = 2; i < n_spatial_dimensions + 2; i++)
+                    const T* arg_image = arg + image * arg_image_size;
+                    T* out_image = out + image * out_image_size;
+                    std::fill(out_coord.begin(), out_coord.end(), 0);
+                    for (size_t out_index = 0; out_index < out_image_size; out_index++)
                     {
-                        size_t window_shape_this_dim = window_shape[i - 2];
-                        size_t movement_stride = window_movement_strides[i - 2];
-
-                        input_batch_transform_start[i] = movement_stride * out_coord[i];
-                        input_batch_transform_end[i] =
-                            input_batch_transform_start[i] + window_shape_this_dim;
-                        input_batch_transform_padding_below[i] = padding_below[i - 2];
-                        input_batch_transform_padding_above[i] = padding_above[i - 2];
-                    }
+                        T result = 0;
+                        size_t n_elements = window.place(out_coord);
+                        window.for_each(
+                            [&](size_t in_offset, size_t) { result += arg_image[in_offset]; });
 
-                    for (size_t i = 0; i < arg_shape.size(); i++)
-                    {
-                        input_batch_transform_source_axis_order[i] = i;
-                    }
-
-                    CoordinateTransform input_batch_transform(
-                        arg_shape,
-                        input_batch_transform_start,
-                        input_batch_transform_end,
-                        input_batch_transform_source_strides,
-                        input_batch_transform_source_axis_order,
-                        input_batch_transform_padding_below,
-                        input_batch_transform_padding_above);
-
-                    // As we go, we compute the sum value:
-                    //
-                    //   output[O] := output[O] + arg[I]
-                    //
-                    // and the number of elements:
-                    //
-                    //   n_elements := n_elements + 1
-
-                    T result = 0;
-                    size_t n_elements = 0;
-
-                    for (const Coordinate& input_batch_coord : input_batch_transform)
-                    {
-                        bool in_bounds =
-                            input_batch_transform.has_source_coordinate(input_batch_coord);
-
-                        if (in_bounds || include_padding_in_avg_computation)
+                        if (include_padding_in_avg_computation)
                         {
-                            T v =
-                                in_bounds ? arg[input_batch_transform.index(input_batch_coord)] : 0;
-                            result += v;
-                            n_elements++;
+                            // Window positions inside the padded input
+                            n_elements = 1;
+                            for (size_t i = 0; i < n_spatial_dimensions; i++)
+                            {
+                                int64_t padded_size = arg_image_shape[i] + padding_below[i] +
+                                                      padding_above[i] -
+                                                      out_coord[i] * window_movement_strides[i];
+                                n_elements *= static_cast<size_t>(std::max<int64_t>(
+                                    0,
+                                    std::min<int64_t>(window_shape[i], padded_size)));
+                            }
                         }
-                    }
 
-                    if (n_elements == 0)
-                    {
-                        throw std::runtime_error("AvgPool elements == 0, must be non-zero");
-                    }
+                        if (n_elements == 0)
+                        {
+                            throw std::runtime_error("AvgPool elements == 0, must be non-zero");
+                        }
 
-                    if (std::is_same<T, int8_t>::value || std::is_same<T, uint8_t>::value)
-                    {
-                        out[output_transform.index(out_coord)] =
-                            static_cast<T>(std::nearbyint(static_cast<float>(result) / n_elements));
-                    }
-                    else
-                    {
-                        out[output_transform.index(out_coord)] = result / n_elements;
+                        if (std::is_same<T, int8_t>::value || std::is_same<T, uint8_t>::value)
+                        {
+                            out_image[out_index] = static_cast<T>(
+                                std::nearbyint(static_cast<float>(result) / n_elements));
+                        }
+                        else
+                        {
+                            out_image[out_index] = result / n_elements;
+                        }
+                        next_coordinate(out_coord, out_image_shape);
                     }
-                    std::fesetround(old_mode);
                 }
+                std::fesetround(old_mode);
             }
         }
     }
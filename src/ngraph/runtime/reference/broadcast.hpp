@@ -19,6 +19,7 @@
 #include <cmath>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/dense_walk.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -30,38 +31,25 @@ namespace ngraph
             template <typename T>
             void broadcast(const T* arg,
                            T* out,
-                           const Shape& in_shape,
+                           const Shape& /* in_shape */,
                            const Shape& out_shape,
                            const AxisSet& broadcast_axes)
             {
-                // Remove all broadcast axes from in_shape
-                Shape adjusted_in_shape;
-                for (auto length : in_shape)
-                {
-                    if (length != 1)
-                    {
-                        adjusted_in_shape.push_back(length);
-                    }
-                }
-                // Remove 1s from out_shape
-                AxisSet adjusted_axes(broadcast_axes);
-                for (uint64_t axis = 0; axis < out_shape.size(); ++axis)
-                {
-                    auto length = out_shape.at(axis);
-                    if (length == 1)
-                    {
-                        adjusted_axes.insert(axis);
-                    }
-                }
-                CoordinateTransform input_transform(adjusted_in_shape);
-                CoordinateTransform output_transform(out_shape);
-
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    Coordinate input_coord = reduce(output_coord, adjusted_axes);
-                    out[output_transform.index(output_coord)] =
-                        arg[input_transform.index(input_coord)];
-                }
+                // The input is the output with the broadcast axes removed, axes of length 1 in
+                // either shape do not change offsets
+                for_each_projected_run(
+                    out_shape,
+                    broadcast_axes,
+                    [&](size_t out_offset, size_t in_offset, size_t count, size_t in_step) {
+                        if (in_step == 0)
+                        {
+                            std::fill(out + out_offset, out + out_offset + count, arg[in_offset]);
+                        }
+                        else
+                        {
+                            std::copy(arg + in_offset, arg + in_offset + count, out + out_offset);
+                        }
+                    });
             }
         }
     }
@@ -16,12 +16,15 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cfenv>
 #include <cmath>
 #include <functional>
+#include <vector>
 
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/dense_walk.hpp"
 #include "ngraph/runtime/reference/reverse.hpp"
 #include "ngraph/util.hpp"
 
@@ -89,6 +92,98 @@ namespace ngraph
 
                 auto old_mode = std::fegetround();
                 std::fesetround(FE_TONEAREST);
+
+                auto accumulate = [&](ACCUMULATION& result,
+                                      size_t in_idx,
+                                      size_t filter_idx,
+                                      size_t n_in_channels,
+                                      size_t in_channel_stride,
+                                      size_t filter_in_channel_stride) {
+                    for (size_t in_channel = 0; in_channel < n_in_channels; ++in_channel)
+                    {
+                        ACCUMULATION in_v = static_cast<ACCUMULATION>(in[in_idx]);
+                        ACCUMULATION f_v = static_cast<ACCUMULATION>(filter[filter_idx]);
+                        if (is_quantized)
+                        {
+                            in_v = in_v - static_cast<ACCUMULATION>(*input_zero_point);
+                            f_v = f_v - static_cast<ACCUMULATION>(*filter_zero_point);
+                        }
+                        result += in_v * f_v;
+                        in_idx += in_channel_stride;
+                        filter_idx += filter_in_channel_stride;
+                    }
+                };
+                auto store = [&](size_t out_idx, ACCUMULATION result) {
+                    if (is_quantized)
+                    {
+                        float scale = *input_scale * *filter_scale / *output_scale;
+                        out[out_idx] =
+                            static_cast<OUTPUT>(std::round(static_cast<float>(result) * scale)) +
+                            *output_zero_point;
+                    }
+                    else
+                    {
+                        out[out_idx] = result;
+                    }
+                };
+
+                if (std::all_of(in_dilation.begin(), in_dilation.end(), [](size_t s) {
+                        return s == 1;
+                    }))
+                {
+                    // Without input dilation every window tap either hits an input element or the
+                    // padding, so the window is walked with plain offsets. The spatial axes are
+                    // always the trailing ones and the taps are visited in the same order as the
+                    // general loop below, so the sums are identical.
+                    size_t n_spatial_dimensions = in_shape.size() - 2;
+                    Shape in_spatial_shape(in_shape.begin() + 2, in_shape.end());
+                    Shape filter_spatial_shape(filter_shape.begin() + 2, filter_shape.end());
+                    Shape out_spatial_shape(out_shape.begin() + 2, out_shape.end());
+                    Strides in_strides = row_major_strides(in_shape);
+                    Strides filter_strides = row_major_strides(filter_shape);
+                    Strides out_strides = row_major_strides(out_shape);
+                    size_t n_in_channels = in_shape[in_channel_axis];
+                    size_t out_spatial_size = shape_size(out_spatial_shape);
+                    DenseWindow window(in_spatial_shape,
+                                       filter_spatial_shape,
+                                       stride,
+                                       filter_dilation,
+                                       in_pad_below);
+
+                    std::vector<size_t> out_coord(n_spatial_dimensions);
+                    for (size_t batch_index = 0; batch_index < out_shape[out_batch_axis];
+                         batch_index++)
+                    {
+                        for (size_t out_channel = 0; out_channel < out_shape[out_channel_axis];
+                             out_channel++)
+                        {
+                            size_t in_base = batch_index * in_strides[in_batch_axis];
+                            size_t filter_base =
+                                out_channel * filter_strides[filter_out_channel_axis];
+                            size_t out_base = batch_index * out_strides[out_batch_axis] +
+                                              out_channel * out_strides[out_channel_axis];
+                            std::fill(out_coord.begin(), out_coord.end(), 0);
+                            for (size_t out_index = 0; out_index < out_spatial_size; out_index++)
+                            {
+                                ACCUMULATION result = 0;
+                                window.place(out_coord);
+                                window.for_each([&](size_t in_offset, size_t filter_offset) {
+                                    accumulate(result,
+                                               in_base + in_offset,
+                                               filter_base + filter_offset,
+                                               n_in_channels,
+                                               in_strides[in_channel_axis],
+                                               filter_strides[filter_in_channel_axis]);
+                                });
+                                store(out_base + out_index, result);
+                                next_coordinate(out_coord, out_spatial_shape);
+                            }
+                        }
+                    }
+                    std::fesetround(old_mode);
+                    return;
+                }
+
                 // Comments throughout assume without loss of generality that:
                 //
                 // * batch axes for both in and out are 0
@@ -232,34 +327,17 @@ namespace ngraph
                             size_t in_idx = in_transform.index(in_coord);
                             const Coordinate& filter_coord = *filter_it;
                             size_t filter_idx = filter_transform.index(filter_coord);
-                            for (size_t in_channel = 0; in_channel < n_in_channels; ++in_channel)
-                            {
-                                ACCUMULATION in_v = static_cast<ACCUMULATION>(in[in_idx]);
-                                ACCUMULATION f_v = static_cast<ACCUMULATION>(filter[filter_idx]);
-                                if (is_quantized)
-                                {
-                                    in_v = in_v - static_cast<ACCUMULATION>(*input_zero_point);
-                                    f_v = f_v - static_cast<ACCUMULATION>(*filter_zero_point);
-                                }
-                                result += in_v * f_v;
-                                in_idx += in_channel_stride;
-                                filter_idx += filter_in_channel_stride;
-                            }
+                            accumulate(result,
+                                       in_idx,
+                                       filter_idx,
+                                       n_in_channels,
+                                       in_channel_stride,
+                                       filter_in_channel_stride);
                         }
                         ++in_it;
                         ++filter_it;
                     }
-                    if (is_quantized)
-                    {
-                        float scale = *input_scale * *filter_scale / *output_scale;
-                        out[out_transform.index(out_coord)] =
-                            static_cast<OUTPUT>(std::round(static_cast<float>(result) * scale)) +
-                            *output_zero_point;
-                    }
-                    else
-                    {
-                        out[out_transform.index(out_coord)] = result;
-                    }
+                    store(out_transform.index(out_coord), result);
                 }
                 std::fesetround(old_mode);
             }
@@ -0,0 +1,317 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/coordinate_diff.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/strides.hpp"
+
+// Index arithmetic for the common case of dense row-major tensors. Unlike CoordinateTransform,
+// these walks allocate nothing per element and hand contiguous runs to the caller, so kernels
+// can keep tight inner loops. Elements are always visited in the order a CoordinateTransform
+// would visit them, so results (including rounding) do not change.
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Walks a dense row-major tensor of shape `shape` together with the row-major
+            ///        offset of each element in the tensor obtained by removing `axes`.
+            ///
+            /// Calls f(offset, projected_offset, count, projected_step) for runs of `count`
+            /// consecutive elements. If projected_step is 1 the run maps to consecutive projected
+            /// elements, if it is 0 the whole run maps to projected_offset. Reductions walk their
+            /// input with the reduction axes removed, broadcasts walk their output with the
+            /// broadcast axes removed.
+            template <typename F>
+            void for_each_projected_run(const Shape& shape, const AxisSet& axes, F f)
+            {
+                // Merge neighbouring axes that are both removed or both kept, axes of length 1
+                // move neither offset
+                std::vector<size_t> sizes;
+                std::vector<char> removed;
+                for (size_t axis = 0; axis < shape.size(); axis++)
+                {
+                    if (shape[axis] == 0)
+                    {
+                        return;
+                    }
+                    if (shape[axis] == 1)
+                    {
+                        continue;
+                    }
+                    char is_removed = axes.count(axis) != 0;
+                    if (!sizes.empty() && removed.back() == is_removed)
+                    {
+                        sizes.back() *= shape[axis];
+                    }
+                    else
+                    {
+                        sizes.push_back(shape[axis]);
+                        removed.push_back(is_removed);
+                    }
+                }
+                if (sizes.empty())
+                {
+                    f(0, 0, 1, 1);
+                    return;
+                }
+
+                size_t rank = sizes.size();
+                std::vector<size_t> projected_strides(rank, 0);
+                size_t projected_stride = 1;
+                for (size_t i = rank; i-- > 0;)
+                {
+                    if (!removed[i])
+                    {
+                        projected_strides[i] = projected_stride;
+                        projected_stride *= sizes[i];
+                    }
+                }
+
+                size_t count = sizes[rank - 1];
+                size_t projected_step = removed[rank - 1] ? 0 : 1;
+                std::vector<size_t> counters(rank, 0);
+                size_t offset = 0;
+                size_t projected_offset = 0;
+                while (true)
+                {
+                    f(offset, projected_offset, count, projected_step);
+                    offset += count;
+
+                    size_t axis = rank - 1;
+                    while (true)
+                    {
+                        if (axis == 0)
+                        {
+                            return;
+                        }
+                        axis--;
+                        projected_offset += projected_strides[axis];
+                        if (++counters[axis] < sizes[axis])
+                        {
+                            break;
+                        }
+                        projected_offset -= projected_strides[axis] * sizes[axis];
+                        counters[axis] = 0;
+                    }
+                }
+            }
+
+            /// \brief Folds `arg` into `out` along `reduction_axes` by calling op(out[j], arg[i])
+            ///        for every input element i, in row-major order of the input. `out` must be
+            ///        initialized by the caller.
+            template <typename T, typename U, typename OP>
+            void reduce_dense(const T* arg,
+                              U* out,
+                              const Shape& in_shape,
+                              const AxisSet& reduction_axes,
+                              OP op)
+            {
+                for_each_projected_run(
+                    in_shape,
+                    reduction_axes,
+                    [&](size_t in_offset, size_t out_offset, size_t count, size_t out_step) {
+                        const T* in = arg + in_offset;
+                        U* o = out + out_offset;
+                        if (out_step == 0)
+                        {
+                            for (size_t i = 0; i < count; i++)
+                            {
+                                op(*o, in[i]);
+                            }
+                        }
+                        else
+                        {
+                            for (size_t i = 0; i < count; i++)
+                            {
+                                op(o[i], in[i]);
+                            }
+                        }
+                    });
+            }
+
+            /// \brief Positions of a pooling or convolution window over the spatial axes of a
+            ///        dense row-major tensor.
+            ///
+            /// After place() moves the window to an output position, for_each() visits the window
+            /// positions that fall inside the unpadded input in row-major window order, with their
+            /// offsets in the spatial part of the input and in the window. Along every axis those
+            /// positions form an interval, so padding costs nothing per element.
+            class DenseWindow
+            {
+            public:
+                /// \param in_shape Spatial shape of the input
+                /// \param window_shape Spatial shape of the window
+                /// \param movement_strides Window stride between output positions
+                /// \param window_dilation Distance between window taps, all 1 for pooling
+                /// \param pad_below Padding below each spatial axis, may be negative
+                DenseWindow(const Shape& in_shape,
+                            const Shape& window_shape,
+                            const Strides& movement_strides,
+                            const Strides& window_dilation,
+                            const CoordinateDiff& pad_below)
+                    : m_in_shape(in_shape)
+                    , m_window_shape(window_shape)
+                    , m_movement_strides(movement_strides)
+                    , m_window_dilation(window_dilation)
+                    , m_pad_below(pad_below)
+                    , m_in_strides(in_shape.size())
+                    , m_window_strides(window_shape.size())
+                    , m_begin(in_shape.size())
+                    , m_end(in_shape.size())
+                    , m_start(in_shape.size())
+                    , m_counters(in_shape.size())
+                {
+                    size_t in_stride = 1;
+                    size_t window_stride = 1;
+                    for (size_t i = in_shape.size(); i-- > 0;)
+                    {
+                        m_in_strides[i] = in_stride;
+                        m_window_strides[i] = window_stride;
+                        in_stride *= in_shape[i];
+                        window_stride *= window_shape[i];
+                    }
+                }
+
+                /// \brief Moves the window to the output position `out_coord` (spatial axes only)
+                /// \returns the number of window positions inside the unpadded input
+                size_t place(const std::vector<size_t>& out_coord)
+                {
+                    size_t count = 1;
+                    for (size_t i = 0; i < m_in_shape.size(); i++)
+                    {
+                        int64_t start = static_cast<int64_t>(out_coord[i] * m_movement_strides[i]) -
+                                        m_pad_below[i];
+                        int64_t dilation = m_window_dilation[i];
+                        int64_t window = m_window_shape[i];
+                        int64_t in_size = m_in_shape[i];
+                        // First and one past the last tap t with 0 <= start + t * dilation < size
+                        int64_t begin = start >= 0 ? 0 : (-start + dilation - 1) / dilation;
+                        int64_t end = start >= in_size ? 0 : (in_size - start + dilation - 1) /
+                                                                 dilation;
+                        begin = std::min(begin, window);
+                        end = std::max(std::min(end, window), begin);
+                        m_begin[i] = static_cast<size_t>(begin);
+                        m_end[i] = static_cast<size_t>(end);
+                        m_start[i] = start;
+                        count *= m_end[i] - m_begin[i];
+                    }
+                    m_count = count;
+                    return count;
+                }
+
+                /// \brief Calls f(in_offset, window_offset) for the positions found by place()
+                template <typename F>
+                void for_each(F f)
+                {
+                    if (m_count == 0)
+                    {
+                        return;
+                    }
+                    size_t rank = m_in_shape.size();
+                    if (rank == 0)
+                    {
+                        f(0, 0);
+                        return;
+                    }
+
+                    size_t in_offset = 0;
+                    size_t window_offset = 0;
+                    for (size_t i = 0; i < rank; i++)
+                    {
+                        m_counters[i] = m_begin[i];
+                        in_offset += static_cast<size_t>(
+                                         m_start[i] +
+                                         static_cast<int64_t>(m_begin[i] * m_window_dilation[i])) *
+                                     m_in_strides[i];
+                        window_offset += m_begin[i] * m_window_strides[i];
+                    }
+
+                    size_t inner = rank - 1;
+                    size_t inner_in_step = m_window_dilation[inner] * m_in_strides[inner];
+                    size_t inner_count = m_end[inner] - m_begin[inner];
+                    while (true)
+                    {
+                        for (size_t t = 0; t < inner_count; t++)
+                        {
+                            f(in_offset + t * inner_in_step, window_offset + t);
+                        }
+
+                        size_t axis = inner;
+                        while (true)
+                        {
+                            if (axis == 0)
+                            {
+                                return;
+                            }
+                            axis--;
+                            size_t in_step = m_window_dilation[axis] * m_in_strides[axis];
+                            in_offset += in_step;
+                            window_offset += m_window_strides[axis];
+                            if (++m_counters[axis] < m_end[axis])
+                            {
+                                break;
+                            }
+                            size_t taps = m_end[axis] - m_begin[axis];
+                            in_offset -= in_step * taps;
+                            window_offset -= m_window_strides[axis] * taps;
+                            m_counters[axis] = m_begin[axis];
+                        }
+                    }
+                }
+
+            private:
+                Shape m_in_shape;
+                Shape m_window_shape;
+                Strides m_movement_strides;
+                Strides m_window_dilation;
+                CoordinateDiff m_pad_below;
+                std::vector<size_t> m_in_strides;
+                std::vector<size_t> m_window_strides;
+                std::vector<size_t> m_begin;
+                std::vector<size_t> m_end;
+                std::vector<int64_t> m_start;
+                std::vector<size_t> m_counters;
+                size_t m_count = 0;
+            };
+
+            /// \brief Row-major odometer over the spatial axes `shape`, for kernels that walk an
+            ///        output position by position
+            inline bool next_coordinate(std::vector<size_t>& coord, const Shape& shape)
+            {
+                for (size_t i = coord.size(); i-- > 0;)
+                {
+                    if (++coord[i] < shape[i])
+                    {
+                        return true;
+                    }
+                    coord[i] = 0;
+                }
+                return false;
+            }
+        }
+    }
+}
@@ -16,8 +16,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <utility>
+#include <vector>
 
 #include <cfenv>
 #include <functional>
@@ -56,6 +58,46 @@ namespace ngraph
                     is_quantized = true;
                 }
 
+                if (!is_quantized)
+                {
+                    // Without zero points and scales the dot is a plain (M x K) * (K x N) matrix
+                    // product over the flattened row-major arguments. Output columns are processed
+                    // in blocks so that the partial sums and the rows of arg1 stay in cache, and
+                    // every sum still accumulates in ascending K order like the general loop below.
+                    size_t m_size = shape_size(
+                        Shape(arg0_shape.begin(), arg0_shape.end() - reduction_axes_count));
+                    size_t k_size = shape_size(
+                        Shape(arg1_shape.begin(), arg1_shape.begin() + reduction_axes_count));
+                    size_t n_size = shape_size(
+                        Shape(arg1_shape.begin() + reduction_axes_count, arg1_shape.end()));
+                    const size_t n_block_size = 64;
+                    std::vector<ACCUMULATION> sums(std::min(n_size, n_block_size));
+                    for (size_t n_begin = 0; n_begin < n_size; n_begin += n_block_size)
+                    {
+                        size_t n_count = std::min(n_block_size, n_size - n_begin);
+                        for (size_t m = 0; m < m_size; m++)
+                        {
+                            std::fill(sums.begin(), sums.begin() + n_count, ACCUMULATION(0));
+                            const INPUT0* arg0_row = arg0 + m * k_size;
+                            for (size_t k = 0; k < k_size; k++)
+                            {
+                                auto a = static_cast<ACCUMULATION>(arg0_row[k]);
+                                const INPUT1* arg1_row = arg1 + k * n_size + n_begin;
+                                for (size_t n = 0; n < n_count; n++)
+                                {
+                                    sums[n] += a * static_cast<ACCUMULATION>(arg1_row[n]);
+                                }
+                            }
+                            OUTPUT* out_row = out + m * n_size + n_begin;
+                            for (size_t n = 0; n < n_count; n++)
+                            {
+                                out_row[n] = sums[n];
+                            }
+                        }
+                    }
+                    return;
+                }
+
                 auto old_mode = std::fegetround();
                 std::fesetround(FE_TONEAREST);
                 // Get the sizes of the dot axes. It's easiest to pull them from arg1 because
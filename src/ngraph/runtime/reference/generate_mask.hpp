@@ -16,9 +16,11 @@
 
 #pragma once
 
-#include <random>
+#include <algorithm>
+#include <cstdint>
 
 #include "ngraph/state/bernoulli_rng_state.hpp"
+#include "ngraph/state/philox.hpp"
 
 namespace ngraph
 {
@@ -26,32 +28,58 @@ namespace ngraph
     {
         namespace reference
         {
+            /// \brief Draws mask values [offset, offset + count) of a Bernoulli stream. Each
+            /// value consumes one value of the generator.
+            template <typename T>
+            void generate_mask_range(T* out,
+                                     size_t count,
+                                     const ngraph::Philox4x32& generator,
+                                     uint64_t offset,
+                                     double prob)
+            {
+                const size_t block_size = 1024;
+                uint32_t bits[block_size];
+                uint64_t threshold = ngraph::bernoulli_threshold(prob);
+                for (size_t start = 0; start < count; start += block_size)
+                {
+                    size_t n = std::min(block_size, count - start);
+                    generator.generate(bits, n, offset + start);
+                    for (size_t i = 0; i < n; i++)
+                    {
+                        out[start + i] = static_cast<T>(bits[i] < threshold);
+                    }
+                }
+            }
+
             template <typename T>
             void generate_mask(T* out,
                                size_t count,
                                ngraph::BernoulliRNGState* rng_state,
                                bool training)
             {
-                auto& gen = rng_state->get_generator();
-                auto& bd = rng_state->get_distribution();
-
-                for (size_t i = 0; i < count; i++)
+                if (!training)
                 {
-                    out[i] = training ? static_cast<T>(bd(gen)) : static_cast<T>(1);
+                    std::fill(out, out + count, static_cast<T>(1));
+                    return;
                 }
+                uint64_t offset = rng_state->advance(count);
+                generate_mask_range(out,
+                                    count,
+                                    rng_state->get_generator(),
+                                    offset,
+                                    rng_state->get_probability());
             }
 
             template <typename T>
             void generate_mask_no_state(
-                T* out, size_t count, bool training, uint32_t seed, double prob)
+                T* out, size_t count, bool training, uint64_t seed, double prob)
             {
-                std::mt19937 gen(seed);
-                std::bernoulli_distribution bd(prob);
-
-                for (size_t i = 0; i < count; i++)
+                if (!training)
                 {
-                    out[i] = training ? static_cast<T>(bd(gen)) : static_cast<T>(1);
+                    std::fill(out, out + count, static_cast<T>(1));
+                    return;
                 }
+                generate_mask_range(out, count, ngraph::Philox4x32(seed), 0, prob);
             }
         }
     }
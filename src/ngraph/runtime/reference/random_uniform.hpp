@@ -16,8 +16,10 @@
 
 #pragma once
 
-#include <random>
+#include <algorithm>
+#include <cstdint>
 
+#include "ngraph/state/philox.hpp"
 #include "ngraph/state/uniform_rng_state.hpp"
 
 namespace ngraph
@@ -26,25 +28,45 @@ namespace ngraph
     {
         namespace reference
         {
+            /// \brief Draws values [offset, offset + count) of a uniform stream. Each value
+            /// consumes two values of the generator.
             template <typename T>
-            void random_uniform(
-                T* out, T min_val, T max_val, size_t count, ngraph::UniformRNGState* rng_state)
+            void random_uniform_range(T* out,
+                                      T min_val,
+                                      T max_val,
+                                      size_t count,
+                                      const ngraph::Philox4x32& generator,
+                                      uint64_t offset)
             {
-                auto& gen = rng_state->get_generator();
-                auto& bd = rng_state->get_distribution();
-
-                for (size_t i = 0; i < count; i++)
+                const size_t block_size = 512;
+                uint32_t bits[2 * block_size];
+                for (size_t start = 0; start < count; start += block_size)
                 {
-                    out[i] = static_cast<T>(bd(gen)) * (max_val - min_val) + min_val;
+                    size_t n = std::min(block_size, count - start);
+                    generator.generate(bits, 2 * n, 2 * (offset + start));
+                    for (size_t i = 0; i < n; i++)
+                    {
+                        double value = ngraph::random_unit_double(bits[2 * i], bits[2 * i + 1]);
+                        out[start + i] = static_cast<T>(value) * (max_val - min_val) + min_val;
+                    }
                 }
             }
 
+            template <typename T>
+            void random_uniform(
+                T* out, T min_val, T max_val, size_t count, ngraph::UniformRNGState* rng_state)
+            {
+                uint64_t offset = rng_state->advance(count);
+                random_uniform_range(
+                    out, min_val, max_val, count, rng_state->get_generator(), offset);
+            }
+
             template <typename T>
             void random_uniform_with_fixed_seed(
                 T* out, T min_val, T max_val, size_t count, size_t fixed_seed)
             {
-                ngraph::UniformRNGState rng_state(fixed_seed);
-                random_uniform(out, min_val, max_val, count, &rng_state);
+                random_uniform_range(
+                    out, min_val, max_val, count, ngraph::Philox4x32(fixed_seed), 0);
             }
         }
     }
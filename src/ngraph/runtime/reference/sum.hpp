@@ -19,6 +19,7 @@
 #include <cmath>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/dense_walk.hpp"
 #include "ngraph/shape_util.hpp"
 #include "ngraph/type/bfloat16.hpp"
 #include "ngraph/type/float16.hpp"
@@ -52,6 +53,22 @@ namespace ngraph
                 return true;
             }
 
+            /// \brief Adds x to the running sum z with Kahan compensation c
+            template <typename T>
+            void kahan_add(T& z, T& c, T x)
+            {
+                if (is_finite(x) && is_finite(z))
+                {
+                    T t = z + (x - c);
+                    c = (t - z) - (x - c);
+                    z = t;
+                }
+                else
+                {
+                    z = z + x;
+                }
+            }
+
             template <typename T>
             void sum(const T* arg,
                      T* out,
@@ -59,36 +76,13 @@ namespace ngraph
                      const Shape& out_shape,
                      const AxisSet& reduction_axes)
             {
-                CoordinateTransform output_transform(out_shape);
-                std::vector<T> cs(shape_size(out_shape));
+                size_t out_size = shape_size(out_shape);
+                std::vector<T> cs(out_size, 0);
+                std::fill(out, out + out_size, T(0));
 
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = 0;
-                    cs[output_transform.index(output_coord)] = 0;
-                }
-
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes);
-
-                    T x = arg[input_transform.index(input_coord)];
-                    T& z = out[output_transform.index(output_coord)];
-
-                    if (is_finite(x) && is_finite(z))
-                    {
-                        T& c = cs[output_transform.index(output_coord)];
-                        T t = z + (x - c);
-                        c = (t - z) - (x - c);
-                        z = t;
-                    }
-                    else
-                    {
-                        z = z + x;
-                    }
-                }
+                reduce_dense(arg, out, in_shape, reduction_axes, [&](T& z, T x) {
+                    kahan_add(z, cs[&z - out], x);
+                });
             }
         }
     }
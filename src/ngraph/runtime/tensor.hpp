@@ -97,6 +97,12 @@ namespace ngraph
             /// \param n Number of bytes to read, must be integral number of elements.
             virtual void read(void* p, size_t n) const = 0;
 
+            /// \brief Get a pointer to the tensor data in host memory
+            /// \returns A pointer to the elements in row-major order, or nullptr if the data
+            ///     is not directly accessible from the host. The pointer is only valid while
+            ///     the tensor is alive and no execution using the tensor is in progress.
+            virtual void* get_host_data_ptr() { return nullptr; }
+
             /// \brief check tensor for new data, call may block.
             ///    backends may use this to ensure tensor is updated (eg: lazy eval).
             virtual void wait_for_read_ready() {}
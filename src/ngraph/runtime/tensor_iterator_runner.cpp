@@ -0,0 +1,354 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+
+#include "ngraph/check.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/tensor_iterator_runner.hpp"
+#include "ngraph/shape.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+size_t runtime::TensorIteratorRunner::Slice::get_offset(int64_t iteration) const
+{
+    return (first + iteration * stride) * item_size;
+}
+
+void runtime::TensorIteratorRunner::Slice::gather(char* dst,
+                                                  const char* src,
+                                                  int64_t num_iterations) const
+{
+    // Row by row, so the strided data is read in order
+    size_t slice_size = outer * chunk_size;
+    for (size_t i = 0; i < outer; i++)
+    {
+        for (int64_t iteration = 0; iteration < num_iterations; iteration++)
+        {
+            memcpy(dst + iteration * slice_size + i * chunk_size,
+                   src + i * row_size + get_offset(iteration),
+                   chunk_size);
+        }
+    }
+}
+
+void runtime::TensorIteratorRunner::Slice::scatter(char* dst,
+                                                   const char* src,
+                                                   int64_t num_iterations) const
+{
+    size_t slice_size = outer * chunk_size;
+    for (size_t i = 0; i < outer; i++)
+    {
+        for (int64_t iteration = 0; iteration < num_iterations; iteration++)
+        {
+            memcpy(dst + i * row_size + get_offset(iteration),
+                   src + iteration * slice_size + i * chunk_size,
+                   chunk_size);
+        }
+    }
+}
+
+runtime::TensorIteratorRunner::TensorIteratorRunner(const op::TensorIterator& ti,
+                                                    const shared_ptr<runtime::Executable>& body,
+                                                    const TensorFactory& make_tensor,
+                                                    const TensorDataSetter& set_tensor_data)
+    : m_body(body)
+    , m_make_tensor(make_tensor)
+    , m_set_tensor_data(set_tensor_data)
+    , m_num_iterations(ti.get_num_iterations())
+{
+    NGRAPH_CHECK(m_num_iterations >= 0,
+                 "TensorIterator ",
+                 ti.get_name(),
+                 " does not have a known number of iterations");
+
+    auto body_function = ti.get_body();
+    for (auto& parameter : body_function->get_parameters())
+    {
+        m_parameter_types.push_back(parameter->get_element_type());
+        m_parameter_shapes.push_back(parameter->get_shape());
+    }
+    for (auto& result : body_function->get_results())
+    {
+        m_result_types.push_back(result->get_element_type());
+        m_result_shapes.push_back(result->get_shape());
+    }
+    m_result_views.assign(m_result_shapes.size(), -1);
+    m_result_is_back_edge.assign(m_result_shapes.size(), false);
+
+    // start and end are inclusive and may count from the end of the axis. With a negative
+    // stride the slices move backwards, the slice of iteration 0 ending at start.
+    auto make_slice = [&](const element::Type& type,
+                          const Shape& shape,
+                          int64_t axis,
+                          int64_t start,
+                          int64_t stride,
+                          int64_t part_size) {
+        if (axis < 0)
+        {
+            axis += shape.size();
+        }
+        NGRAPH_CHECK(axis >= 0 && static_cast<size_t>(axis) < shape.size(),
+                     "TensorIterator ",
+                     ti.get_name(),
+                     " slices along an axis out of range");
+        int64_t dim = shape[axis];
+        if (start < 0)
+        {
+            start += dim;
+        }
+        Slice slice;
+        slice.outer = shape_size(Shape(shape.begin(), shape.begin() + axis));
+        slice.item_size = shape_size(Shape(shape.begin() + axis + 1, shape.end())) * type.size();
+        slice.row_size = dim * slice.item_size;
+        slice.chunk_size = part_size * slice.item_size;
+        slice.first = (stride >= 0 ? start : start - part_size + 1);
+        slice.stride = stride;
+        if (m_num_iterations > 0)
+        {
+            int64_t last = slice.first + (m_num_iterations - 1) * stride;
+            NGRAPH_CHECK(min(slice.first, last) >= 0 && max(slice.first, last) + part_size <= dim,
+                         "TensorIterator ",
+                         ti.get_name(),
+                         " slices past the end of an axis");
+        }
+        return slice;
+    };
+
+    for (auto& description : ti.get_input_descriptions())
+    {
+        size_t input_index = description->m_input_index;
+        size_t parameter_index = description->m_body_parameter_index;
+        if (auto slice = as_type_ptr<op::TensorIterator::SliceInputDescription>(description))
+        {
+            m_sliced_inputs.push_back({input_index,
+                                       parameter_index,
+                                       make_slice(ti.get_input_element_type(input_index),
+                                                  ti.get_input_shape(input_index),
+                                                  slice->m_axis,
+                                                  slice->m_start,
+                                                  slice->m_stride,
+                                                  slice->m_part_size)});
+        }
+        else if (auto merged = as_type_ptr<op::TensorIterator::MergedInputDescription>(description))
+        {
+            m_initial_inputs.push_back({parameter_index, input_index});
+            m_back_edges.push_back({parameter_index, merged->m_body_value_index});
+            m_result_is_back_edge.at(merged->m_body_value_index) = true;
+        }
+        else
+        {
+            m_invariant_inputs.push_back({parameter_index, input_index});
+        }
+    }
+
+    for (auto& description : ti.get_output_descriptions())
+    {
+        size_t output_index = description->m_output_index;
+        size_t result_index = description->m_body_value_index;
+        if (auto concat = as_type_ptr<op::TensorIterator::ConcatOutputDescription>(description))
+        {
+            Slice slice = make_slice(ti.get_output_element_type(output_index),
+                                     ti.get_output_shape(output_index),
+                                     concat->m_axis,
+                                     concat->m_start,
+                                     concat->m_stride,
+                                     concat->m_part_size);
+            if (m_result_views.at(result_index) < 0)
+            {
+                // The body writes this result into the output, or its gathered form
+                m_result_views[result_index] = m_concat_outputs.size();
+            }
+            m_concat_outputs.push_back({output_index, result_index, slice});
+        }
+        else if (auto body_output =
+                     as_type_ptr<op::TensorIterator::BodyOutputDescription>(description))
+        {
+            int64_t iteration = body_output->m_iteration;
+            if (iteration < 0)
+            {
+                iteration += m_num_iterations;
+            }
+            NGRAPH_CHECK(iteration >= 0 && iteration < m_num_iterations,
+                         "TensorIterator ",
+                         ti.get_name(),
+                         " takes output ",
+                         output_index,
+                         " from iteration ",
+                         body_output->m_iteration,
+                         " but runs ",
+                         m_num_iterations,
+                         " iterations");
+            m_iteration_outputs.push_back({output_index, result_index, iteration});
+        }
+    }
+}
+
+void runtime::TensorIteratorRunner::run(const vector<void*>& inputs,
+                                        const vector<void*>& outputs) const
+{
+    if (m_num_iterations == 0)
+    {
+        // Concatenated outputs are empty and no output is taken from an iteration
+        return;
+    }
+
+    // Scratch buffers, allocated once for all iterations
+    vector<unique_ptr<runtime::AlignedBuffer>> buffers;
+    auto make_scratch = [&](size_t size) {
+        buffers.emplace_back(new runtime::AlignedBuffer(size));
+        return buffers.back()->get_ptr<char>();
+    };
+    auto parameter_size = [&](size_t i) {
+        return shape_size(m_parameter_shapes[i]) * m_parameter_types[i].size();
+    };
+    auto result_size = [&](size_t i) {
+        return shape_size(m_result_shapes[i]) * m_result_types[i].size();
+    };
+
+    vector<shared_ptr<runtime::Tensor>> body_inputs(m_parameter_shapes.size());
+    vector<shared_ptr<runtime::Tensor>> body_outputs(m_result_shapes.size());
+    for (auto& invariant : m_invariant_inputs)
+    {
+        body_inputs[invariant.first] = m_make_tensor(m_parameter_types[invariant.first],
+                                                     m_parameter_shapes[invariant.first],
+                                                     inputs[invariant.second]);
+    }
+    for (auto& initial : m_initial_inputs)
+    {
+        body_inputs[initial.first] = m_make_tensor(m_parameter_types[initial.first],
+                                                   m_parameter_shapes[initial.first],
+                                                   inputs[initial.second]);
+    }
+
+    // Data of a sliced input for iteration i is at base + i * step
+    vector<char*> input_base(m_sliced_inputs.size());
+    vector<int64_t> input_step(m_sliced_inputs.size());
+    for (size_t i = 0; i < m_sliced_inputs.size(); i++)
+    {
+        const SlicedInput& input = m_sliced_inputs[i];
+        char* data = static_cast<char*>(inputs[input.input_index]);
+        if (input.slice.is_contiguous())
+        {
+            input_base[i] = data + input.slice.get_offset(0);
+            input_step[i] = input.slice.stride * input.slice.item_size;
+        }
+        else
+        {
+            input_step[i] = static_cast<int64_t>(parameter_size(input.parameter_index));
+            input_base[i] = make_scratch(m_num_iterations * input_step[i]);
+            input.slice.gather(input_base[i], data, m_num_iterations);
+        }
+        body_inputs[input.parameter_index] =
+            m_make_tensor(m_parameter_types[input.parameter_index],
+                          m_parameter_shapes[input.parameter_index],
+                          input_base[i]);
+    }
+
+    // A result written to a concat output moves with the iterations like a sliced input. Other
+    // results use one buffer, or two alternating ones when the next iteration reads them
+    // through a back-edge.
+    vector<char*> result_base(m_result_shapes.size());
+    vector<int64_t> result_step(m_result_shapes.size());
+    vector<size_t> result_buffers(m_result_shapes.size(), 0);
+    for (size_t i = 0; i < m_result_shapes.size(); i++)
+    {
+        if (m_result_views[i] >= 0)
+        {
+            const ConcatOutput& output = m_concat_outputs[m_result_views[i]];
+            if (output.slice.is_contiguous())
+            {
+                result_base[i] =
+                    static_cast<char*>(outputs[output.output_index]) + output.slice.get_offset(0);
+                result_step[i] = output.slice.stride * output.slice.item_size;
+            }
+            else
+            {
+                result_step[i] = static_cast<int64_t>(result_size(i));
+                result_base[i] = make_scratch(m_num_iterations * result_step[i]);
+            }
+        }
+        else
+        {
+            result_buffers[i] = (m_result_is_back_edge[i] ? 2 : 1);
+            result_step[i] = static_cast<int64_t>(result_size(i));
+            result_base[i] = make_scratch(result_buffers[i] * result_step[i]);
+        }
+        body_outputs[i] = m_make_tensor(m_result_types[i], m_result_shapes[i], result_base[i]);
+    }
+
+    vector<char*> result_data(m_result_shapes.size());
+    for (int64_t iteration = 0; iteration < m_num_iterations; iteration++)
+    {
+        for (size_t i = 0; i < m_sliced_inputs.size(); i++)
+        {
+            m_set_tensor_data(*body_inputs[m_sliced_inputs[i].parameter_index],
+                              input_base[i] + iteration * input_step[i]);
+        }
+        for (size_t i = 0; i < m_result_shapes.size(); i++)
+        {
+            int64_t position = (result_buffers[i] > 0 ? iteration % result_buffers[i] : iteration);
+            result_data[i] = result_base[i] + position * result_step[i];
+            m_set_tensor_data(*body_outputs[i], result_data[i]);
+        }
+
+        m_body->call(body_outputs, body_inputs);
+
+        for (size_t i = 0; i < m_concat_outputs.size(); i++)
+        {
+            const ConcatOutput& output = m_concat_outputs[i];
+            if (m_result_views[output.result_index] != static_cast<int64_t>(i))
+            {
+                // A second concat output of the same result
+                char* dst = static_cast<char*>(outputs[output.output_index]);
+                for (size_t j = 0; j < output.slice.outer; j++)
+                {
+                    memcpy(dst + j * output.slice.row_size + output.slice.get_offset(iteration),
+                           result_data[output.result_index] + j * output.slice.chunk_size,
+                           output.slice.chunk_size);
+                }
+            }
+        }
+        for (auto& output : m_iteration_outputs)
+        {
+            if (output.iteration == iteration)
+            {
+                memcpy(outputs[output.output_index],
+                       result_data[output.result_index],
+                       result_size(output.result_index));
+            }
+        }
+        for (auto& back_edge : m_back_edges)
+        {
+            m_set_tensor_data(*body_inputs[back_edge.first], result_data[back_edge.second]);
+        }
+    }
+
+    for (size_t i = 0; i < m_result_shapes.size(); i++)
+    {
+        if (m_result_views[i] >= 0)
+        {
+            const ConcatOutput& output = m_concat_outputs[m_result_views[i]];
+            if (!output.slice.is_contiguous())
+            {
+                output.slice.scatter(static_cast<char*>(outputs[output.output_index]),
+                                     result_base[i],
+                                     m_num_iterations);
+            }
+        }
+    }
+}
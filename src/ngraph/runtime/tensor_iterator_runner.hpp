@@ -0,0 +1,133 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "ngraph/op/tensor_iterator.hpp"
+#include "ngraph/runtime/executable.hpp"
+#include "ngraph/runtime/tensor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class TensorIteratorRunner;
+    }
+}
+
+/// \brief Executes a TensorIterator by calling its compiled body once per iteration
+///
+/// The body is compiled once by the backend and the loop is run without unrolling. The tensors
+/// passed to the body are made once per call, every iteration only points them at its data.
+/// Invariant and initial inputs are passed to the body as they are, back-edges pass the memory
+/// a body result was written to as the parameter of the next iteration, and slices of inputs and
+/// concatenated outputs are views into the TensorIterator's buffers whenever the slice is
+/// contiguous, i.e. all dimensions before the slice axis are 1. Other slices are gathered for
+/// all iterations before the loop and scattered after it, so an iteration copies nothing; their
+/// scratch memory holds the slices of every iteration.
+///
+/// Outputs taken from the body at one iteration need at least one iteration.
+class NGRAPH_API ngraph::runtime::TensorIteratorRunner
+{
+public:
+    /// \brief Wraps backend memory in a Tensor of the body's backend
+    using TensorFactory = std::function<std::shared_ptr<runtime::Tensor>(
+        const element::Type&, const Shape&, void*)>;
+    /// \brief Points a tensor made by the TensorFactory at other memory of the same size
+    using TensorDataSetter = std::function<void(runtime::Tensor&, void*)>;
+
+    /// \param ti The TensorIterator, with static shapes
+    /// \param body The body of ti, compiled by the backend executing ti. Parameters and
+    ///        results are in the order of the body's parameters and results.
+    /// \param make_tensor Creates the tensors passed to body
+    /// \param set_tensor_data Moves a tensor made by make_tensor to the data of an iteration
+    TensorIteratorRunner(const op::TensorIterator& ti,
+                         const std::shared_ptr<runtime::Executable>& body,
+                         const TensorFactory& make_tensor,
+                         const TensorDataSetter& set_tensor_data);
+
+    /// \brief Run all iterations
+    /// \param inputs Data of the TensorIterator's inputs, in input order
+    /// \param outputs Data of the TensorIterator's outputs, in output order
+    void run(const std::vector<void*>& inputs, const std::vector<void*>& outputs) const;
+
+private:
+    // A slice of a TensorIterator input or output along one axis, moving every iteration
+    struct Slice
+    {
+        size_t outer;      // product of the dimensions before the axis
+        size_t row_size;   // bytes of the whole axis for one outer index
+        size_t chunk_size; // bytes of the slice for one outer index
+        size_t item_size;  // bytes of one index on the axis
+        int64_t first;     // first index on the axis of iteration 0
+        int64_t stride;
+        bool is_contiguous() const { return outer == 1; }
+        size_t get_offset(int64_t iteration) const;
+        // The slices of iterations are dense and follow each other in the gathered data
+        void gather(char* dst, const char* src, int64_t num_iterations) const;
+        void scatter(char* dst, const char* src, int64_t num_iterations) const;
+    };
+
+    struct SlicedInput
+    {
+        size_t input_index;
+        size_t parameter_index;
+        Slice slice;
+    };
+
+    struct ConcatOutput
+    {
+        size_t output_index;
+        size_t result_index;
+        Slice slice;
+    };
+
+    struct IterationOutput
+    {
+        size_t output_index;
+        size_t result_index;
+        int64_t iteration;
+    };
+
+    std::shared_ptr<runtime::Executable> m_body;
+    TensorFactory m_make_tensor;
+    TensorDataSetter m_set_tensor_data;
+    int64_t m_num_iterations;
+
+    std::vector<element::Type> m_parameter_types;
+    std::vector<Shape> m_parameter_shapes;
+    std::vector<element::Type> m_result_types;
+    std::vector<Shape> m_result_shapes;
+
+    // parameter_index, input_index of inputs passed to every iteration
+    std::vector<std::pair<size_t, size_t>> m_invariant_inputs;
+    // parameter_index, input_index of the initial values of back-edges
+    std::vector<std::pair<size_t, size_t>> m_initial_inputs;
+    // parameter_index, result_index of back-edges
+    std::vector<std::pair<size_t, size_t>> m_back_edges;
+    std::vector<SlicedInput> m_sliced_inputs;
+    std::vector<ConcatOutput> m_concat_outputs;
+    std::vector<IterationOutput> m_iteration_outputs;
+    // Index into m_concat_outputs of the concat output a result is written to, or -1. The body
+    // writes a contiguous output in place and a strided one in its gathered form.
+    std::vector<int64_t> m_result_views;
+    // Whether a result feeds a back-edge and needs two alternating scratch buffers
+    std::vector<bool> m_result_is_back_edge;
+};
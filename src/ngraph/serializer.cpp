@@ -14,10 +14,12 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <fstream>
 #include <functional>
 #include <queue>
 #include <stack>
+#include <unordered_map>
 
 #include "ngraph/cpio.hpp"
 #include "ngraph/env_util.hpp"
@@ -26,6 +28,7 @@
 #include "ngraph/log.hpp"
 #include "ngraph/ops.hpp"
 #include "ngraph/provenance.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
 #include "nlohmann/json.hpp"
@@ -37,6 +40,16 @@ using const_data_callback_t = shared_ptr<Node>(const string&, const element::Typ
 
 static bool s_serialize_output_shapes_enabled = getenv_bool("NGRAPH_SERIALIZER_OUTPUT_SHAPES");
 
+// Constant data in cpio archives starts on this boundary so that a memory mapped archive can back
+// the constants directly
+static const size_t s_cpio_constant_alignment = 64;
+
+// Binary graph files start with a magic and the format version. The graph follows in MessagePack,
+// then a table of the constants and finally the raw constant data, aligned like in cpio archives.
+static const char s_binary_magic[8] = {'n', 'G', 'r', 'a', 'p', 'h', 'B', 'F'};
+static const uint32_t s_binary_version = 1;
+static const size_t s_binary_header_size = sizeof(s_binary_magic) + 4 + 4 + 8 + 8;
+
 void ngraph::set_serialize_output_shapes(bool enable)
 {
     s_serialize_output_shapes_enabled = enable;
@@ -112,6 +125,12 @@ public:
         m_binary_constant_data = binary_constant_data;
     }
 
+    /// \brief Constants whose data was left out of the json by set_binary_constant_data
+    const vector<const op::Constant*>& get_binary_constants() const
+    {
+        return m_binary_constants;
+    }
+
     json serialize_function(const Function& function);
     json serialize_output(const Output<Node>& output);
     json serialize_parameter_vector(const ParameterVector& parameters);
@@ -127,6 +146,7 @@ protected:
     size_t m_indent{0};
     bool m_serialize_output_shapes{false};
     bool m_binary_constant_data{false};
+    vector<const op::Constant*> m_binary_constants;
     json m_json_nodes;
 };
 
@@ -139,6 +159,8 @@ public:
     }
 
     shared_ptr<Function> deserialize_function(json j);
+    /// \brief Builds a function from its results and parameters once its ops are deserialized
+    shared_ptr<Function> make_function(json j);
     Output<Node> deserialize_output(json j);
     OutputVector deserialize_output_vector(json j);
     ParameterVector deserialize_parameter_vector(json j);
@@ -156,8 +178,146 @@ protected:
     function<const_data_callback_t> m_const_data_callback;
 };
 
-static string
-    serialize(shared_ptr<ngraph::Function> func, size_t indent, bool binary_constant_data);
+// Decodes the MessagePack graph of a binary graph file without building its whole DOM. Each op is
+// handed to the deserializer as soon as it is decoded and then dropped, so only the op being
+// decoded and the small per-function records (name, parameters, results) are ever held as json.
+class BinaryGraphReader
+{
+public:
+    BinaryGraphReader(JSONDeserializer& deserializer)
+        : m_deserializer(deserializer)
+    {
+    }
+
+    /// \brief The last function of the graph, the one the others are nested in
+    shared_ptr<Function> get_function() const { return m_function; }
+    bool null() { return add_scalar(nullptr); }
+    bool boolean(bool value) { return add_scalar(value); }
+    bool number_integer(json::number_integer_t value) { return add_scalar(value); }
+    bool number_unsigned(json::number_unsigned_t value) { return add_scalar(value); }
+    bool number_float(json::number_float_t value, const json::string_t&)
+    {
+        return add_scalar(value);
+    }
+    bool string(json::string_t& value) { return add_scalar(move(value)); }
+    // Graphs are never serialized with binary values
+    template <typename T>
+    bool binary(T&)
+    {
+        throw ngraph_error("Binary graph is malformed: unexpected binary value");
+    }
+    bool start_object(size_t)
+    {
+        m_stack.push_back(add_value(json::object()));
+        return true;
+    }
+    bool key(json::string_t& key)
+    {
+        m_key = move(key);
+        return true;
+    }
+    bool end_object()
+    {
+        m_stack.pop_back();
+        end_value();
+        return true;
+    }
+    bool start_array(size_t)
+    {
+        m_stack.push_back(add_value(json::array()));
+        // Stack holds the list of functions and the function the array belongs to
+        if (m_stack.size() == 3 && m_key == "ops")
+        {
+            m_ops = m_stack.back();
+        }
+        return true;
+    }
+    bool end_array()
+    {
+        if (m_stack.back() == m_ops)
+        {
+            m_ops = nullptr;
+        }
+        m_stack.pop_back();
+        end_value();
+        return true;
+    }
+    bool parse_error(size_t, const std::string&, const json::exception& ex)
+    {
+        throw ngraph_error("Binary graph is malformed: " + std::string(ex.what()));
+    }
+
+private:
+    json* add_value(json&& value)
+    {
+        json* rc;
+        if (m_stack.empty())
+        {
+            if (!value.is_array())
+            {
+                throw ngraph_error("Binary graph is malformed: the graph is not a list");
+            }
+            m_root = move(value);
+            rc = &m_root;
+        }
+        else if (m_stack.back() == m_ops)
+        {
+            // Ops are not added to their function
+            m_op = move(value);
+            rc = &m_op;
+        }
+        else if (m_stack.back()->is_array())
+        {
+            m_stack.back()->push_back(move(value));
+            rc = &m_stack.back()->back();
+        }
+        else
+        {
+            rc = &(*m_stack.back())[m_key];
+            *rc = move(value);
+        }
+        return rc;
+    }
+
+    bool add_scalar(json&& value)
+    {
+        add_value(move(value));
+        end_value();
+        return true;
+    }
+
+    // Called once the value at the top of m_stack is complete
+    void end_value()
+    {
+        if (m_stack.empty())
+        {
+            return;
+        }
+        if (m_stack.back() == m_ops)
+        {
+            m_deserializer.deserialize_node(move(m_op));
+            m_op = json();
+        }
+        else if (m_stack.size() == 1)
+        {
+            m_function = m_deserializer.make_function(move(m_stack.back()->back()));
+            m_stack.back()->erase(m_stack.back()->size() - 1);
+        }
+    }
+
+    JSONDeserializer& m_deserializer;
+    shared_ptr<Function> m_function;
+    json m_root;
+    json m_op;
+    vector<json*> m_stack;
+    json* m_ops{nullptr};
+    std::string m_key;
+};
+
+static string serialize(shared_ptr<ngraph::Function> func,
+                        size_t indent,
+                        bool binary_constant_data,
+                        vector<const op::Constant*>* binary_constants = nullptr);
 
 static json write_dimension(Dimension d)
 {
@@ -313,28 +473,269 @@ void ngraph::serialize(ostream& out, shared_ptr<ngraph::Function> func, size_t i
     out << ::serialize(func, indent, false);
 }
 
-#if defined ENABLE_CPIO_FILE
-static void serialize_to_cpio(ostream& out, shared_ptr<ngraph::Function> func, size_t indent)
+void ngraph::serialize_to_cpio(const string& path, shared_ptr<ngraph::Function> func, size_t indent)
 {
-    string j = ::serialize(func, indent, true);
+    ofstream out(path, ios_base::binary | ios_base::out);
+    serialize_to_cpio(out, func, indent);
+}
+
+void ngraph::serialize_to_cpio(ostream& out, shared_ptr<ngraph::Function> func, size_t indent)
+{
+    vector<const op::Constant*> constants;
+    string j = ::serialize(func, indent, true, &constants);
     cpio::Writer writer(out);
     writer.write(func->get_name(), j.c_str(), static_cast<uint32_t>(j.size()));
 
-    traverse_nodes(const_cast<Function*>(func.get()),
-                   [&](shared_ptr<Node> node) {
-                       if (auto c = node->as_type<op::Constant>())
-                       {
-                           uint32_t size =
-                               static_cast<uint32_t>(shape_size(c->get_output_shape(0)) *
-                                                     c->get_output_element_type(0).size());
-                           writer.write(c->get_name(), c->get_data_ptr(), size);
-                       }
-                   },
-                   true);
+    // Includes the constants of nested functions, such as TensorIterator bodies
+    for (auto c : constants)
+    {
+        uint32_t size = static_cast<uint32_t>(shape_size(c->get_output_shape(0)) *
+                                              c->get_output_element_type(0).size());
+        writer.write(c->get_name(), c->get_data_ptr(), size, s_cpio_constant_alignment);
+    }
+}
+
+static void write_binary_u64(ostream& out, uint64_t value)
+{
+    char bytes[8];
+    for (size_t i = 0; i < 8; i++)
+    {
+        bytes[i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+    }
+    out.write(bytes, 8);
+}
+
+static void write_binary_u32(ostream& out, uint32_t value)
+{
+    char bytes[4];
+    for (size_t i = 0; i < 4; i++)
+    {
+        bytes[i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+    }
+    out.write(bytes, 4);
+}
+
+static uint64_t read_binary_u64(istream& in)
+{
+    unsigned char bytes[8];
+    if (!in.read(reinterpret_cast<char*>(bytes), 8))
+    {
+        throw ngraph_error("Binary graph is truncated");
+    }
+    uint64_t value = 0;
+    for (size_t i = 0; i < 8; i++)
+    {
+        value |= static_cast<uint64_t>(bytes[i]) << (8 * i);
+    }
+    return value;
+}
+
+static uint32_t read_binary_u32(istream& in)
+{
+    unsigned char bytes[4];
+    if (!in.read(reinterpret_cast<char*>(bytes), 4))
+    {
+        throw ngraph_error("Binary graph is truncated");
+    }
+    uint32_t value = 0;
+    for (size_t i = 0; i < 4; i++)
+    {
+        value |= static_cast<uint32_t>(bytes[i]) << (8 * i);
+    }
+    return value;
+}
+
+static bool is_binary_graph(istream& in)
+{
+    auto offset = in.tellg();
+    char magic[sizeof(s_binary_magic)];
+    bool rc = in.read(magic, sizeof(magic)) && equal(magic, magic + sizeof(magic), s_binary_magic);
+    in.clear();
+    in.seekg(offset, ios_base::beg);
+    return rc;
 }
-#endif
 
-static string serialize(shared_ptr<Function> func, size_t indent, bool binary_constant_data)
+void ngraph::serialize_binary(const string& path, shared_ptr<ngraph::Function> func)
+{
+    ofstream out(path, ios_base::binary | ios_base::out);
+    serialize_binary(out, func);
+}
+
+void ngraph::serialize_binary(ostream& out, shared_ptr<ngraph::Function> func)
+{
+    JSONSerializer serializer;
+    serializer.set_binary_constant_data(true);
+    serializer.set_serialize_output_shapes(s_serialize_output_shapes_enabled);
+    json j;
+    j.push_back(serializer.serialize_function(*func));
+    vector<uint8_t> graph = json::to_msgpack(j);
+    const vector<const op::Constant*>& constants = serializer.get_binary_constants();
+
+    // Lay out the constant data after the table, every constant on an aligned offset
+    uint64_t table_size = 0;
+    for (auto c : constants)
+    {
+        table_size += 8 + c->get_name().size() + 8 + 8;
+    }
+    uint64_t offset = s_binary_header_size + graph.size() + table_size;
+    vector<uint64_t> offsets;
+    for (auto c : constants)
+    {
+        offset = ngraph::ceil_div(offset, s_cpio_constant_alignment) * s_cpio_constant_alignment;
+        offsets.push_back(offset);
+        offset += shape_size(c->get_shape()) * c->get_element_type().size();
+    }
+
+    out.write(s_binary_magic, sizeof(s_binary_magic));
+    write_binary_u32(out, s_binary_version);
+    write_binary_u32(out, 0); // flags, none defined
+    write_binary_u64(out, graph.size());
+    write_binary_u64(out, constants.size());
+    out.write(reinterpret_cast<const char*>(graph.data()), graph.size());
+    for (size_t i = 0; i < constants.size(); i++)
+    {
+        const string& name = constants[i]->get_name();
+        write_binary_u64(out, name.size());
+        out.write(name.data(), name.size());
+        write_binary_u64(out, offsets[i]);
+        write_binary_u64(out, shape_size(constants[i]->get_shape()) *
+                                  constants[i]->get_element_type().size());
+    }
+    offset = s_binary_header_size + graph.size() + table_size;
+    vector<char> padding(s_cpio_constant_alignment, 0);
+    for (size_t i = 0; i < constants.size(); i++)
+    {
+        out.write(padding.data(), offsets[i] - offset);
+        size_t size =
+            shape_size(constants[i]->get_shape()) * constants[i]->get_element_type().size();
+        out.write(static_cast<const char*>(constants[i]->get_data_ptr()), size);
+        offset = offsets[i] + size;
+    }
+}
+
+// Reads a binary graph starting at the current position of in. If mapped_file holds the same
+// graph, constants share its memory instead of being read.
+static shared_ptr<Function>
+    deserialize_binary(istream& in, const shared_ptr<file_util::MappedFile>& mapped_file)
+{
+    uint64_t base = in.tellg();
+    char magic[sizeof(s_binary_magic)];
+    in.read(magic, sizeof(magic));
+    if (!in || !equal(magic, magic + sizeof(magic), s_binary_magic))
+    {
+        throw ngraph_error("Not a binary graph");
+    }
+    uint32_t version = read_binary_u32(in);
+    if (version > s_binary_version)
+    {
+        throw ngraph_error("Binary graph version " + to_string(version) +
+                           " is newer than the supported version " +
+                           to_string(s_binary_version));
+    }
+    read_binary_u32(in); // flags
+    uint64_t graph_size = read_binary_u64(in);
+    uint64_t constant_count = read_binary_u64(in);
+
+    // Sizes are checked against the input before anything is allocated for them
+    uint64_t graph_begin = in.tellg();
+    in.seekg(0, ios_base::end);
+    uint64_t end = in.tellg();
+    auto check_remaining = [&](uint64_t size) {
+        uint64_t position = in.tellg();
+        if (position > end || size > end - position)
+        {
+            throw ngraph_error("Binary graph is truncated");
+        }
+    };
+    in.seekg(graph_begin, ios_base::beg);
+    check_remaining(graph_size);
+
+    // The table follows the graph, but is needed while the graph is decoded
+    in.seekg(graph_begin + graph_size, ios_base::beg);
+    unordered_map<string, pair<uint64_t, uint64_t>> constant_table;
+    for (uint64_t i = 0; i < constant_count; i++)
+    {
+        uint64_t name_size = read_binary_u64(in);
+        check_remaining(name_size);
+        string name(name_size, '\0');
+        if (!in.read(&name[0], name.size()))
+        {
+            throw ngraph_error("Binary graph is truncated");
+        }
+        uint64_t offset = read_binary_u64(in);
+        uint64_t size = read_binary_u64(in);
+        if (offset > end - base || size > end - base - offset)
+        {
+            throw ngraph_error("Constant " + name + " extends past the end of the binary graph");
+        }
+        constant_table[name] = make_pair(offset, size);
+    }
+    in.seekg(graph_begin, ios_base::beg);
+
+    JSONDeserializer deserializer;
+    deserializer.set_const_data_callback(
+        [&](const string& const_name, const element::Type& et, const Shape& shape) {
+            shared_ptr<Node> const_node;
+            auto it = constant_table.find(const_name);
+            if (it == constant_table.end())
+            {
+                return const_node;
+            }
+            uint64_t offset = it->second.first;
+            uint64_t size = it->second.second;
+            NGRAPH_CHECK(size == shape_size(shape) * et.size(),
+                         "Size of constant ",
+                         const_name,
+                         " does not match its shape");
+            if (mapped_file)
+            {
+                NGRAPH_CHECK(base + offset + size <= mapped_file->size(),
+                             "Constant ",
+                             const_name,
+                             " extends past the end of the binary graph");
+                char* data = mapped_file->data() + base + offset;
+                if (mapped_file->is_mapped() &&
+                    reinterpret_cast<size_t>(data) % s_cpio_constant_alignment == 0)
+                {
+                    auto buffer =
+                        make_shared<runtime::SharedBuffer<shared_ptr<file_util::MappedFile>>>(
+                            data, size, mapped_file);
+                    const_node = make_shared<op::Constant>(et, shape, buffer);
+                }
+                else
+                {
+                    const_node = make_shared<op::Constant>(et, shape, data);
+                }
+            }
+            else
+            {
+                // Read straight into the buffer the constant keeps, then return to the graph
+                auto buffer = make_shared<runtime::AlignedBuffer>(size, s_cpio_constant_alignment);
+                auto position = in.tellg();
+                in.seekg(base + offset, ios_base::beg);
+                if (!in.read(buffer->get_ptr<char>(), size))
+                {
+                    throw ngraph_error("Binary graph is truncated");
+                }
+                in.seekg(position, ios_base::beg);
+                const_node = make_shared<op::Constant>(et, shape, buffer);
+            }
+            return const_node;
+        });
+
+    BinaryGraphReader graph_reader(deserializer);
+    json::sax_parse(in, &graph_reader, json::input_format_t::msgpack, false);
+    if (static_cast<uint64_t>(in.tellg()) != graph_begin + graph_size)
+    {
+        throw ngraph_error("Binary graph is malformed: the graph does not match its size");
+    }
+    return graph_reader.get_function();
+}
+
+static string serialize(shared_ptr<Function> func,
+                        size_t indent,
+                        bool binary_constant_data,
+                        vector<const op::Constant*>* binary_constants)
 {
     JSONSerializer serializer;
     serializer.set_binary_constant_data(binary_constant_data);
@@ -343,6 +744,10 @@ static string serialize(shared_ptr<Function> func, size_t indent, bool binary_co
 
     json j;
     j.push_back(serializer.serialize_function(*func));
+    if (binary_constants)
+    {
+        *binary_constants = serializer.get_binary_constants();
+    }
 
     string rc;
     if (indent == 0)
@@ -361,44 +766,96 @@ std::string ngraph::serialize(std::shared_ptr<ngraph::Function> func, size_t ind
     return ::serialize(func, indent, false);
 }
 
+using make_constant_t = shared_ptr<Node>(const cpio::FileInfo&,
+                                          const element::Type&,
+                                          const Shape&);
+
+static shared_ptr<Function> deserialize_cpio(cpio::Reader& reader,
+                                             function<make_constant_t> make_constant)
+{
+    shared_ptr<Function> rc;
+    vector<cpio::FileInfo> file_info = reader.get_file_info();
+    if (file_info.size() > 0)
+    {
+        // The first file is the model
+        uint32_t size = static_cast<uint32_t>(file_info[0].get_size());
+        char* data = new char[size];
+        reader.read(file_info[0].get_name(), data, size);
+        string jstr(data, size);
+        delete[] data;
+        json js = json::parse(jstr);
+        unordered_map<string, const cpio::FileInfo*> constant_info;
+        for (const cpio::FileInfo& info : file_info)
+        {
+            constant_info.insert({info.get_name(), &info});
+        }
+        JSONDeserializer deserializer;
+        deserializer.set_const_data_callback(
+            [&](const string& const_name, const element::Type& et, const Shape& shape) {
+                shared_ptr<Node> const_node;
+                auto it = constant_info.find(const_name);
+                if (it != constant_info.end())
+                {
+                    const_node = make_constant(*it->second, et, shape);
+                }
+                return const_node;
+            });
+        for (json func : js)
+        {
+            rc = deserializer.deserialize_function(func);
+        }
+    }
+    return rc;
+}
+
+// Constants are views into the mapped archive wherever the archive has them suitably aligned, so
+// their data is only paged in when used and the pages are shared by every process loading the
+// same file.
+static shared_ptr<Function> deserialize_mapped_cpio(const string& path)
+{
+    auto mapped_file = make_shared<file_util::MappedFile>(path);
+    cpio::Reader reader(path);
+    return deserialize_cpio(
+        reader,
+        [&](const cpio::FileInfo& info, const element::Type& et, const Shape& shape) {
+            NGRAPH_CHECK(info.get_offset() + info.get_size() <= mapped_file->size(),
+                         "Constant ",
+                         info.get_name(),
+                         " extends past the end of ",
+                         path);
+            char* data = mapped_file->data() + info.get_offset();
+            shared_ptr<Node> const_node;
+            if (mapped_file->is_mapped() &&
+                reinterpret_cast<size_t>(data) % s_cpio_constant_alignment == 0)
+            {
+                auto buffer =
+                    make_shared<runtime::SharedBuffer<shared_ptr<file_util::MappedFile>>>(
+                        data, info.get_size(), mapped_file);
+                const_node = make_shared<op::Constant>(et, shape, buffer);
+            }
+            else
+            {
+                const_node = make_shared<op::Constant>(et, shape, data);
+            }
+            return const_node;
+        });
+}
+
 shared_ptr<ngraph::Function> ngraph::deserialize(istream& in)
 {
     shared_ptr<Function> rc;
     if (cpio::is_cpio(in))
     {
         cpio::Reader reader(in);
-        vector<cpio::FileInfo> file_info = reader.get_file_info();
-        if (file_info.size() > 0)
-        {
-            // The first file is the model
-            uint32_t size = static_cast<uint32_t>(file_info[0].get_size());
-            char* data = new char[size];
-            reader.read(file_info[0].get_name(), data, size);
-            string jstr(data, size);
-            delete[] data;
-            json js = json::parse(jstr);
-            JSONDeserializer deserializer;
-            deserializer.set_const_data_callback(
-                [&](const string& const_name, const element::Type& et, const Shape& shape) {
-                    shared_ptr<Node> const_node;
-                    for (const cpio::FileInfo& info : file_info)
-                    {
-                        if (info.get_name() == const_name)
-                        {
-                            void* const_data = ngraph_malloc(info.get_size());
-                            reader.read(const_name, const_data, info.get_size());
-                            const_node = make_shared<op::Constant>(et, shape, const_data);
-                            ngraph_free(const_data);
-                            break;
-                        }
-                    }
-                    return const_node;
-                });
-            for (json func : js)
-            {
-                rc = deserializer.deserialize_function(func);
-            }
-        }
+        rc = deserialize_cpio(
+            reader, [&](const cpio::FileInfo& info, const element::Type& et, const Shape& shape) {
+                vector<char> const_data = reader.read(info);
+                return make_shared<op::Constant>(et, shape, const_data.data());
+            });
+    }
+    else if (is_binary_graph(in))
+    {
+        rc = deserialize_binary(in, nullptr);
     }
     else
     {
@@ -416,8 +873,28 @@ shared_ptr<ngraph::Function> ngraph::deserialize(const string& s)
     if (file_util::exists(s))
     {
         // s is a file and not a json string
-        ifstream in(s, ios_base::binary | ios_base::in);
-        rc = deserialize(in);
+        if (cpio::is_cpio(s))
+        {
+            rc = deserialize_mapped_cpio(s);
+        }
+        else
+        {
+            ifstream in(s, ios_base::binary | ios_base::in);
+            if (is_binary_graph(in))
+            {
+                rc = deserialize_binary(in, make_shared<file_util::MappedFile>(s));
+            }
+            else
+            {
+                rc = deserialize(in);
+            }
+        }
+    }
+    else if (s.compare(0, sizeof(s_binary_magic), s_binary_magic, sizeof(s_binary_magic)) == 0)
+    {
+        // s holds a binary graph
+        istringstream in(s);
+        rc = deserialize_binary(in, nullptr);
     }
     else
     {
@@ -680,12 +1157,17 @@ ParameterVector JSONDeserializer::deserialize_parameter_vector(json json_paramet
 
 shared_ptr<Function> JSONDeserializer::deserialize_function(json func_js)
 {
-    string func_name = func_js.at("name").get<string>();
-    vector<json> func_result = func_js.at("result");
     for (json node_js : func_js.at("ops"))
     {
         deserialize_node(node_js);
     }
+    return make_function(func_js);
+}
+
+shared_ptr<Function> JSONDeserializer::make_function(json func_js)
+{
+    string func_name = func_js.at("name").get<string>();
+    vector<json> func_result = func_js.at("result");
 
     // This handles both graphs w/ `op::Result` and legacy graphs w/o it
     // If we are dealing w/ a legacy graph, add op::Result for each output node
@@ -1051,8 +1533,17 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
                 has_key(node_js, "element_type") ? node_js : node_js.at("value_type");
             auto element_type = read_element_type(type_node_js.at("element_type"));
             auto shape = type_node_js.at("shape");
-            auto value = node_js.at("value").get<vector<string>>();
-            node = make_shared<op::Constant>(element_type, shape, value);
+            if (!has_key(node_js, "value") && m_const_data_callback)
+            {
+                // The data is stored outside of the json
+                node = m_const_data_callback(node_name, element_type, shape);
+                NGRAPH_CHECK(node, "No data found for constant ", node_name);
+            }
+            else
+            {
+                auto value = node_js.at("value").get<vector<string>>();
+                node = make_shared<op::Constant>(element_type, shape, value);
+            }
             break;
         }
         case OP_TYPEID::Convert:
@@ -3373,7 +3864,13 @@ json JSONSerializer::serialize_node(const Node& n)
     case OP_TYPEID::Constant:
     {
         auto tmp = static_cast<const op::Constant*>(&n);
-        if (tmp->get_all_data_elements_bitwise_identical() && shape_size(tmp->get_shape()) > 0)
+        if (m_binary_constant_data)
+        {
+            // The data is written separately, see serialize_to_cpio
+            m_binary_constants.push_back(tmp);
+        }
+        else if (tmp->get_all_data_elements_bitwise_identical() &&
+                 shape_size(tmp->get_shape()) > 0)
         {
             vector<string> vs;
             vs.push_back(tmp->convert_value_to_string(0));
@@ -51,13 +51,56 @@ namespace ngraph
     NGRAPH_API
     void serialize(std::ostream& out, std::shared_ptr<ngraph::Function> func, size_t indent = 0);
 
+    /// \brief Serialize a Function to a cpio archive holding the json graph and the raw data of
+    ///        every Constant. The constant data is aligned so that deserializing the archive from
+    ///        a file path can memory map it instead of copying the data.
+    /// \param path The path to the output file
+    /// \param func The Function to serialize
+    /// \param indent If 0 then there is no formatting applied and the json is the
+    ///    most compact representation. If non-zero then the json is formatted with the
+    ///    indent level specified.
+    NGRAPH_API
+    void serialize_to_cpio(const std::string& path,
+                           std::shared_ptr<ngraph::Function> func,
+                           size_t indent = 0);
+
+    /// \brief Serialize a Function to a cpio archive on a stream
+    /// \param out The output stream to which the archive is written
+    /// \param func The Function to serialize
+    /// \param indent If 0 then there is no formatting applied and the json is the
+    ///    most compact representation. If non-zero then the json is formatted with the
+    ///    indent level specified.
+    NGRAPH_API
+    void serialize_to_cpio(std::ostream& out,
+                           std::shared_ptr<ngraph::Function> func,
+                           size_t indent = 0);
+
+    /// \brief Serialize a Function to the compact binary format
+    ///
+    /// The graph is stored as MessagePack followed by the raw, aligned data of every Constant.
+    /// Deserializing it avoids parsing text and, when loaded from a file path, memory maps the
+    /// constant data instead of copying it.
+    /// \param path The path to the output file
+    /// \param func The Function to serialize
+    NGRAPH_API
+    void serialize_binary(const std::string& path, std::shared_ptr<ngraph::Function> func);
+
+    /// \brief Serialize a Function to the compact binary format on a stream
+    /// \param out The output stream to which the data is written
+    /// \param func The Function to serialize
+    NGRAPH_API
+    void serialize_binary(std::ostream& out, std::shared_ptr<ngraph::Function> func);
+
     /// \brief Deserialize a Function
     /// \param in An isteam to the input data
     NGRAPH_API
     std::shared_ptr<ngraph::Function> deserialize(std::istream& in);
 
     /// \brief Deserialize a Function
-    /// \param str The json formatted string to deseriailze.
+    /// \param str The json formatted string or binary graph to deseriailze, or the path of a
+    ///    json file, binary graph or cpio archive. Constants of a binary graph or of a cpio
+    ///    archive written by serialize_to_cpio share the memory mapped file rather than copying
+    ///    its data.
     NGRAPH_API
     std::shared_ptr<ngraph::Function> deserialize(const std::string& str);
 
@@ -0,0 +1,150 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace ngraph
+{
+    /// \brief Append-only sequence whose elements never move once they are constructed.
+    ///
+    /// The first N elements are stored inside the object, so short sequences do not touch the
+    /// heap at all. Further elements are kept in a std::deque that is allocated on first use.
+    template <typename T, size_t N>
+    class SmallDeque
+    {
+    public:
+        template <typename V, typename C>
+        class Iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = typename std::remove_const<V>::type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = V*;
+            using reference = V&;
+
+            Iterator(C* container, size_t index)
+                : m_container(container)
+                , m_index(index)
+            {
+            }
+            reference operator*() const { return (*m_container)[m_index]; }
+            pointer operator->() const { return &(*m_container)[m_index]; }
+            Iterator& operator++()
+            {
+                ++m_index;
+                return *this;
+            }
+            Iterator operator++(int)
+            {
+                Iterator it = *this;
+                ++m_index;
+                return it;
+            }
+            bool operator==(const Iterator& other) const { return m_index == other.m_index; }
+            bool operator!=(const Iterator& other) const { return m_index != other.m_index; }
+        private:
+            C* m_container;
+            size_t m_index;
+        };
+
+        using value_type = T;
+        using iterator = Iterator<T, SmallDeque>;
+        using const_iterator = Iterator<const T, const SmallDeque>;
+
+        SmallDeque() = default;
+        SmallDeque(const SmallDeque&) = delete;
+        SmallDeque& operator=(const SmallDeque&) = delete;
+        ~SmallDeque()
+        {
+            for (size_t i = 0; i < std::min(m_size, N); ++i)
+            {
+                inline_element(i)->~T();
+            }
+        }
+
+        template <typename... Args>
+        T& emplace_back(Args&&... args)
+        {
+            T* element;
+            if (m_size < N)
+            {
+                element = new (&m_inline[m_size]) T(std::forward<Args>(args)...);
+            }
+            else
+            {
+                if (!m_overflow)
+                {
+                    m_overflow.reset(new std::deque<T>());
+                }
+                m_overflow->emplace_back(std::forward<Args>(args)...);
+                element = &m_overflow->back();
+            }
+            ++m_size;
+            return *element;
+        }
+
+        size_t size() const { return m_size; }
+        bool empty() const { return m_size == 0; }
+        T& operator[](size_t i) { return i < N ? *inline_element(i) : (*m_overflow)[i - N]; }
+        const T& operator[](size_t i) const
+        {
+            return i < N ? *inline_element(i) : (*m_overflow)[i - N];
+        }
+        T& at(size_t i)
+        {
+            check_index(i);
+            return (*this)[i];
+        }
+        const T& at(size_t i) const
+        {
+            check_index(i);
+            return (*this)[i];
+        }
+
+        iterator begin() { return iterator(this, 0); }
+        iterator end() { return iterator(this, m_size); }
+        const_iterator begin() const { return const_iterator(this, 0); }
+        const_iterator end() const { return const_iterator(this, m_size); }
+    private:
+        T* inline_element(size_t i) { return reinterpret_cast<T*>(&m_inline[i]); }
+        const T* inline_element(size_t i) const
+        {
+            return reinterpret_cast<const T*>(&m_inline[i]);
+        }
+        void check_index(size_t i) const
+        {
+            if (i >= m_size)
+            {
+                throw std::out_of_range("SmallDeque index out of range");
+            }
+        }
+
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type m_inline[N];
+        size_t m_size = 0;
+        std::unique_ptr<std::deque<T>> m_overflow;
+    };
+}
@@ -43,7 +43,9 @@ std::shared_ptr<Function>
     NGRAPH_CHECK(f->get_parameters().size() == parameter_element_types.size());
     NGRAPH_CHECK(f->get_parameters().size() == parameter_values.size());
 
+    auto ordered_ops = f->get_ordered_ops();
     NodeMap m;
+    m.reserve(ordered_ops.size());
 
     for (size_t i = 0; i < parameter_shapes.size(); i++)
     {
@@ -64,36 +66,41 @@ std::shared_ptr<Function>
         m[f->get_parameters()[i].get()]->get_rt_info() = f->get_parameters()[i]->get_rt_info();
     }
 
-    for (auto old_node : f->get_ordered_ops())
+    OutputVector new_args;
+    for (auto& old_node : ordered_ops)
     {
         if (old_node->is_parameter())
         {
             continue;
         }
 
-        OutputVector new_args;
-        for (auto input : old_node->inputs())
+        new_args.clear();
+        for (size_t i = 0; i < old_node->get_input_size(); ++i)
         {
-            auto output = input.get_source_output();
+            auto output = old_node->input_value(i);
             new_args.push_back(output.for_node(m[output.get_node()]));
         }
 
+        auto& new_node = m[old_node.get()];
         if (share_constants && as_type_ptr<op::Constant>(old_node))
         {
-            m[old_node.get()] = old_node;
+            new_node = old_node;
         }
         else
         {
-            m[old_node.get()] = old_node->copy_with_new_inputs(new_args);
+            new_node = old_node->copy_with_new_inputs(new_args);
             //  TODO: workaround for shape inference, delete it after fix
-            if (::ngraph::as_type_ptr<ngraph::op::TensorIterator>(m[old_node.get()]))
+            if (::ngraph::as_type_ptr<ngraph::op::TensorIterator>(new_node))
             {
-                m[old_node.get()]->validate_and_infer_types();
+                new_node->validate_and_infer_types();
+            }
+            if (!old_node->get_rt_info().empty())
+            {
+                new_node->get_rt_info() = old_node->get_rt_info();
             }
-            m[old_node.get()]->get_rt_info() = old_node->get_rt_info();
         }
 
-        m[old_node.get()]->set_friendly_name(old_node->get_friendly_name());
+        new_node->set_friendly_name(old_node->get_friendly_name());
     }
 
     ParameterVector new_parameters = f->get_parameters();
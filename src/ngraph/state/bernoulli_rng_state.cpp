@@ -14,8 +14,6 @@
 // limitations under the License.
 //*****************************************************************************
 
-#include <random>
-
 #include "bernoulli_rng_state.hpp"
 #include "except.hpp"
 
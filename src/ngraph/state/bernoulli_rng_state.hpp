@@ -16,10 +16,10 @@
 
 #pragma once
 
-#include <functional>
-#include <memory>
-#include <random>
+#include <atomic>
+#include <cstdint>
 
+#include "ngraph/state/philox.hpp"
 #include "state.hpp"
 
 namespace ngraph
@@ -27,19 +27,25 @@ namespace ngraph
     class NGRAPH_API BernoulliRNGState : public State
     {
     public:
-        BernoulliRNGState(unsigned int seed, double probability)
+        BernoulliRNGState(uint64_t seed, double probability)
             : State()
             , m_generator(seed)
-            , m_distribution(probability)
+            , m_probability(probability)
         {
         }
         virtual void activate() override;
         virtual void deactivate() override;
         virtual ~BernoulliRNGState() override {}
-        std::mt19937& get_generator() { return m_generator; }
-        std::bernoulli_distribution& get_distribution() { return m_distribution; }
+        const Philox4x32& get_generator() const { return m_generator; }
+        double get_probability() const { return m_probability; }
+        /// \brief Reserves the next `count` values of the stream
+        /// \return The offset of the first reserved value
+        ///
+        /// Safe to call from executables running concurrently on the same state.
+        uint64_t advance(uint64_t count) { return m_offset.fetch_add(count); }
     protected:
-        std::mt19937 m_generator;
-        std::bernoulli_distribution m_distribution;
+        Philox4x32 m_generator;
+        double m_probability;
+        std::atomic<uint64_t> m_offset{0};
     };
 }
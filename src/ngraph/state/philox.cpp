@@ -0,0 +1,123 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+
+#include "ngraph/state/philox.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    constexpr uint32_t philox_m0 = 0xD2511F53;
+    constexpr uint32_t philox_m1 = 0xCD9E8D57;
+    constexpr uint32_t philox_w0 = 0x9E3779B9;
+    constexpr uint32_t philox_w1 = 0xBB67AE85;
+    constexpr size_t philox_rounds = 10;
+
+    // Counters are evaluated in lanes of this width. The rounds are written lane by lane over
+    // plain arrays so that the compiler maps each lane loop to vector instructions.
+    constexpr size_t philox_lanes = 16;
+}
+
+constexpr size_t Philox4x32::values_per_counter;
+
+Philox4x32::Philox4x32(uint64_t seed, uint64_t stream)
+    : m_key{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)}
+    , m_stream{static_cast<uint32_t>(stream), static_cast<uint32_t>(stream >> 32)}
+{
+}
+
+void Philox4x32::generate_counters(uint32_t* out,
+                                   uint64_t first_counter,
+                                   size_t num_counters) const
+{
+    while (num_counters > 0)
+    {
+        size_t lanes = min(num_counters, philox_lanes);
+        uint32_t c0[philox_lanes];
+        uint32_t c1[philox_lanes];
+        uint32_t c2[philox_lanes];
+        uint32_t c3[philox_lanes];
+        for (size_t lane = 0; lane < philox_lanes; lane++)
+        {
+            uint64_t counter = first_counter + lane;
+            c0[lane] = static_cast<uint32_t>(counter);
+            c1[lane] = static_cast<uint32_t>(counter >> 32);
+            c2[lane] = m_stream[0];
+            c3[lane] = m_stream[1];
+        }
+
+        uint32_t k0 = m_key[0];
+        uint32_t k1 = m_key[1];
+        for (size_t round = 0; round < philox_rounds; round++)
+        {
+            for (size_t lane = 0; lane < philox_lanes; lane++)
+            {
+                uint64_t p0 = static_cast<uint64_t>(philox_m0) * c0[lane];
+                uint64_t p1 = static_cast<uint64_t>(philox_m1) * c2[lane];
+                uint32_t n0 = static_cast<uint32_t>(p1 >> 32) ^ c1[lane] ^ k0;
+                uint32_t n2 = static_cast<uint32_t>(p0 >> 32) ^ c3[lane] ^ k1;
+                c1[lane] = static_cast<uint32_t>(p1);
+                c3[lane] = static_cast<uint32_t>(p0);
+                c0[lane] = n0;
+                c2[lane] = n2;
+            }
+            k0 += philox_w0;
+            k1 += philox_w1;
+        }
+
+        for (size_t lane = 0; lane < lanes; lane++)
+        {
+            out[0] = c0[lane];
+            out[1] = c1[lane];
+            out[2] = c2[lane];
+            out[3] = c3[lane];
+            out += values_per_counter;
+        }
+        first_counter += lanes;
+        num_counters -= lanes;
+    }
+}
+
+void Philox4x32::generate(uint32_t* out, size_t count, uint64_t offset) const
+{
+    uint64_t counter = offset / values_per_counter;
+    size_t skip = offset % values_per_counter;
+    uint32_t partial[values_per_counter];
+    if (skip != 0 && count > 0)
+    {
+        // The request starts in the middle of a counter
+        generate_counters(partial, counter++, 1);
+        size_t n = min(count, values_per_counter - skip);
+        copy(partial + skip, partial + skip + n, out);
+        out += n;
+        count -= n;
+    }
+
+    size_t num_counters = count / values_per_counter;
+    generate_counters(out, counter, num_counters);
+    out += num_counters * values_per_counter;
+    counter += num_counters;
+    count -= num_counters * values_per_counter;
+
+    if (count > 0)
+    {
+        generate_counters(partial, counter, 1);
+        copy(partial, partial + count, out);
+    }
+}
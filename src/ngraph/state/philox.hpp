@@ -0,0 +1,80 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "ngraph/ngraph_visibility.hpp"
+
+namespace ngraph
+{
+    /// \brief Philox4x32-10 counter-based random number generator, as described in "Parallel
+    ///        Random Numbers: As Easy as 1, 2, 3" (Salmon et al., SC 2011).
+    ///
+    /// Value `i` of a stream is a pure function of the key and of `i`, so any range of the stream
+    /// can be generated independently. Splitting a request across any number of threads produces
+    /// bit-identical results, and skipping ahead costs nothing.
+    class NGRAPH_API Philox4x32
+    {
+    public:
+        /// \brief Constructs the generator for one stream of a seed
+        /// \param seed The key of the generator
+        /// \param stream Selects one of 2^64 independent streams of the key
+        explicit Philox4x32(uint64_t seed, uint64_t stream = 0);
+
+        /// \brief Writes values [offset, offset + count) of the stream to `out`
+        void generate(uint32_t* out, size_t count, uint64_t offset) const;
+
+        /// \brief Number of values produced by one evaluation of the counter function
+        static constexpr size_t values_per_counter = 4;
+
+    private:
+        // Writes the values of `num_counters` consecutive counters, starting at `first_counter`
+        void generate_counters(uint32_t* out, uint64_t first_counter, size_t num_counters) const;
+
+        uint32_t m_key[2];
+        uint32_t m_stream[2];
+    };
+
+    /// \brief Maps the top 24 bits of a random value to a float in [0, 1)
+    inline float random_unit_float(uint32_t value)
+    {
+        return static_cast<float>(value >> 8) * (1.0f / 16777216.0f);
+    }
+
+    /// \brief Maps 53 bits of two random values to a double in [0, 1)
+    inline double random_unit_double(uint32_t high, uint32_t low)
+    {
+        return static_cast<double>((static_cast<uint64_t>(high) << 21) | (low >> 11)) *
+               (1.0 / 9007199254740992.0);
+    }
+
+    /// \brief Returns the bound below which a random 32 bit value is drawn with probability `p`
+    inline uint64_t bernoulli_threshold(double p)
+    {
+        if (p <= 0)
+        {
+            return 0;
+        }
+        if (p >= 1)
+        {
+            return uint64_t(1) << 32;
+        }
+        return static_cast<uint64_t>(p * 4294967296.0);
+    }
+}
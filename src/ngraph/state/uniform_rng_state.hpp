@@ -16,10 +16,11 @@
 
 #pragma once
 
-#include <functional>
-#include <memory>
+#include <atomic>
+#include <cstdint>
 #include <random>
 
+#include "ngraph/state/philox.hpp"
 #include "state.hpp"
 
 namespace ngraph
@@ -27,25 +28,27 @@ namespace ngraph
     class UniformRNGState : public State
     {
     public:
-        UniformRNGState(std::mt19937::result_type seed)
+        UniformRNGState(uint64_t seed)
             : State()
-            , m_generator(std::mt19937::result_type(seed))
-            , m_distribution()
+            , m_generator(seed)
         {
         }
         UniformRNGState()
             : State()
             , m_generator(std::random_device()())
-            , m_distribution()
         {
         }
         virtual void activate() override {}
         virtual void deactivate() override {}
         virtual ~UniformRNGState() override {}
-        std::mt19937& get_generator() { return m_generator; }
-        std::uniform_real_distribution<double>& get_distribution() { return m_distribution; }
+        const Philox4x32& get_generator() const { return m_generator; }
+        /// \brief Reserves the next `count` values of the stream
+        /// \return The offset of the first reserved value
+        ///
+        /// Safe to call from executables running concurrently on the same state.
+        uint64_t advance(uint64_t count) { return m_offset.fetch_add(count); }
     private:
-        std::mt19937 m_generator;
-        std::uniform_real_distribution<double> m_distribution;
+        Philox4x32 m_generator;
+        std::atomic<uint64_t> m_offset{0};
     };
 }
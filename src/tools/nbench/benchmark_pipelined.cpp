@@ -14,12 +14,17 @@
 // limitations under the License.
 //*****************************************************************************
 
-#include <array>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <condition_variable>
+#include <deque>
+#include <iomanip>
 #include <mutex>
 #include <thread>
 
 #include "benchmark.hpp"
+#include "benchmark_pipelined.hpp"
 #include "benchmark_utils.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/runtime/backend.hpp"
@@ -31,6 +36,8 @@
 using namespace std;
 using namespace ngraph;
 
+using benchmark_clock = chrono::steady_clock;
+
 class TensorCollection
 {
 public:
@@ -43,78 +50,143 @@ public:
 private:
 };
 
-static mutex s_mutex;
-static condition_variable s_condition;
-static size_t current_iteration = 0;
-static size_t s_iterations;
-static size_t s_warmup_iterations;
-static stopwatch s_timer;
+// A stream owns one set of tensors per pipeline stage. Its loader thread writes the input data of
+// the next request into a free stage while its executor thread runs the executable on a stage
+// that is already loaded, so the input copy of one request overlaps the execution of the previous
+// one. Streams only share the executable.
+class Stream
+{
+public:
+    vector<TensorCollection> stages;
 
-static void
-    thread_entry(runtime::Executable* exec, const TensorCollection& tensors, size_t pipeline_stage)
+    // Requests handled by this stream and the latency of each, measured from the request's
+    // arrival (its scheduled time in open-loop mode) to the end of the result copy
+    size_t requests = 0;
+    vector<double> latencies_us;
+    benchmark_clock::time_point last_completion;
+
+    mutex stage_mutex;
+    condition_variable stage_condition;
+    deque<size_t> free_stages;
+    deque<pair<size_t, benchmark_clock::time_point>> loaded_stages;
+};
+
+static void write_inputs(const TensorCollection& tensors, bool force)
 {
-    bool data_written = false;
-    const vector<shared_ptr<runtime::Tensor>>& args = tensors.input_tensors;
-    const vector<shared_ptr<runtime::Tensor>>& results = tensors.output_tensors;
-    while (current_iteration < s_iterations + s_warmup_iterations)
+    for (size_t arg_index = 0; arg_index < tensors.input_tensors.size(); arg_index++)
     {
-        if (!data_written)
+        const shared_ptr<runtime::Tensor>& arg = tensors.input_tensors[arg_index];
+        if (force || arg->get_stale())
         {
-            for (size_t arg_index = 0; arg_index < args.size(); arg_index++)
-            {
-                const shared_ptr<runtime::Tensor>& arg = args[arg_index];
-                if (arg->get_stale())
-                {
-                    const shared_ptr<runtime::HostTensor>& data = tensors.parameter_data[arg_index];
-                    arg->write(data->get_data_ptr(),
-                               data->get_element_count() * data->get_element_type().size());
-                }
-            }
-            data_written = true;
+            const shared_ptr<runtime::HostTensor>& data = tensors.parameter_data[arg_index];
+            arg->write(data->get_data_ptr(),
+                       data->get_element_count() * data->get_element_type().size());
+        }
+    }
+}
+
+static void read_outputs(const TensorCollection& tensors)
+{
+    for (size_t result_index = 0; result_index < tensors.output_tensors.size(); result_index++)
+    {
+        const shared_ptr<runtime::HostTensor>& data = tensors.result_data[result_index];
+        tensors.output_tensors[result_index]->read(
+            data->get_data_ptr(), data->get_element_count() * data->get_element_type().size());
+    }
+}
+
+static void loader_entry(Stream& stream,
+                         size_t stream_index,
+                         size_t num_streams,
+                         benchmark_clock::time_point start,
+                         double arrival_rate,
+                         bool copy_data)
+{
+    for (size_t request = 0; request < stream.requests; request++)
+    {
+        // In open-loop mode request i of the whole benchmark arrives at start + i / rate and
+        // requests are dealt to the streams round-robin
+        benchmark_clock::time_point arrival;
+        if (arrival_rate > 0)
+        {
+            auto global_request = request * num_streams + stream_index;
+            arrival = start + chrono::duration_cast<benchmark_clock::duration>(
+                                  chrono::duration<double>(global_request / arrival_rate));
+            this_thread::sleep_until(arrival);
         }
-        unique_lock<mutex> lock(s_mutex);
-        if ((current_iteration & 1) != pipeline_stage)
+
+        size_t stage;
         {
-            s_condition.wait(lock);
+            unique_lock<mutex> lock(stream.stage_mutex);
+            stream.stage_condition.wait(lock, [&]() { return !stream.free_stages.empty(); });
+            stage = stream.free_stages.front();
+            stream.free_stages.pop_front();
         }
-        else
+        if (arrival_rate <= 0)
         {
-            if (current_iteration == s_warmup_iterations)
-            {
-                s_timer.start();
-            }
-            // our turn to run
-            exec->call(results, args);
-            current_iteration++;
-            data_written = false;
-            s_condition.notify_all();
-            lock.unlock();
-            for (size_t result_index = 0; result_index < results.size(); result_index++)
-            {
-                const shared_ptr<runtime::HostTensor>& data = tensors.result_data[result_index];
-                const shared_ptr<runtime::Tensor>& result = results[result_index];
-                result->read(data->get_data_ptr(),
-                             data->get_element_count() * data->get_element_type().size());
-            }
-            if (current_iteration == (s_iterations + s_warmup_iterations - 1))
-            {
-                s_timer.stop();
-            }
+            arrival = benchmark_clock::now();
         }
+
+        write_inputs(stream.stages[stage], copy_data);
+
+        {
+            lock_guard<mutex> lock(stream.stage_mutex);
+            stream.loaded_stages.push_back({stage, arrival});
+        }
+        stream.stage_condition.notify_all();
     }
 }
 
+static void executor_entry(runtime::Executable* exec, Stream& stream)
+{
+    for (size_t request = 0; request < stream.requests; request++)
+    {
+        pair<size_t, benchmark_clock::time_point> loaded;
+        {
+            unique_lock<mutex> lock(stream.stage_mutex);
+            stream.stage_condition.wait(lock, [&]() { return !stream.loaded_stages.empty(); });
+            loaded = stream.loaded_stages.front();
+            stream.loaded_stages.pop_front();
+        }
+
+        const TensorCollection& tensors = stream.stages[loaded.first];
+        exec->call(tensors.output_tensors, tensors.input_tensors);
+        read_outputs(tensors);
+
+        auto completion = benchmark_clock::now();
+        stream.latencies_us.push_back(
+            chrono::duration<double, micro>(completion - loaded.second).count());
+        stream.last_completion = completion;
+
+        {
+            lock_guard<mutex> lock(stream.stage_mutex);
+            stream.free_stages.push_back(loaded.first);
+        }
+        stream.stage_condition.notify_all();
+    }
+}
+
+// Nearest-rank percentile of sorted values
+static double percentile(const vector<double>& sorted, double p)
+{
+    if (sorted.empty())
+    {
+        return 0;
+    }
+    size_t rank = static_cast<size_t>(ceil(p / 100.0 * sorted.size()));
+    return sorted[min(max(rank, size_t(1)), sorted.size()) - 1];
+}
+
 vector<runtime::PerformanceCounter> run_benchmark_pipelined(shared_ptr<Function> f,
                                                             const string& backend_name,
                                                             size_t iterations,
                                                             bool timing_detail,
                                                             int warmup_iterations,
-                                                            bool /* copy_data */)
+                                                            bool copy_data,
+                                                            size_t num_streams,
+                                                            double arrival_rate)
 {
-    constexpr size_t pipeline_depth = 2;
-    s_iterations = iterations;
-    s_warmup_iterations = warmup_iterations;
-    array<TensorCollection, pipeline_depth> tensor_collections;
+    num_streams = max(num_streams, size_t(1));
     stopwatch timer;
     timer.start();
     auto backend = runtime::Backend::create(backend_name);
@@ -125,65 +197,111 @@ vector<runtime::PerformanceCounter> run_benchmark_pipelined(shared_ptr<Function>
     ss << "compile time: " << timer.get_milliseconds() << "ms" << endl;
     set_denormals_flush_to_zero();
 
-    // Create random input data for all input tensors
-    for (size_t i = 0; i < pipeline_depth; i++)
+    size_t pipeline_depth = max(exec->get_preferred_pipeline_depth(), size_t(1));
+    vector<unique_ptr<Stream>> streams;
+    for (size_t s = 0; s < num_streams; s++)
     {
-        for (shared_ptr<op::Parameter> param : f->get_parameters())
+        streams.emplace_back(new Stream());
+        Stream& stream = *streams.back();
+        stream.stages.resize(pipeline_depth);
+        stream.requests = iterations / num_streams + (s < iterations % num_streams ? 1 : 0);
+        stream.latencies_us.reserve(stream.requests);
+
+        // Create random input data and host buffers for the results
+        for (TensorCollection& stage : stream.stages)
         {
-            auto tensor_data =
-                make_shared<runtime::HostTensor>(param->get_element_type(), param->get_shape());
-            random_init(tensor_data);
-            tensor_collections[i].parameter_data.push_back(tensor_data);
+            for (shared_ptr<op::Parameter> param : f->get_parameters())
+            {
+                auto tensor_data = make_shared<runtime::HostTensor>(param->get_element_type(),
+                                                                    param->get_shape());
+                random_init(tensor_data);
+                stage.parameter_data.push_back(tensor_data);
+            }
+            for (shared_ptr<Node> result : f->get_results())
+            {
+                auto tensor_data = make_shared<runtime::HostTensor>(result->get_element_type(),
+                                                                    result->get_shape());
+                stage.result_data.push_back(tensor_data);
+            }
         }
-    }
 
-    // Create output tensors for all outputs
-    for (size_t i = 0; i < pipeline_depth; i++)
-    {
-        for (shared_ptr<Node> result : f->get_results())
+        // Let the executable allocate the per-stage tensors of every input and output
+        for (size_t input_index = 0; input_index < f->get_parameters().size(); input_index++)
         {
-            auto tensor_data =
-                make_shared<runtime::HostTensor>(result->get_element_type(), result->get_shape());
-            tensor_collections[i].result_data.push_back(tensor_data);
+            auto input_tensors = exec->create_input_tensor(input_index, pipeline_depth);
+            for (size_t i = 0; i < pipeline_depth; i++)
+            {
+                stream.stages[i].input_tensors.push_back(input_tensors[i]);
+            }
+        }
+        for (size_t output_index = 0; output_index < f->get_results().size(); output_index++)
+        {
+            auto output_tensors = exec->create_output_tensor(output_index, pipeline_depth);
+            for (size_t i = 0; i < pipeline_depth; i++)
+            {
+                stream.stages[i].output_tensors.push_back(output_tensors[i]);
+            }
         }
-    }
 
-    // Create input tensors for all Parameters
-    array<vector<shared_ptr<runtime::Tensor>>, pipeline_depth> input_tensors_array;
-    size_t input_index = 0;
-    for (shared_ptr<op::Parameter> param : f->get_parameters())
-    {
-        auto input_tensors = exec->create_input_tensor(input_index++, pipeline_depth);
         for (size_t i = 0; i < pipeline_depth; i++)
         {
-            tensor_collections[i].input_tensors.push_back(input_tensors[i]);
+            write_inputs(stream.stages[i], true);
+            stream.free_stages.push_back(i);
         }
     }
 
-    // Create output tensors for all Results
-    array<vector<shared_ptr<runtime::Tensor>>, pipeline_depth> output_tensors_array;
-    size_t output_index = 0;
-    for (shared_ptr<Node> result : f->get_results())
+    // Warm up every stage of every stream outside of the measured window
+    for (int i = 0; i < warmup_iterations; i++)
     {
-        auto output_tensors = exec->create_output_tensor(output_index++, pipeline_depth);
-        for (size_t i = 0; i < pipeline_depth; i++)
+        for (auto& stream : streams)
         {
-            tensor_collections[i].output_tensors.push_back(output_tensors[i]);
+            const TensorCollection& tensors = stream->stages[i % pipeline_depth];
+            exec->call(tensors.output_tensors, tensors.input_tensors);
+            read_outputs(tensors);
         }
     }
 
-    thread threads[pipeline_depth];
-    for (size_t i = 0; i < pipeline_depth; i++)
+    vector<thread> threads;
+    auto start = benchmark_clock::now();
+    for (size_t s = 0; s < num_streams; s++)
+    {
+        Stream& stream = *streams[s];
+        threads.emplace_back(
+            loader_entry, ref(stream), s, num_streams, start, arrival_rate, copy_data);
+        threads.emplace_back(executor_entry, exec.get(), ref(stream));
+    }
+    for (thread& t : threads)
+    {
+        t.join();
+    }
+
+    vector<double> latencies;
+    auto end = start;
+    for (auto& stream : streams)
     {
-        threads[i] = thread(thread_entry, exec.get(), tensor_collections[i], i);
+        latencies.insert(latencies.end(), stream->latencies_us.begin(), stream->latencies_us.end());
+        end = max(end, stream->last_completion);
     }
+    sort(latencies.begin(), latencies.end());
+    double seconds = chrono::duration<double>(end - start).count();
 
-    for (size_t i = 0; i < pipeline_depth; i++)
+    ss << num_streams << " streams, pipeline depth " << pipeline_depth << ", ";
+    if (arrival_rate > 0)
+    {
+        ss << "open loop at " << arrival_rate << " requests/s" << endl;
+    }
+    else
     {
-        threads[i].join();
+        ss << "closed loop" << endl;
     }
-    float time = s_timer.get_milliseconds();
-    ss << time / iterations << "ms per iteration" << endl;
+    ss << fixed << setprecision(3);
+    ss << "throughput: " << (seconds > 0 ? latencies.size() / seconds : 0) << " requests/s"
+       << endl;
+    ss << "latency (ms): min " << percentile(latencies, 0) / 1000 << ", p50 "
+       << percentile(latencies, 50) / 1000 << ", p90 " << percentile(latencies, 90) / 1000
+       << ", p99 " << percentile(latencies, 99) / 1000 << ", p99.9 "
+       << percentile(latencies, 99.9) / 1000 << ", max " << percentile(latencies, 100) / 1000
+       << endl;
     cout << ss.str();
 
     vector<runtime::PerformanceCounter> perf_data = exec->get_performance_data();
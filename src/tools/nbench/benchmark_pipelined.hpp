@@ -24,10 +24,17 @@
 #include "ngraph/function.hpp"
 #include "ngraph/runtime/performance_counter.hpp"
 
+/// \brief Runs `iterations` requests spread over `num_streams` concurrent streams against one
+///        executable and reports throughput and latency percentiles. Each stream pipelines its
+///        input copies over the executable's preferred pipeline depth.
+/// \param arrival_rate Total requests per second in open-loop mode. If zero, every stream issues
+///        its next request as soon as a pipeline stage is free (closed loop).
 std::vector<ngraph::runtime::PerformanceCounter>
     run_benchmark_pipelined(std::shared_ptr<ngraph::Function> f,
                             const std::string& backend_name,
                             size_t iterations,
                             bool timing_detail,
                             int warmup_iterations,
-                            bool copy_data);
+                            bool copy_data,
+                            size_t num_streams = 1,
+                            double arrival_rate = 0);
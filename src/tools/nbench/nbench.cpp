@@ -187,6 +187,8 @@ int main(int argc, char** argv)
     bool dump_results = false;
     bool dot_file = false;
     bool double_buffer = false;
+    int streams = 1;
+    double arrival_rate = 0;
 
     configure_static_backends();
     for (int i = 1; i < argc; i++)
@@ -244,6 +246,36 @@ int main(int argc, char** argv)
         {
             double_buffer = true;
         }
+        else if (arg == "--streams")
+        {
+            try
+            {
+                streams = stoi(argv[++i]);
+                double_buffer = true;
+                if (streams < 1)
+                {
+                    throw invalid_argument("streams");
+                }
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
+        else if (arg == "--rate")
+        {
+            try
+            {
+                arrival_rate = stod(argv[++i]);
+                double_buffer = true;
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
         else if (arg == "-w" || arg == "--warmup_iterations")
         {
             try
@@ -300,6 +332,10 @@ OPTIONS
         --dump_results            Dump result tensors to standard output.
         --dot                     Generate Graphviz dot file
         --double_buffer           Double buffer inputs and outputs
+        --streams                 Number of concurrent request streams, implies --double_buffer
+                                  (default: 1)
+        --rate                    Open-loop arrival rate in requests/s over all streams,
+                                  implies --double_buffer (default: closed loop)
 )###";
         return 1;
     }
@@ -371,7 +407,7 @@ OPTIONS
                     {
                         type_list.insert(value.get_element_type().c_type_string());
                     }
-                    for (descriptor::Tensor* tensor : node->liveness_new_list)
+                    for (descriptor::Tensor* tensor : node->get_liveness_new_list())
                     {
                         total_temporary_bytes += tensor->size();
                         total_temporary_count++;
@@ -449,8 +485,14 @@ OPTIONS
                 {
                     NGRAPH_CHECK(!dump_results,
                                  "'dump_results' not implemented in double buffer mode");
-                    perf_data = run_benchmark_pipelined(
-                        f, backend, iterations, timing_detail, warmup_iterations, copy_data);
+                    perf_data = run_benchmark_pipelined(f,
+                                                        backend,
+                                                        iterations,
+                                                        timing_detail,
+                                                        warmup_iterations,
+                                                        copy_data,
+                                                        streams,
+                                                        arrival_rate);
                 }
                 else
                 {
@@ -42,11 +42,12 @@ DESCRIPTION
     Reserialize a serialized model
 
 SYNOPSIS
-        reserialize [-i|--input <input file>] [-o|--output <output file>]
+        reserialize [-i|--input <input file>] [-o|--output <output file>] [-b|--binary]
 
 OPTIONS
         -i or --input  input serialized model
         -o or --output output serialized model
+        -b or --binary write the output in the compact binary format
         -c or --constant_to_broacast Convert large constant constants to broadcast
 )###";
 }
@@ -56,6 +57,7 @@ int main(int argc, char** argv)
     string input;
     string output;
     bool c2b = false;
+    bool binary = false;
     for (int i = 1; i < argc; i++)
     {
         string arg = argv[i];
@@ -71,6 +73,10 @@ int main(int argc, char** argv)
         {
             c2b = true;
         }
+        else if (arg == "-b" || arg == "--binary")
+        {
+            binary = true;
+        }
         else if (arg == "-h" || arg == "--help")
         {
             help();
@@ -95,9 +101,12 @@ int main(int argc, char** argv)
     ifstream f(input);
     if (f)
     {
+        f.close();
         ngraph::stopwatch timer;
         timer.start();
-        shared_ptr<ngraph::Function> function = ngraph::deserialize(f);
+        // Deserialize from the path so that the input format is detected and binary inputs are
+        // memory mapped
+        shared_ptr<ngraph::Function> function = ngraph::deserialize(input);
         timer.stop();
         cout << "deserialize took " << timer.get_milliseconds() << "ms\n";
 
@@ -109,7 +118,14 @@ int main(int argc, char** argv)
         }
 
         timer.start();
-        ngraph::serialize(output, function);
+        if (binary)
+        {
+            ngraph::serialize_binary(output, function);
+        }
+        else
+        {
+            ngraph::serialize(output, function);
+        }
         timer.stop();
         cout << "serialize took   " << timer.get_milliseconds() << "ms\n";
     }
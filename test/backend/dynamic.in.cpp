@@ -16,6 +16,7 @@
 
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/dynamic/dynamic_backend.hpp"
 #include "util/all_close_f.hpp"
 #include "util/test_control.hpp"
 #include "util/test_tools.hpp"
@@ -292,3 +293,114 @@ NGRAPH_TEST(${BACKEND_NAME}, dynamic_reverse_shape)
                         Shape{8, 2, 8, 2},
                         Shape{2, 3, 4, 5, 2}});
 }
+
+// Computes (a + b) for a, b of shape {2,n,3} with a = b = [0, 1, ...] and checks the result.
+static void check_bucketed_call(const shared_ptr<runtime::Backend>& backend,
+                                const shared_ptr<runtime::Executable>& ex,
+                                size_t middle_dim)
+{
+    Shape shape{2, middle_dim, 3};
+    vector<float> inputs(shape_size(shape));
+    vector<float> expected_values(shape_size(shape));
+    for (size_t i = 0; i < shape_size(shape); i++)
+    {
+        inputs[i] = i;
+        expected_values[i] = i + i;
+    }
+
+    auto t_a = backend->create_tensor(element::f32, shape);
+    auto t_b = backend->create_tensor(element::f32, shape);
+    copy_data(t_a, inputs);
+    copy_data(t_b, inputs);
+    auto t_r =
+        backend->create_dynamic_tensor(element::f32, PartialShape{2, Dimension::dynamic(), 3});
+
+    ex->call_with_validate({t_r}, {t_a, t_b});
+
+    ASSERT_EQ(t_r->get_shape(), shape);
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(t_r), expected_values));
+}
+
+static shared_ptr<runtime::dynamic::DynamicExecutable>
+    compile_bucketed_add(const shared_ptr<runtime::Backend>& backend)
+{
+    auto a = make_shared<op::Parameter>(element::f32, PartialShape{2, Dimension::dynamic(), 3});
+    auto b = make_shared<op::Parameter>(element::f32, PartialShape{2, Dimension::dynamic(), 3});
+    auto f = make_shared<Function>(NodeVector{a + b}, ParameterVector{a, b});
+
+    auto ex = dynamic_pointer_cast<runtime::dynamic::DynamicExecutable>(backend->compile(f));
+    if (ex)
+    {
+        ex->set_shape_buckets(0, 1, {4, 8}, {{0, 1}});
+        ex->set_shape_buckets(1, 1, {4, 8}, {});
+    }
+    return ex;
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, dynamic_shape_buckets)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}", true);
+    auto ex = compile_bucketed_add(backend);
+    if (!ex)
+    {
+        // The backend supports dynamic shapes natively
+        return;
+    }
+
+    for (size_t middle_dim = 1; middle_dim <= 8; middle_dim++)
+    {
+        check_bucketed_call(backend, ex, middle_dim);
+    }
+    // One executable per bucket
+    EXPECT_EQ(ex->get_num_cached_executables(), 2);
+
+    // Sizes past the last edge are compiled exactly
+    check_bucketed_call(backend, ex, 10);
+    EXPECT_EQ(ex->get_num_cached_executables(), 3);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, dynamic_shape_buckets_async_compilation)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}", true);
+    auto ex = compile_bucketed_add(backend);
+    if (!ex)
+    {
+        return;
+    }
+    ex->set_async_compilation(true);
+
+    // Nothing larger is compiled yet, so the first call compiles its bucket synchronously
+    check_bucketed_call(backend, ex, 7);
+    EXPECT_EQ(ex->get_num_cached_executables(), 1);
+
+    // Served by the bucket of size 8 while the bucket of size 4 compiles
+    check_bucketed_call(backend, ex, 3);
+    ex->wait_for_compilations();
+    EXPECT_EQ(ex->get_num_cached_executables(), 2);
+    check_bucketed_call(backend, ex, 3);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, dynamic_cache_byte_budget)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}", true);
+    auto a = make_shared<op::Parameter>(element::f32, PartialShape{2, Dimension::dynamic(), 3});
+    auto b = make_shared<op::Parameter>(element::f32, PartialShape{2, Dimension::dynamic(), 3});
+    auto f = make_shared<Function>(NodeVector{a + b}, ParameterVector{a, b});
+    auto ex = dynamic_pointer_cast<runtime::dynamic::DynamicExecutable>(backend->compile(f));
+    if (!ex)
+    {
+        return;
+    }
+
+    for (size_t middle_dim = 1; middle_dim <= 4; middle_dim++)
+    {
+        check_bucketed_call(backend, ex, middle_dim);
+    }
+    EXPECT_EQ(ex->get_num_cached_executables(), 4);
+
+    // Too small for more than one entry, the most recent one is kept
+    ex->set_cache_byte_budget(1);
+    EXPECT_EQ(ex->get_num_cached_executables(), 1);
+    check_bucketed_call(backend, ex, 2);
+    EXPECT_EQ(ex->get_num_cached_executables(), 1);
+}
@@ -16,6 +16,7 @@
 
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/state/philox.hpp"
 #include "util/all_close.hpp"
 #include "util/all_close_f.hpp"
 #include "util/known_element_types.hpp"
@@ -137,3 +138,35 @@ NGRAPH_TEST(${BACKEND_NAME}, dyn_generate_mask)
     ASSERT_TRUE(test::all_close_f(result2, result2_2));
     ASSERT_FALSE(std::any_of(result2_2.begin(), result2_2.end(), is_not_zero_or_one));
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, generate_mask_counter_based)
+{
+    // Large enough to be generated in several blocks by backends that parallelize
+    Shape result_shape{3, 20000};
+    const unsigned int seed = 777;
+    const double probability = 0.3;
+    auto training = op::Constant::create(element::f32, Shape{}, {1});
+    auto gen_mask = make_shared<op::GenerateMask>(
+        training, result_shape, element::f32, seed, probability, false);
+    auto f = make_shared<Function>(NodeVector{gen_mask}, ParameterVector{});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto result_tv = backend->create_tensor<float>(result_shape);
+    auto handle = backend->compile(f);
+
+    // Without use_seed the mask is the Bernoulli stream of seed 0, and each call continues where
+    // the previous one stopped
+    size_t count = shape_size(result_shape);
+    vector<uint32_t> values(2 * count);
+    Philox4x32(0).generate(values.data(), values.size(), 0);
+    uint64_t threshold = bernoulli_threshold(probability);
+    for (size_t call = 0; call < 2; call++)
+    {
+        handle->call_with_validate({result_tv}, {});
+        auto result = read_vector<float>(result_tv);
+        for (size_t i = 0; i < count; i++)
+        {
+            ASSERT_EQ(values[call * count + i] < threshold ? 1.0f : 0.0f, result[i]);
+        }
+    }
+}
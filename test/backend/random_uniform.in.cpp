@@ -16,6 +16,7 @@
 
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/state/philox.hpp"
 #include "util/all_close.hpp"
 #include "util/all_close_f.hpp"
 #include "util/known_element_types.hpp"
@@ -311,3 +312,31 @@ NGRAPH_TEST(${BACKEND_NAME}, random_uniform_dynamic_shapes)
                                                              "large vectors matched exactly, even "
                                                              "though use_fixed_seed was not set.";
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, random_uniform_counter_based)
+{
+    auto min_val = make_shared<op::Constant>(element::f32, Shape{}, std::vector<float>{63.0f});
+    auto max_val = make_shared<op::Constant>(element::f32, Shape{}, std::vector<float>{120.0f});
+    auto result_shape =
+        make_shared<op::Constant>(element::i64, Shape{2}, std::vector<int64_t>{3, 20000});
+    auto use_fixed_seed =
+        make_shared<op::Constant>(element::boolean, Shape{}, std::vector<char>{1});
+    size_t fixed_seed = 9999;
+    auto ru =
+        make_shared<op::RandomUniform>(min_val, max_val, result_shape, use_fixed_seed, fixed_seed);
+    auto f = make_shared<Function>(NodeVector{ru}, ParameterVector{});
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto ex = backend->compile(f);
+    auto t_r = backend->create_tensor(element::f32, Shape{3, 20000});
+    ex->call_with_validate({t_r}, {});
+    auto results = read_vector<float>(t_r);
+
+    // Each value is drawn from two values of the generator, whatever the number of threads
+    vector<uint32_t> values(2 * results.size());
+    Philox4x32(fixed_seed).generate(values.data(), values.size(), 0);
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        float unit = static_cast<float>(random_unit_double(values[2 * i], values[2 * i + 1]));
+        ASSERT_FLOAT_EQ(unit * (120.0f - 63.0f) + 63.0f, results[i]);
+    }
+}
@@ -0,0 +1,133 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "util/all_close_f.hpp"
+#include "util/test_control.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+NGRAPH_TEST(${BACKEND_NAME}, tensor_iterator_accumulate)
+{
+    // H accumulates the rows of X, slices are contiguous
+    auto X = make_shared<op::Parameter>(element::f32, Shape{4, 2});
+    auto H_init = make_shared<op::Parameter>(element::f32, Shape{1, 2});
+
+    auto Xi = make_shared<op::Parameter>(element::f32, Shape{1, 2});
+    auto Hi = make_shared<op::Parameter>(element::f32, Shape{1, 2});
+    auto Ho = Hi + Xi;
+    auto body =
+        make_shared<op::TensorIterator::BodyLambda>(OutputVector{Ho}, ParameterVector{Xi, Hi});
+
+    auto tensor_iterator = make_shared<op::TensorIterator>();
+    tensor_iterator->set_body(body);
+    // start=0, stride=1, part_size=1, end=-1, axis=0
+    tensor_iterator->set_sliced_input(Xi, X, 0, 1, 1, -1, 0);
+    tensor_iterator->set_merged_input(Hi, H_init, Ho);
+    auto last = tensor_iterator->get_iter_value(Ho, -1);
+    auto all = tensor_iterator->get_concatenated_slices(Ho, 0, 1, 1, -1, 0);
+    auto f = make_shared<Function>(OutputVector{last, all}, ParameterVector{X, H_init});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto x = backend->create_tensor(element::f32, Shape{4, 2});
+    copy_data(x, vector<float>{1, 2, 3, 4, 5, 6, 7, 8});
+    auto h = backend->create_tensor(element::f32, Shape{1, 2});
+    copy_data(h, vector<float>{0, 0});
+    auto result_last = backend->create_tensor(element::f32, Shape{1, 2});
+    auto result_all = backend->create_tensor(element::f32, Shape{4, 2});
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result_last, result_all}, {x, h});
+    EXPECT_TRUE(test::all_close_f(
+        vector<float>{16, 20}, read_vector<float>(result_last), MIN_FLOAT_TOLERANCE_BITS));
+    EXPECT_TRUE(test::all_close_f(vector<float>{1, 2, 4, 6, 9, 12, 16, 20},
+                                  read_vector<float>(result_all),
+                                  MIN_FLOAT_TOLERANCE_BITS));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, tensor_iterator_reverse_strided)
+{
+    // H accumulates the columns of X from the last to the first, slices are strided
+    auto X = make_shared<op::Parameter>(element::f32, Shape{2, 4});
+    auto H_init = make_shared<op::Parameter>(element::f32, Shape{2, 1});
+    auto S = make_shared<op::Parameter>(element::f32, Shape{2, 1});
+
+    auto Xi = make_shared<op::Parameter>(element::f32, Shape{2, 1});
+    auto Hi = make_shared<op::Parameter>(element::f32, Shape{2, 1});
+    auto Si = make_shared<op::Parameter>(element::f32, Shape{2, 1});
+    auto Ho = Hi + Xi * Si;
+    auto body = make_shared<op::TensorIterator::BodyLambda>(OutputVector{Ho},
+                                                            ParameterVector{Xi, Hi, Si});
+
+    auto tensor_iterator = make_shared<op::TensorIterator>();
+    tensor_iterator->set_body(body);
+    // start=-1, stride=-1, part_size=1, end=0, axis=1
+    tensor_iterator->set_sliced_input(Xi, X, -1, -1, 1, 0, 1);
+    tensor_iterator->set_merged_input(Hi, H_init, Ho);
+    tensor_iterator->set_invariant_input(Si, S);
+    auto last = tensor_iterator->get_iter_value(Ho, -1);
+    // start=0, stride=1, part_size=1, end=-1, axis=1
+    auto all = tensor_iterator->get_concatenated_slices(Ho, 0, 1, 1, -1, 1);
+    auto f = make_shared<Function>(OutputVector{last, all}, ParameterVector{X, H_init, S});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto x = backend->create_tensor(element::f32, Shape{2, 4});
+    copy_data(x, vector<float>{1, 2, 3, 4, 5, 6, 7, 8});
+    auto h = backend->create_tensor(element::f32, Shape{2, 1});
+    copy_data(h, vector<float>{0, 0});
+    auto s = backend->create_tensor(element::f32, Shape{2, 1});
+    copy_data(s, vector<float>{1, 2});
+    auto result_last = backend->create_tensor(element::f32, Shape{2, 1});
+    auto result_all = backend->create_tensor(element::f32, Shape{2, 4});
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result_last, result_all}, {x, h, s});
+    EXPECT_TRUE(test::all_close_f(
+        vector<float>{10, 52}, read_vector<float>(result_last), MIN_FLOAT_TOLERANCE_BITS));
+    EXPECT_TRUE(test::all_close_f(vector<float>{4, 7, 9, 10, 16, 30, 42, 52},
+                                  read_vector<float>(result_all),
+                                  MIN_FLOAT_TOLERANCE_BITS));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, tensor_iterator_zero_iterations)
+{
+    // A part size larger than the axis leaves no iteration to take H from
+    auto X = make_shared<op::Parameter>(element::f32, Shape{1, 2});
+    auto H_init = make_shared<op::Parameter>(element::f32, Shape{2, 2});
+
+    auto Xi = make_shared<op::Parameter>(element::f32, Shape{2, 2});
+    auto Hi = make_shared<op::Parameter>(element::f32, Shape{2, 2});
+    auto Ho = Hi + Xi;
+    auto body =
+        make_shared<op::TensorIterator::BodyLambda>(OutputVector{Ho}, ParameterVector{Xi, Hi});
+
+    auto tensor_iterator = make_shared<op::TensorIterator>();
+    tensor_iterator->set_body(body);
+    // start=0, stride=2, part_size=2, end=0, axis=0
+    tensor_iterator->set_sliced_input(Xi, X, 0, 2, 2, 0, 0);
+    tensor_iterator->set_merged_input(Hi, H_init, Ho);
+    auto last = tensor_iterator->get_iter_value(Ho, -1);
+    auto f = make_shared<Function>(OutputVector{last}, ParameterVector{X, H_init});
+    ASSERT_EQ(tensor_iterator->get_num_iterations(), 0);
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    EXPECT_THROW(backend->compile(f), ngraph_error);
+}
@@ -15,6 +15,8 @@
 //*****************************************************************************
 
 #include "gtest/gtest.h"
+#include "misc.hpp"
+#include "ngraph/file_util.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/util.hpp"
@@ -89,6 +91,44 @@ TEST(backend_api, save_load)
         EXPECT_TRUE(test::all_close_f(read_vector<float>(result), {6.f, 8.f, 10.f, 12.f}));
     }
 }
+
+TEST(backend_api, executable_cache)
+{
+    string directory = file_util::path_join(file_util::get_temp_directory_path(),
+                                            "ngraph_backend_api_executable_cache");
+    file_util::remove_directory(directory);
+    set_environment("NGRAPH_EXECUTABLE_CACHE_DIR", directory.c_str(), 1);
+
+    Shape shape{2, 2};
+    auto make_function = [&]() {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        return make_shared<Function>(make_shared<op::Add>(A, B), ParameterVector{A, B});
+    };
+
+    for (int run = 0; run < 2; run++)
+    {
+        // A new backend behaves like a new process, only the directory is shared
+        auto backend = runtime::Backend::create("INTERPRETER");
+        shared_ptr<runtime::Tensor> a = backend->create_tensor(element::f32, shape);
+        shared_ptr<runtime::Tensor> b = backend->create_tensor(element::f32, shape);
+        shared_ptr<runtime::Tensor> result = backend->create_tensor(element::f32, shape);
+        copy_data<float>(a, {1.f, 2.f, 3.f, 4.f});
+        copy_data<float>(b, {5.f, 6.f, 7.f, 8.f});
+
+        auto handle = backend->compile(make_function());
+        handle->call_with_validate({result}, {a, b});
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(result), {6.f, 8.f, 10.f, 12.f}));
+
+        // The second run is served by the entry written by the first
+        size_t entries = 0;
+        file_util::iterate_files(directory, [&](const string&, bool) { entries++; });
+        EXPECT_EQ(entries, 1);
+    }
+
+    unset_environment("NGRAPH_EXECUTABLE_CACHE_DIR");
+    file_util::remove_directory(directory);
+}
 #endif
 
 #if defined(NGRAPH_INTERPRETER_ENABLE) && defined(NGRAPH_CPU_ENABLE)
@@ -17,6 +17,7 @@
 #include <random>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -74,3 +75,73 @@ TEST(INTERPRETER, nan_check_output)
     ihandle->set_nan_check(true);
     EXPECT_ANY_THROW(handle->call_with_validate({result}, {a, b}));
 }
+
+TEST(INTERPRETER, arena_reuses_intermediate_buffers)
+{
+    Shape shape{16};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    shared_ptr<Node> node = A;
+    for (size_t i = 0; i < 8; i++)
+    {
+        node = make_shared<op::Negative>(node);
+    }
+    auto f = make_shared<Function>(node, ParameterVector{A});
+
+    shared_ptr<runtime::Backend> backend = runtime::Backend::create("INTERPRETER");
+    shared_ptr<runtime::Executable> handle = backend->compile(f);
+    shared_ptr<runtime::interpreter::INTExecutable> ihandle =
+        static_pointer_cast<runtime::interpreter::INTExecutable>(handle);
+
+    // Seven intermediates of 64 bytes each, but at most two are live at any time
+    EXPECT_LE(ihandle->get_arena_size(), 2 * shape_size(shape) * sizeof(float));
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    for (float value : {1.0f, -2.0f, 3.0f})
+    {
+        copy_data(a, vector<float>(shape_size(shape), value));
+        handle->call_with_validate({result}, {a});
+        EXPECT_EQ(read_vector<float>(result), vector<float>(shape_size(shape), value));
+    }
+}
+
+TEST(INTERPRETER, arena_concurrent_calls)
+{
+    Shape shape{64};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = op::Constant::create(element::f32, shape, vector<float>(shape_size(shape), 2.0f));
+    auto f = make_shared<Function>((A + B) * C - A, ParameterVector{A, B});
+
+    shared_ptr<runtime::Backend> backend = runtime::Backend::create("INTERPRETER");
+    shared_ptr<runtime::Executable> handle = backend->compile(f);
+
+    vector<thread> threads;
+    vector<char> passed(4, 0);
+    for (size_t t = 0; t < passed.size(); t++)
+    {
+        threads.emplace_back([&, t]() {
+            auto a = backend->create_tensor(element::f32, shape);
+            auto b = backend->create_tensor(element::f32, shape);
+            auto result = backend->create_tensor(element::f32, shape);
+            copy_data(a, vector<float>(shape_size(shape), static_cast<float>(t)));
+            copy_data(b, vector<float>(shape_size(shape), 1.0f));
+            bool ok = true;
+            for (size_t i = 0; i < 100; i++)
+            {
+                handle->call_with_validate({result}, {a, b});
+                ok = ok && read_vector<float>(result) ==
+                               vector<float>(shape_size(shape), static_cast<float>(t + 2));
+            }
+            passed[t] = ok;
+        });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+    for (char ok : passed)
+    {
+        EXPECT_TRUE(ok);
+    }
+}
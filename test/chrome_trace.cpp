@@ -0,0 +1,155 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <fstream>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ngraph/chrome_trace.hpp"
+#include "ngraph/file_util.hpp"
+#include "nlohmann/json.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+static nlohmann::json read_trace(const string& path)
+{
+    ifstream in(path);
+    nlohmann::json trace;
+    in >> trace;
+    return trace;
+}
+
+TEST(chrome_trace, threads)
+{
+    const string tmp_file = "chrome_trace_threads.json";
+    bool tracing_enabled = event::Manager::is_event_tracing_enabled();
+    event::Manager::enable_event_tracing();
+    event::Manager::open(tmp_file);
+
+    vector<thread> threads;
+    for (size_t t = 0; t < 4; t++)
+    {
+        threads.emplace_back([]() {
+            for (size_t i = 0; i < 100; i++)
+            {
+                event::Duration d("event", "test");
+            }
+        });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+    // Events of exited threads are still written
+    event::Manager::close();
+    if (!tracing_enabled)
+    {
+        event::Manager::disable_event_tracing();
+    }
+
+    auto trace = read_trace(tmp_file);
+    file_util::remove_file(tmp_file);
+    ASSERT_TRUE(trace.is_array());
+    EXPECT_EQ(trace.size() + event::Manager::get_dropped_event_count(), 400);
+    for (auto& e : trace)
+    {
+        EXPECT_EQ(e.at("name"), "event");
+        EXPECT_EQ(e.at("cat"), "test");
+        EXPECT_EQ(e.at("ph"), "X");
+    }
+}
+
+TEST(chrome_trace, sampling)
+{
+    const string tmp_file = "chrome_trace_sampling.json";
+    bool tracing_enabled = event::Manager::is_event_tracing_enabled();
+    size_t sampling_rate = event::Manager::get_sampling_rate();
+    event::Manager::enable_event_tracing();
+    event::Manager::set_sampling_rate(4);
+    event::Manager::open(tmp_file);
+
+    for (size_t i = 0; i < 16; i++)
+    {
+        event::SampledCall call;
+        event::Duration d("call", "test");
+        {
+            // Nested calls follow the outermost call
+            event::SampledCall nested;
+            event::Duration d2("nested", "test");
+        }
+    }
+    // Outside of a call every Duration is sampled on its own
+    for (size_t i = 0; i < 8; i++)
+    {
+        event::Duration d3("outside", "test");
+    }
+
+    event::Manager::close();
+    event::Manager::set_sampling_rate(sampling_rate);
+    if (!tracing_enabled)
+    {
+        event::Manager::disable_event_tracing();
+    }
+
+    auto trace = read_trace(tmp_file);
+    file_util::remove_file(tmp_file);
+    ASSERT_TRUE(trace.is_array());
+    size_t calls = 0;
+    size_t nested = 0;
+    size_t outside = 0;
+    for (auto& e : trace)
+    {
+        calls += (e.at("name") == "call");
+        nested += (e.at("name") == "nested");
+        outside += (e.at("name") == "outside");
+    }
+    EXPECT_EQ(calls, 4);
+    EXPECT_EQ(nested, 4);
+    EXPECT_EQ(outside, 2);
+}
+
+TEST(chrome_trace, is_tracing_enabled_does_not_sample)
+{
+    const string tmp_file = "chrome_trace_is_tracing_enabled.json";
+    bool tracing_enabled = event::Manager::is_event_tracing_enabled();
+    size_t sampling_rate = event::Manager::get_sampling_rate();
+    event::Manager::enable_event_tracing();
+    event::Manager::set_sampling_rate(2);
+    event::Manager::open(tmp_file);
+
+    for (size_t i = 0; i < 8; i++)
+    {
+        // Querying outside of a call must not use up the sample of the next call
+        EXPECT_TRUE(event::Manager::is_tracing_enabled());
+        event::SampledCall call;
+        event::Duration d("call", "test");
+    }
+
+    event::Manager::close();
+    event::Manager::set_sampling_rate(sampling_rate);
+    if (!tracing_enabled)
+    {
+        event::Manager::disable_event_tracing();
+    }
+
+    auto trace = read_trace(tmp_file);
+    file_util::remove_file(tmp_file);
+    ASSERT_TRUE(trace.is_array());
+    EXPECT_EQ(trace.size(), 4);
+}
@@ -2530,3 +2530,80 @@ TEST(constant_folding, constant_non_zero_3D)
     ASSERT_EQ(values_expected, values_out);
     ASSERT_EQ((Shape{3, 12}), new_const->get_shape());
 }
+
+TEST(constant_folding, parallel_independent_subgraphs)
+{
+    Shape shape{2, 3};
+    NodeVector outputs;
+    vector<vector<float>> expected;
+    for (size_t i = 0; i < 8; i++)
+    {
+        vector<float> values_a(shape_size(shape));
+        vector<float> values_b(shape_size(shape));
+        vector<float> values_out(shape_size(shape));
+        for (size_t j = 0; j < values_a.size(); j++)
+        {
+            values_a[j] = static_cast<float>(i + j);
+            values_b[j] = static_cast<float>(i * j);
+            values_out[j] = -values_a[j] * values_b[j] + values_a[j];
+        }
+        auto a = make_shared<op::Constant>(element::f32, shape, values_a);
+        auto b = make_shared<op::Constant>(element::f32, shape, values_b);
+        outputs.push_back(make_shared<op::Negative>(a) * b + a);
+        expected.push_back(values_out);
+    }
+    auto f = make_shared<Function>(outputs, ParameterVector{});
+
+    pass::Manager pass_manager;
+    auto constant_folding = pass_manager.register_pass<pass::ConstantFolding>();
+    constant_folding->set_num_threads(4);
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Negative>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Multiply>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Add>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), 8);
+
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        auto new_const = as_type_ptr<op::Constant>(f->get_results().at(i)->get_argument(0));
+        ASSERT_TRUE(new_const);
+        ASSERT_TRUE(test::all_close_f(
+            expected[i], new_const->get_vector<float>(), MIN_FLOAT_TOLERANCE_BITS));
+    }
+}
+
+TEST(constant_folding, partially_constant_subgraph)
+{
+    Shape shape{4};
+    vector<float> values_in{1, -2, 3, -4};
+    auto constant = make_shared<op::Constant>(element::f32, shape, values_in);
+    auto param = make_shared<op::Parameter>(element::f32, shape);
+    // The folded Negative is read both by a folded and by an unfoldable node
+    auto negative = make_shared<op::Negative>(constant);
+    auto add = param + negative;
+    auto multiply = negative * negative;
+    auto f = make_shared<Function>(NodeVector{add, multiply}, ParameterVector{param});
+
+    pass::Manager pass_manager;
+    auto constant_folding = pass_manager.register_pass<pass::ConstantFolding>();
+    constant_folding->set_num_threads(2);
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Negative>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Multiply>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Add>(f), 1);
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), 2);
+
+    auto add_const = as_type_ptr<op::Constant>(add->get_argument(1));
+    ASSERT_TRUE(add_const);
+    vector<float> values_negative{-1, 2, -3, 4};
+    ASSERT_TRUE(test::all_close_f(
+        values_negative, add_const->get_vector<float>(), MIN_FLOAT_TOLERANCE_BITS));
+
+    auto multiply_const = as_type_ptr<op::Constant>(f->get_results().at(1)->get_argument(0));
+    ASSERT_TRUE(multiply_const);
+    vector<float> values_square{1, 4, 9, 16};
+    ASSERT_TRUE(test::all_close_f(
+        values_square, multiply_const->get_vector<float>(), MIN_FLOAT_TOLERANCE_BITS));
+}
@@ -107,3 +107,33 @@ TEST(cpio, write)
         }
     }
 }
+
+TEST(cpio, write_aligned)
+{
+    const string test_file = "test_aligned.cpio";
+    string s1 = "this is a test";
+    string s2 = "the quick brown fox jumps over the lazy dog";
+    {
+        cpio::Writer writer(test_file);
+        writer.write("file1.txt", s1.data(), static_cast<uint32_t>(s1.size()));
+        writer.write("file2.txt", s2.data(), static_cast<uint32_t>(s2.size()), 64);
+        writer.write("file3.txt", s1.data(), static_cast<uint32_t>(s1.size()), 64);
+    }
+    {
+        // Padding records are not listed
+        cpio::Reader reader(test_file);
+        auto file_info = reader.get_file_info();
+        ASSERT_EQ(3, file_info.size());
+        EXPECT_EQ(file_info[0].get_name(), "file1.txt");
+        EXPECT_EQ(file_info[1].get_name(), "file2.txt");
+        EXPECT_EQ(file_info[2].get_name(), "file3.txt");
+        EXPECT_EQ(file_info[1].get_offset() % 64, 0);
+        EXPECT_EQ(file_info[2].get_offset() % 64, 0);
+
+        vector<char> data = reader.read(file_info[1]);
+        EXPECT_EQ(string(data.begin(), data.end()), s2);
+        data = reader.read(file_info[2]);
+        EXPECT_EQ(string(data.begin(), data.end()), s1);
+    }
+    file_util::remove_file(test_file);
+}
@@ -68,6 +68,7 @@
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
 #include "ngraph/runtime/cpu/op/deconv.hpp"
 #include "ngraph/runtime/cpu/op/dropout.hpp"
+#include "ngraph/runtime/cpu/op/fused_elementwise.hpp"
 #include "ngraph/runtime/cpu/op/gelu_backprop.hpp"
 #include "ngraph/runtime/cpu/op/group_conv_bias.hpp"
 #include "ngraph/runtime/cpu/op/leaky_relu.hpp"
@@ -2728,8 +2729,11 @@ TEST(cpu_fusion, MLIR_DISABLE_TEST(fuse_dropout))
         EXPECT_FALSE(test::all_close(fuse_results3.at(0), fuse_results4.at(0)));
         EXPECT_FALSE(test::all_close(fuse_results3.at(1), fuse_results4.at(1)));
 
-        // Note: Since the RNG used in Dropout kernel is different than RNG used in GenerateMask
-        // kernel, we can't compare fuse_results and nofuse_results
+        // Dropout draws its mask from the same generator as GenerateMask
+        auto nofuse_func2 = make_function(Shape{2, 2, 256, 256}, seed, 0.9, false, true);
+        auto nofuse_results = execute(nofuse_func2, args, "CPU");
+        EXPECT_TRUE(test::all_close(fuse_results.at(0), nofuse_results.at(0)));
+        EXPECT_TRUE(test::all_close(fuse_results.at(1), nofuse_results.at(1)));
     }
 }
 
@@ -3652,6 +3656,75 @@ TEST(cpu_quant_fusion, qconvba_q)
     ASSERT_EQ(count_ops_of_type<op::Quantize>(fuse), 6);
 }
 
+TEST(cpu_fusion, fuse_elementwise_chain)
+{
+    // 2400 elements span several loop blocks, the last one partial
+    Shape shape{8, 300};
+    auto make_function = [&]() {
+        auto x = make_shared<op::Parameter>(element::f32, shape);
+        auto w = make_shared<op::Parameter>(element::f32, shape);
+        auto b = make_shared<op::Parameter>(element::f32, Shape{shape[1]});
+        auto bias = make_shared<op::Broadcast>(b, shape, AxisSet{0});
+        auto hidden = make_shared<op::Tanh>(x * w + bias);
+        auto out = hidden * x;
+        // The intermediate is also read outside of the group
+        auto sum = make_shared<op::Sum>(hidden, AxisSet{1});
+        return make_shared<Function>(NodeVector{out, sum}, ParameterVector{x, w, b});
+    };
+
+    auto cpu_f = make_function();
+    auto int_f = make_function();
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+
+    ASSERT_EQ(count_ops_of_type<op::FusedElementwise>(cpu_f), 1);
+    ASSERT_EQ(count_ops_of_type<op::Tanh>(cpu_f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Broadcast>(cpu_f), 0);
+
+    // {g1, g2} reads Sin(h1) and {h1, h2} would read Sin(g1), so h2 cannot join h1's group
+    auto make_diamond = [&]() {
+        auto p1 = make_shared<op::Parameter>(element::f32, shape);
+        auto p2 = make_shared<op::Parameter>(element::f32, shape);
+        auto g1 = make_shared<op::Exp>(p1);
+        auto h1 = make_shared<op::Exp>(p2);
+        auto g2 = g1 + make_shared<op::Sin>(h1);
+        auto h2 = h1 + make_shared<op::Sin>(g1);
+        return make_shared<Function>(NodeVector{g2, h2}, ParameterVector{p1, p2});
+    };
+
+    auto cpu_diamond = make_diamond();
+    auto int_diamond = make_diamond();
+    vector<vector<float>> diamond_args;
+    for (shared_ptr<op::Parameter> param : int_diamond->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        diamond_args.push_back(tensor_val);
+    }
+    auto int_diamond_results = execute(int_diamond, diamond_args, "INTERPRETER");
+    auto cpu_diamond_results = execute(cpu_diamond, diamond_args, "CPU");
+    for (size_t i = 0; i < cpu_diamond_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(
+            cpu_diamond_results.at(i), int_diamond_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+
+    ASSERT_EQ(count_ops_of_type<op::FusedElementwise>(cpu_diamond), 1);
+    ASSERT_EQ(count_ops_of_type<op::Exp>(cpu_diamond), 1);
+}
+
 #ifndef NGRAPH_JSON_DISABLE
 // Tests that rely on deserializing json files
 TEST(cpu_fusion, fuse_conv_bias)
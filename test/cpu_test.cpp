@@ -15,10 +15,13 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <chrono>
+#include <condition_variable>
 #include <cstdio>
 #include <iostream>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <thread>
 
 #include "gtest/gtest.h"
@@ -40,6 +43,9 @@
 #include "ngraph/pass/visualize_tree.hpp"
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/cpu_inter_op_scheduler.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
@@ -184,6 +190,214 @@ TEST(cpu_test, abc_tbb)
 }
 #endif // NGRAPH_TBB_ENABLE
 
+TEST(cpu_test, inter_op_scheduler_ordering)
+{
+    // Diamond-shaped chains: every task depends on the two tasks before it
+    const size_t num_tasks = 64;
+    vector<vector<size_t>> successors(num_tasks);
+    vector<size_t> num_predecessors(num_tasks, 0);
+    for (size_t i = 0; i < num_tasks; i++)
+    {
+        for (size_t j = i + 1; j < num_tasks && j <= i + 2; j++)
+        {
+            successors[i].push_back(j);
+            num_predecessors[j]++;
+        }
+    }
+
+    runtime::cpu::executor::CPUInterOpScheduler scheduler(4);
+    vector<size_t> order;
+    mutex order_mutex;
+    scheduler.run(successors, num_predecessors, [&](size_t task, int worker) {
+        EXPECT_GE(worker, 0);
+        EXPECT_LT(worker, scheduler.get_num_workers());
+        lock_guard<mutex> lock(order_mutex);
+        order.push_back(task);
+    });
+
+    ASSERT_EQ(order.size(), num_tasks);
+    for (size_t i = 0; i < num_tasks; i++)
+    {
+        EXPECT_EQ(order[i], i);
+    }
+
+    EXPECT_THROW(scheduler.run(successors,
+                               num_predecessors,
+                               [](size_t task, int /* worker */) {
+                                   if (task == num_tasks / 2)
+                                   {
+                                       throw ngraph_error("task failed");
+                                   }
+                               }),
+                 ngraph_error);
+}
+
+TEST(cpu_test, inter_op_scheduler_wide_graph)
+{
+    bool use_scheduler = getenv_bool("NGRAPH_CPU_USE_INTER_OP_SCHEDULER");
+    if (!use_scheduler)
+    {
+        set_environment("NGRAPH_CPU_USE_INTER_OP_SCHEDULER", "1", 1);
+    }
+
+    // With a single worker the scheduler runs every task on the calling thread. The width is read
+    // when the function is compiled.
+    const char* parallelism = getenv("NGRAPH_INTER_OP_PARALLELISM");
+    bool has_parallelism = parallelism != nullptr;
+    string saved_parallelism = has_parallelism ? parallelism : "";
+    if (getenv_int("NGRAPH_INTER_OP_PARALLELISM") < 2)
+    {
+        set_environment("NGRAPH_INTER_OP_PARALLELISM", "2", 1);
+    }
+
+    // Independent branches joined at the end
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto branch0 = (A + B) * A;
+    auto branch1 = (A - B) * B;
+    auto branch2 = make_shared<op::Relu>(A * B);
+    auto branch3 = make_shared<op::Abs>(B - A) + A;
+    auto f = make_shared<Function>(NodeVector{(branch0 + branch1) * (branch2 + branch3), branch2},
+                                   ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    shared_ptr<runtime::Tensor> a = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> b = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> result0 = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> result1 = backend->create_tensor(element::f32, shape);
+
+    auto handle = backend->compile(f);
+
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{5, 6, -7, 8});
+    handle->call_with_validate({result0, result1}, {a, b});
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(result0),
+                                  vector<float>{-140, -144, -1066, 640}));
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(result1), vector<float>{5, 12, 0, 32}));
+
+    copy_data(a, vector<float>{-1, 0, 1, 2});
+    handle->call_with_validate({result0, result1}, {a, b});
+    EXPECT_TRUE(
+        test::all_close_f(read_vector<float>(result0), vector<float>{-170, -216, -558, -672}));
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(result1), vector<float>{0, 0, 0, 16}));
+
+    if (!use_scheduler)
+    {
+        unset_environment("NGRAPH_CPU_USE_INTER_OP_SCHEDULER");
+    }
+    if (has_parallelism)
+    {
+        set_environment("NGRAPH_INTER_OP_PARALLELISM", saved_parallelism.c_str(), 1);
+    }
+    else
+    {
+        unset_environment("NGRAPH_INTER_OP_PARALLELISM");
+    }
+}
+
+TEST(cpu_test, inter_op_scheduler_concurrency)
+{
+    // Two independent tasks that each wait for the other to start can only both finish if they
+    // run on different workers
+    runtime::cpu::executor::CPUInterOpScheduler scheduler(2);
+    ASSERT_EQ(scheduler.get_num_workers(), 2);
+
+    vector<vector<size_t>> successors(2);
+    vector<size_t> num_predecessors(2, 0);
+    mutex started_mutex;
+    condition_variable started_cv;
+    size_t started = 0;
+    bool concurrent = true;
+    scheduler.run(successors, num_predecessors, [&](size_t /* task */, int /* worker */) {
+        unique_lock<mutex> lock(started_mutex);
+        started++;
+        started_cv.notify_all();
+        if (!started_cv.wait_for(lock, chrono::seconds(10), [&]() { return started == 2; }))
+        {
+            concurrent = false;
+        }
+    });
+    EXPECT_TRUE(concurrent);
+}
+
+TEST(cpu_test, MLIR_DISABLE_TEST(inter_op_scheduler_mkldnn_scratchpad))
+{
+    // Independent convolutions share the MKLDNN scratchpad of the context, so the scheduler has
+    // to keep them from running at the same time
+    auto make_function = []() -> std::shared_ptr<Function> {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{2, 16, 28, 28});
+        auto B = make_shared<op::Parameter>(element::f32, Shape{2, 16, 28, 28});
+        auto W = make_shared<op::Parameter>(element::f32, Shape{32, 16, 3, 3});
+        auto V = make_shared<op::Parameter>(element::f32, Shape{32, 16, 3, 3});
+        auto conv0 = make_shared<op::Convolution>(A, W, Strides{1, 1}, Strides{1, 1});
+        auto conv1 = make_shared<op::Convolution>(B, V, Strides{1, 1}, Strides{1, 1});
+        return make_shared<Function>(NodeVector{conv0, conv1}, ParameterVector{A, B, W, V});
+    };
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : make_function()->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto sequential_results = execute(make_function(), args, "CPU");
+
+    bool use_scheduler = getenv_bool("NGRAPH_CPU_USE_INTER_OP_SCHEDULER");
+    if (!use_scheduler)
+    {
+        set_environment("NGRAPH_CPU_USE_INTER_OP_SCHEDULER", "1", 1);
+    }
+    const char* parallelism = getenv("NGRAPH_INTER_OP_PARALLELISM");
+    bool has_parallelism = parallelism != nullptr;
+    string saved_parallelism = has_parallelism ? parallelism : "";
+    if (getenv_int("NGRAPH_INTER_OP_PARALLELISM") < 2)
+    {
+        set_environment("NGRAPH_INTER_OP_PARALLELISM", "2", 1);
+    }
+
+    auto f = make_function();
+    auto backend = runtime::Backend::create("CPU");
+    vector<shared_ptr<runtime::Tensor>> arg_tensors;
+    for (size_t i = 0; i < args.size(); i++)
+    {
+        auto& param = f->get_parameters().at(i);
+        arg_tensors.push_back(
+            backend->create_tensor(param->get_element_type(), param->get_shape()));
+        copy_data(arg_tensors.back(), args.at(i));
+    }
+    vector<shared_ptr<runtime::Tensor>> result_tensors;
+    for (auto& result : f->get_results())
+    {
+        result_tensors.push_back(
+            backend->create_tensor(result->get_element_type(), result->get_shape()));
+    }
+    auto handle = backend->compile(f);
+    for (size_t call = 0; call < 10; call++)
+    {
+        handle->call_with_validate(result_tensors, arg_tensors);
+        for (size_t i = 0; i < result_tensors.size(); i++)
+        {
+            EXPECT_EQ(read_vector<float>(result_tensors.at(i)), sequential_results.at(i));
+        }
+    }
+
+    if (!use_scheduler)
+    {
+        unset_environment("NGRAPH_CPU_USE_INTER_OP_SCHEDULER");
+    }
+    if (has_parallelism)
+    {
+        set_environment("NGRAPH_INTER_OP_PARALLELISM", saved_parallelism.c_str(), 1);
+    }
+    else
+    {
+        unset_environment("NGRAPH_INTER_OP_PARALLELISM");
+    }
+}
+
 TEST(cpu_test, mkldnn_layouts)
 {
     Shape shape_a{1, 16, 2, 2};
@@ -1052,6 +1266,57 @@ TEST(cpu_test, thread_safe_calls_convolution_2d_2items)
     unset_environment("NGRAPH_CPU_CONCURRENCY");
 }
 
+TEST(cpu_test, thread_safe_calls_context_pool)
+{
+    if (is_codegen_mode())
+    {
+        // TODO change to skip when there is a new release of gtest
+        NGRAPH_WARN << "This test is skipped for CODEGEN mode.";
+        return;
+    }
+
+    // Runtime contexts are created on demand and never beyond NGRAPH_CPU_CONCURRENCY
+    size_t concurrency = min<size_t>(4, thread::hardware_concurrency());
+    set_environment("NGRAPH_CPU_CONCURRENCY", to_string(concurrency).c_str(), 1);
+
+    Shape shape{64};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Add>(A, B), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto handle = backend->compile(f);
+    auto cf = dynamic_pointer_cast<runtime::cpu::CPU_Executable>(handle)->get_call_frame();
+    EXPECT_EQ(cf->get_num_runtime_contexts(), 1);
+
+    auto make_calls = [&](float value) {
+        auto a = backend->create_tensor(element::f32, shape);
+        auto b = backend->create_tensor(element::f32, shape);
+        auto result = backend->create_tensor(element::f32, shape);
+        copy_data(a, vector<float>(shape_size(shape), value));
+        copy_data(b, vector<float>(shape_size(shape), 1.0f));
+        for (int i = 0; i < 100; i++)
+        {
+            handle->call_with_validate({result}, {a, b});
+            EXPECT_EQ(read_vector<float>(result), vector<float>(shape_size(shape), value + 1.0f));
+        }
+    };
+
+    vector<thread> threads;
+    for (int i = 0; i < 8; i++)
+    {
+        threads.emplace_back(make_calls, static_cast<float>(i));
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+    EXPECT_GE(cf->get_num_runtime_contexts(), 1);
+    EXPECT_LE(cf->get_num_runtime_contexts(), concurrency);
+
+    unset_environment("NGRAPH_CPU_CONCURRENCY");
+}
+
 // This test checks if a ConverLayout node is inserted before the ConvolutionBias node.
 // Since MLIR supports ConvolutionBias through callback, the data layout conversion is done in
 // callback.
@@ -2221,6 +2486,191 @@ TEST(cpu_test, MLIR_DISABLE_TEST(convolution_simple_bf16))
               read_vector<bfloat16>(result));
 }
 
+TEST(cpu_test, convert_half_precision_tail)
+{
+    // 37 elements exercise both the vector body and the scalar tail of the conversions
+    Shape shape{37};
+    vector<float> a_data(shape_size(shape));
+    for (size_t i = 0; i < a_data.size(); i++)
+    {
+        a_data[i] = (static_cast<float>(i) - 18.0f) * 0.3125f + 0.001f;
+    }
+
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto f16 = make_shared<op::Convert>(A, element::f16);
+    auto bf16 = make_shared<op::Convert>(A, element::bf16);
+    auto f = make_shared<Function>(
+        NodeVector{f16, make_shared<op::Convert>(f16, element::f32), bf16}, ParameterVector{A});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, a_data);
+    auto result_f16 = backend->create_tensor(element::f16, shape);
+    auto result_f32 = backend->create_tensor(element::f32, shape);
+    auto result_bf16 = backend->create_tensor(element::bf16, shape);
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result_f16, result_f32, result_bf16}, {a});
+
+    auto f16_values = read_vector<float16>(result_f16);
+    auto f32_values = read_vector<float>(result_f32);
+    auto bf16_values = read_vector<bfloat16>(result_bf16);
+    for (size_t i = 0; i < a_data.size(); i++)
+    {
+        EXPECT_EQ(float16(a_data[i]).to_bits(), f16_values[i].to_bits());
+        EXPECT_EQ(static_cast<float>(float16(a_data[i])), f32_values[i]);
+        EXPECT_NEAR(a_data[i], static_cast<float>(bf16_values[i]), 0.04f);
+    }
+}
+
+TEST(cpu_test, half_precision_compute)
+{
+    Shape shape_a{4, 8};
+    Shape shape_w{8, 3};
+    Shape shape_r{4, 3};
+    auto make_function = [&](element::Type type) {
+        auto A = make_shared<op::Parameter>(type, shape_a);
+        auto W = make_shared<op::Parameter>(type, shape_w);
+        auto B = make_shared<op::Parameter>(type, Shape{3});
+        auto dot = make_shared<op::Dot>(A, W);
+        auto bias = make_shared<op::Broadcast>(B, shape_r, AxisSet{0});
+        auto softmax = make_shared<op::Softmax>(make_shared<op::Add>(dot, bias), AxisSet{1});
+        auto sum = make_shared<op::Sum>(make_shared<op::Tanh>(dot), AxisSet{0});
+        return make_shared<Function>(NodeVector{softmax, sum}, ParameterVector{A, W, B});
+    };
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (auto& shape : {shape_a, shape_w, Shape{3}})
+    {
+        vector<float> arg(shape_size(shape));
+        rng.initialize(arg);
+        // Start from values that both half precision types represent exactly
+        for (auto& value : arg)
+        {
+            value = static_cast<float>(bfloat16(static_cast<float>(float16(value))));
+        }
+        args.push_back(arg);
+    }
+
+    auto backend = runtime::Backend::create("CPU");
+    auto run = [&](element::Type type) {
+        auto make_tensor = [&](const Shape& shape, const vector<float>& values) {
+            auto tensor = backend->create_tensor(type, shape);
+            if (type == element::f16)
+            {
+                copy_data(tensor, vector<float16>(values.begin(), values.end()));
+            }
+            else if (type == element::bf16)
+            {
+                copy_data(tensor, vector<bfloat16>(values.begin(), values.end()));
+            }
+            else
+            {
+                copy_data(tensor, values);
+            }
+            return tensor;
+        };
+        auto read_floats = [&](const shared_ptr<runtime::Tensor>& tensor) {
+            if (type == element::f16)
+            {
+                auto values = read_vector<float16>(tensor);
+                return vector<float>(values.begin(), values.end());
+            }
+            else if (type == element::bf16)
+            {
+                auto values = read_vector<bfloat16>(tensor);
+                return vector<float>(values.begin(), values.end());
+            }
+            return read_vector<float>(tensor);
+        };
+
+        auto softmax = backend->create_tensor(type, shape_r);
+        auto sum = backend->create_tensor(type, Shape{3});
+        auto handle = backend->compile(make_function(type));
+        handle->call_with_validate({softmax, sum},
+                                   {make_tensor(shape_a, args[0]),
+                                    make_tensor(shape_w, args[1]),
+                                    make_tensor(Shape{3}, args[2])});
+        return make_pair(read_floats(softmax), read_floats(sum));
+    };
+
+    auto expected = run(element::f32);
+    auto f16_results = run(element::f16);
+    auto bf16_results = run(element::bf16);
+    EXPECT_TRUE(test::all_close(expected.first, f16_results.first, 0.01f, 0.01f));
+    EXPECT_TRUE(test::all_close(expected.second, f16_results.second, 0.01f, 0.01f));
+    EXPECT_TRUE(test::all_close(expected.first, bf16_results.first, 0.05f, 0.05f));
+    EXPECT_TRUE(test::all_close(expected.second, bf16_results.second, 0.05f, 0.05f));
+}
+
+TEST(cpu_test, half_precision_activations)
+{
+    Shape shape_a{3, 5};
+    Shape shape_w{5, 4};
+    Shape shape_v{4, 2};
+    auto A = make_shared<op::Parameter>(element::f16, shape_a);
+    auto W = make_shared<op::Parameter>(element::f16, shape_w);
+    auto V = make_shared<op::Parameter>(element::f16, shape_v);
+    auto relu = make_shared<op::Relu>(make_shared<op::Dot>(A, W));
+    auto sum = make_shared<op::Sum>(make_shared<op::Dot>(relu, V), AxisSet{1});
+    auto f = make_shared<Function>(NodeVector{sum}, ParameterVector{A, W, V});
+
+    // Small multiples of 0.5, so every intermediate value is exact in f16
+    vector<float> a_data(shape_size(shape_a));
+    vector<float> w_data(shape_size(shape_w));
+    vector<float> v_data(shape_size(shape_v));
+    for (size_t i = 0; i < a_data.size(); i++)
+    {
+        a_data[i] = static_cast<float>(i % 5) - 2.0f;
+    }
+    for (size_t i = 0; i < w_data.size(); i++)
+    {
+        w_data[i] = static_cast<float>(i % 3) * 0.5f - 0.5f;
+    }
+    for (size_t i = 0; i < v_data.size(); i++)
+    {
+        v_data[i] = static_cast<float>(i % 4) - 1.0f;
+    }
+
+    auto backend = runtime::Backend::create("CPU");
+    auto a = backend->create_tensor(element::f16, shape_a);
+    auto w = backend->create_tensor(element::f16, shape_w);
+    auto v = backend->create_tensor(element::f16, shape_v);
+    copy_data(a, vector<float16>(a_data.begin(), a_data.end()));
+    copy_data(w, vector<float16>(w_data.begin(), w_data.end()));
+    copy_data(v, vector<float16>(v_data.begin(), v_data.end()));
+    auto result = backend->create_tensor(element::f16, Shape{3});
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, w, v});
+
+    // Dot, Relu and Sum run on f16 tensors, so no value of the compiled function is widened
+    EXPECT_EQ(count_ops_of_type<op::Convert>(f), 0);
+    for (auto& node : f->get_ordered_ops())
+    {
+        for (auto& output : node->outputs())
+        {
+            EXPECT_EQ(output.get_element_type(), element::f16) << node->get_name();
+        }
+    }
+
+    vector<float> expected(3, 0.0f);
+    for (size_t i = 0; i < 3; i++)
+    {
+        for (size_t j = 0; j < 4; j++)
+        {
+            float hidden = 0;
+            for (size_t k = 0; k < 5; k++)
+            {
+                hidden += a_data[i * 5 + k] * w_data[k * 4 + j];
+            }
+            hidden = std::max(hidden, 0.0f);
+            expected[i] += hidden * (v_data[j * 2] + v_data[j * 2 + 1]);
+        }
+    }
+    auto values = read_vector<float16>(result);
+    EXPECT_EQ(expected, vector<float>(values.begin(), values.end()));
+}
+
 // This tests a backend's implementation of the three parameter version of create_tensor
 // Testing using this tensor as a Function input
 TEST(cpu_test, create_tensor_2_input)
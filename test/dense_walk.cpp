@@ -0,0 +1,211 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/dense_walk.hpp"
+#include "ngraph/runtime/reference/dot.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// (offset, projected offset) of every element, as a CoordinateTransform walk produces them
+static vector<pair<size_t, size_t>> projected_offsets(const Shape& shape, const AxisSet& axes)
+{
+    Shape projected_shape;
+    for (size_t axis = 0; axis < shape.size(); axis++)
+    {
+        if (axes.count(axis) == 0)
+        {
+            projected_shape.push_back(shape[axis]);
+        }
+    }
+    vector<pair<size_t, size_t>> offsets;
+    if (shape_size(shape) == 0)
+    {
+        return offsets;
+    }
+    CoordinateTransform transform(shape);
+    CoordinateTransform projected_transform(projected_shape);
+    for (const Coordinate& coord : transform)
+    {
+        Coordinate projected_coord;
+        for (size_t axis = 0; axis < shape.size(); axis++)
+        {
+            if (axes.count(axis) == 0)
+            {
+                projected_coord.push_back(coord[axis]);
+            }
+        }
+        offsets.push_back({transform.index(coord), projected_transform.index(projected_coord)});
+    }
+    return offsets;
+}
+
+static vector<pair<size_t, size_t>> walked_offsets(const Shape& shape, const AxisSet& axes)
+{
+    vector<pair<size_t, size_t>> offsets;
+    runtime::reference::for_each_projected_run(
+        shape,
+        axes,
+        [&](size_t offset, size_t projected_offset, size_t count, size_t projected_step) {
+            EXPECT_TRUE(projected_step == 0 || projected_step == 1);
+            for (size_t i = 0; i < count; i++)
+            {
+                offsets.push_back({offset + i, projected_offset + i * projected_step});
+            }
+        });
+    return offsets;
+}
+
+TEST(dense_walk, projected_run_reduced_axes)
+{
+    Shape shape{2, 3, 4, 5};
+    vector<AxisSet> axis_sets{{}, {0}, {3}, {1, 2}, {0, 2}, {1, 3}, {0, 1, 2, 3}};
+    for (const AxisSet& axes : axis_sets)
+    {
+        EXPECT_EQ(walked_offsets(shape, axes), projected_offsets(shape, axes)) << "axes " << axes;
+    }
+}
+
+TEST(dense_walk, projected_run_size_1_axes)
+{
+    // Axes of length 1 move neither offset, whether they are removed or not
+    Shape shape{1, 3, 1, 2, 1};
+    vector<AxisSet> axis_sets{{}, {0}, {4}, {0, 2, 4}, {1, 2}, {2, 3}, {0, 1, 2, 3, 4}};
+    for (const AxisSet& axes : axis_sets)
+    {
+        EXPECT_EQ(walked_offsets(shape, axes), projected_offsets(shape, axes)) << "axes " << axes;
+    }
+
+    EXPECT_EQ(walked_offsets(Shape{1, 1}, AxisSet{1}), (vector<pair<size_t, size_t>>{{0, 0}}));
+    EXPECT_EQ(walked_offsets(Shape{}, AxisSet{}), (vector<pair<size_t, size_t>>{{0, 0}}));
+    EXPECT_TRUE(walked_offsets(Shape{2, 0, 3}, AxisSet{1}).empty());
+}
+
+TEST(dense_walk, window_negative_padding_and_dilation)
+{
+    Shape in_shape{7, 6};
+    Shape window_shape{3, 2};
+    Strides movement_strides{2, 1};
+    Strides window_dilation{2, 3};
+    for (const CoordinateDiff& pad_below : {CoordinateDiff{0, 0},
+                                            CoordinateDiff{-1, 2},
+                                            CoordinateDiff{2, -2},
+                                            CoordinateDiff{-3, -1}})
+    {
+        runtime::reference::DenseWindow window(
+            in_shape, window_shape, movement_strides, window_dilation, pad_below);
+        for (const Coordinate& out_coord : CoordinateTransform(Shape{4, 6}))
+        {
+            // Taps inside the unpadded input, in row-major window order
+            vector<pair<size_t, size_t>> expected;
+            CoordinateTransform window_transform(window_shape);
+            for (const Coordinate& tap : window_transform)
+            {
+                size_t in_offset = 0;
+                bool inside = true;
+                for (size_t i = 0; i < in_shape.size(); i++)
+                {
+                    int64_t in_coord = static_cast<int64_t>(out_coord[i] * movement_strides[i]) -
+                                       pad_below[i] +
+                                       static_cast<int64_t>(tap[i] * window_dilation[i]);
+                    inside = inside && in_coord >= 0 &&
+                             in_coord < static_cast<int64_t>(in_shape[i]);
+                    in_offset = in_offset * in_shape[i] + static_cast<size_t>(in_coord);
+                }
+                if (inside)
+                {
+                    expected.push_back({in_offset, window_transform.index(tap)});
+                }
+            }
+
+            EXPECT_EQ(window.place(vector<size_t>(out_coord.begin(), out_coord.end())),
+                      expected.size());
+            vector<pair<size_t, size_t>> visited;
+            window.for_each([&](size_t in_offset, size_t window_offset) {
+                visited.push_back({in_offset, window_offset});
+            });
+            EXPECT_EQ(visited, expected) << "pad_below " << pad_below << " out " << out_coord;
+        }
+    }
+}
+
+TEST(dense_walk, dot_blocked_matches_reference_loop)
+{
+    // Column counts above the block size of 64 split the output into several blocks
+    struct Case
+    {
+        Shape arg0_shape;
+        Shape arg1_shape;
+        size_t reduction_axes_count;
+    };
+    for (const Case& c : {Case{{3, 5}, {5, 70}, 1},
+                          Case{{2, 2, 3}, {2, 3, 130}, 2},
+                          Case{{4}, {3}, 0},
+                          Case{{2, 3}, {3}, 1},
+                          Case{{6}, {6, 65}, 1}})
+    {
+        Shape out_shape(c.arg0_shape.begin(), c.arg0_shape.end() - c.reduction_axes_count);
+        out_shape.insert(
+            out_shape.end(), c.arg1_shape.begin() + c.reduction_axes_count, c.arg1_shape.end());
+        vector<float> arg0(shape_size(c.arg0_shape));
+        vector<float> arg1(shape_size(c.arg1_shape));
+        for (size_t i = 0; i < arg0.size(); i++)
+        {
+            arg0[i] = static_cast<float>(sin(0.37 * i + 0.1));
+        }
+        for (size_t i = 0; i < arg1.size(); i++)
+        {
+            arg1[i] = static_cast<float>(cos(0.91 * i) / 3);
+        }
+
+        vector<float> out(shape_size(out_shape));
+        runtime::reference::dot(arg0.data(),
+                                arg1.data(),
+                                out.data(),
+                                c.arg0_shape,
+                                c.arg1_shape,
+                                out_shape,
+                                c.reduction_axes_count);
+
+        // The loop the kernel used before: one double sum per output in ascending K order
+        size_t k_size = shape_size(
+            Shape(c.arg1_shape.begin(), c.arg1_shape.begin() + c.reduction_axes_count));
+        size_t n_size = shape_size(
+            Shape(c.arg1_shape.begin() + c.reduction_axes_count, c.arg1_shape.end()));
+        size_t m_size = out.size() / n_size;
+        for (size_t m = 0; m < m_size; m++)
+        {
+            for (size_t n = 0; n < n_size; n++)
+            {
+                double sum = 0;
+                for (size_t k = 0; k < k_size; k++)
+                {
+                    sum += static_cast<double>(arg0[m * k_size + k]) *
+                           static_cast<double>(arg1[k * n_size + n]);
+                }
+                EXPECT_EQ(out[m * n_size + n], static_cast<float>(sum))
+                    << "arg1 shape " << c.arg1_shape << " at " << m << ", " << n;
+            }
+        }
+    }
+}
@@ -0,0 +1,139 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "ngraph/file_util.hpp"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/executable_cache.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static shared_ptr<Function> make_conv_function(float bias_value, size_t stride)
+{
+    auto data = make_shared<op::Parameter>(element::f32, Shape{1, 1, 8, 8});
+    auto filters = make_shared<op::Parameter>(element::f32, Shape{1, 1, 3, 3});
+    auto bias = op::Constant::create(element::f32, Shape{}, {bias_value});
+    auto conv = make_shared<op::v1::Convolution>(data,
+                                                 filters,
+                                                 Strides{stride, stride},
+                                                 CoordinateDiff{0, 0},
+                                                 CoordinateDiff{0, 0},
+                                                 Strides{1, 1});
+    auto broadcast = make_shared<op::Broadcast>(bias, conv->get_shape(), AxisSet{0, 1, 2, 3});
+    return make_shared<Function>(conv + broadcast, ParameterVector{data, filters});
+}
+
+TEST(executable_cache, key_ignores_node_names)
+{
+    pass::PassConfig pass_config;
+    auto key = runtime::ExecutableCache::compute_key(make_conv_function(1, 1), pass_config, "A");
+    ASSERT_FALSE(key.empty());
+    EXPECT_EQ(key,
+              runtime::ExecutableCache::compute_key(make_conv_function(1, 1), pass_config, "A"));
+}
+
+TEST(executable_cache, key_covers_compilation_inputs)
+{
+    pass::PassConfig pass_config;
+    auto key = runtime::ExecutableCache::compute_key(make_conv_function(1, 1), pass_config, "A");
+
+    // Constant values
+    EXPECT_NE(key,
+              runtime::ExecutableCache::compute_key(make_conv_function(2, 1), pass_config, "A"));
+    // Attributes
+    EXPECT_NE(key,
+              runtime::ExecutableCache::compute_key(make_conv_function(1, 2), pass_config, "A"));
+    // Backend
+    EXPECT_NE(key,
+              runtime::ExecutableCache::compute_key(make_conv_function(1, 1), pass_config, "B"));
+    // Pass configuration
+    pass::PassConfig other_pass_config;
+    other_pass_config.set_pass_enable("ReshapeElimination", false);
+    EXPECT_NE(
+        key,
+        runtime::ExecutableCache::compute_key(make_conv_function(1, 1), other_pass_config, "A"));
+}
+
+TEST(executable_cache, key_requires_visitable_attributes)
+{
+    // Dot does not expose its reduction axes count, so a key could miss a difference
+    auto a = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto b = make_shared<op::Parameter>(element::f32, Shape{3, 4});
+    auto dot = make_shared<op::Dot>(a, b, 1);
+    auto f = make_shared<Function>(dot, ParameterVector{a, b});
+
+    EXPECT_TRUE(runtime::ExecutableCache::compute_key(f, pass::PassConfig(), "A").empty());
+}
+
+TEST(executable_cache, key_is_sha256)
+{
+    EXPECT_EQ(runtime::ExecutableCache::compute_key(""),
+              "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+    EXPECT_EQ(runtime::ExecutableCache::compute_key("abc"),
+              "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+    // Spans two blocks
+    EXPECT_EQ(runtime::ExecutableCache::compute_key(
+                  "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq"),
+              "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+}
+
+TEST(executable_cache, read_write)
+{
+    string directory = file_util::path_join(file_util::get_temp_directory_path(),
+                                            "ngraph_executable_cache_read_write");
+    file_util::remove_directory(directory);
+    runtime::ExecutableCache cache(directory);
+
+    string key = runtime::ExecutableCache::compute_key("some source");
+    string data;
+    EXPECT_FALSE(cache.read(key, data));
+
+    string entry("compiled\0bytes", 14);
+    ASSERT_TRUE(cache.write(key, entry));
+    ASSERT_TRUE(cache.read(key, data));
+    EXPECT_EQ(data, entry);
+
+    cache.remove(key);
+    EXPECT_FALSE(cache.read(key, data));
+    file_util::remove_directory(directory);
+}
+
+TEST(executable_cache, evicts_least_recently_used)
+{
+    string directory = file_util::path_join(file_util::get_temp_directory_path(),
+                                            "ngraph_executable_cache_evict");
+    file_util::remove_directory(directory);
+    runtime::ExecutableCache cache(directory, 250);
+    EXPECT_EQ(cache.get_max_bytes(), uint64_t(250));
+
+    string entry(100, 'x');
+    string key_a = runtime::ExecutableCache::compute_key("a");
+    string key_b = runtime::ExecutableCache::compute_key("b");
+    string key_c = runtime::ExecutableCache::compute_key("c");
+    ASSERT_TRUE(cache.write(key_a, entry));
+    ASSERT_TRUE(cache.write(key_b, entry));
+    ASSERT_TRUE(cache.write(key_c, entry));
+
+    // The entry just written is kept, one older entry makes room for it
+    string data;
+    EXPECT_TRUE(cache.read(key_c, data));
+    EXPECT_NE(cache.read(key_a, data), cache.read(key_b, data));
+    file_util::remove_directory(directory);
+}
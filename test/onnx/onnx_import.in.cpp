@@ -187,6 +187,40 @@ NGRAPH_TEST(onnx_${BACKEND_NAME}, model_add_abc_initializers)
     test_case.run();
 }
 
+NGRAPH_TEST(onnx_${BACKEND_NAME}, model_external_data)
+{
+    // A is mapped from the data file, B is at an unaligned offset and gets copied
+    auto function = onnx_import::import_onnx_model(
+        file_util::path_join(SERIALIZED_ZOO, "onnx/external_data.prototxt"));
+
+    auto test_case = ngraph::test::NgraphTestCase(function, "${BACKEND_NAME}");
+    test_case.add_input<float>({1, 2, 3, 4});
+    test_case.add_expected_output<float>({7, 10, 13, 16});
+    test_case.run();
+}
+
+NGRAPH_TEST(onnx_${BACKEND_NAME}, model_external_data_outside_model_dir)
+{
+    // The data file exists at ../onnx/external_data.bin, but a location may not leave the
+    // model directory
+    EXPECT_THROW(onnx_import::import_onnx_model(file_util::path_join(
+                     SERIALIZED_ZOO, "onnx/external_data_outside_model_dir.prototxt")),
+                 ngraph_error);
+}
+
+NGRAPH_TEST(onnx_${BACKEND_NAME}, model_initializer_storage)
+{
+    // A is stored in float_data and B in raw_data, both are released from the proto once their
+    // constants are made
+    auto function = onnx_import::import_onnx_model(
+        file_util::path_join(SERIALIZED_ZOO, "onnx/initializer_storage.prototxt"));
+
+    auto test_case = ngraph::test::NgraphTestCase(function, "${BACKEND_NAME}");
+    test_case.add_input<float>({1, 2, 3, 4});
+    test_case.add_expected_output<float>({7, 10, 13, 16});
+    test_case.run();
+}
+
 NGRAPH_TEST(onnx_${BACKEND_NAME}, model_override_op)
 {
     onnx_import::register_operator(
@@ -48,16 +48,16 @@ TEST(liveness, constant)
     auto tmp = f->get_ordered_ops();
     vector<shared_ptr<Node>> sorted{tmp.begin(), tmp.end()};
     ASSERT_EQ(3, sorted.size());
-    EXPECT_EQ(0, sorted[0]->liveness_new_list.size());
-    EXPECT_EQ(0, sorted[0]->liveness_free_list.size());
+    EXPECT_EQ(0, sorted[0]->get_liveness_new_list().size());
+    EXPECT_EQ(0, sorted[0]->get_liveness_free_list().size());
 
     // op::Negative is live on output to op::Result
     // op::Negative is new
-    EXPECT_EQ(1, sorted[1]->liveness_new_list.size());
-    EXPECT_EQ(0, sorted[1]->liveness_free_list.size());
+    EXPECT_EQ(1, sorted[1]->get_liveness_new_list().size());
+    EXPECT_EQ(0, sorted[1]->get_liveness_free_list().size());
 
     // op::Negative is live on input to op::Result
-    EXPECT_EQ(0, sorted[2]->liveness_new_list.size());
+    EXPECT_EQ(0, sorted[2]->get_liveness_new_list().size());
     // op::Negative is freed
-    EXPECT_EQ(1, sorted[2]->liveness_free_list.size());
+    EXPECT_EQ(1, sorted[2]->get_liveness_free_list().size());
 }
@@ -23,7 +23,9 @@
 
 #include "ngraph/graph_util.hpp"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/pattern/op/label.hpp"
 #include "util/test_tools.hpp"
 
 using namespace ngraph;
@@ -67,3 +69,149 @@ TEST(pass_manager, serialize_with_revalidate_does_not_crash)
     auto graph = make_test_graph();
     pass_manager.run_passes(graph);
 }
+
+namespace
+{
+    class DoubleNegativeElimination : public pass::GraphRewrite
+    {
+    public:
+        DoubleNegativeElimination()
+            : GraphRewrite()
+        {
+            auto x = make_shared<pattern::op::Label>(element::f32, Shape{2});
+            auto pattern = make_shared<op::Negative>(make_shared<op::Negative>(x));
+            auto callback = [x](pattern::Matcher& m) {
+                replace_node(m.get_match_root(), m.get_pattern_map()[x]);
+                return true;
+            };
+            add_matcher(make_shared<pattern::Matcher>(pattern, "double_negative"), callback);
+        }
+    };
+}
+
+TEST(pass_manager, pass_profile)
+{
+    auto p = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto graph = make_shared<op::Abs>(make_shared<op::Negative>(make_shared<op::Negative>(p)));
+    auto f = make_shared<Function>(graph, ParameterVector{p});
+
+    pass::Manager pass_manager;
+    pass_manager.set_per_pass_validation(false);
+    pass_manager.set_pass_profiling(true);
+    pass_manager.register_pass<DoubleNegativeElimination>();
+    pass_manager.run_passes(f);
+
+    auto& profile = pass_manager.get_pass_profile();
+    ASSERT_EQ(profile.size(), 1);
+    EXPECT_NE(profile[0].name.find("DoubleNegativeElimination"), string::npos);
+    EXPECT_EQ(profile[0].nodes_before, 5);
+    EXPECT_EQ(profile[0].nodes_after, 3);
+    ASSERT_EQ(profile[0].matchers.size(), 1);
+    auto& matcher = profile[0].matchers[0];
+    EXPECT_EQ(matcher.name, "double_negative");
+    // Only the outer Negative has a Negative argument, so it is the only node offered to the
+    // matcher
+    EXPECT_EQ(matcher.attempts, 1);
+    EXPECT_EQ(matcher.matches, 1);
+    EXPECT_EQ(matcher.callbacks, 1);
+
+    stringstream json;
+    pass::write_json(json, f->get_name(), 0, profile);
+    EXPECT_NE(json.str().find("\"nodes_before\":5,\"nodes_after\":3"), string::npos);
+    EXPECT_NE(json.str().find("\"name\":\"double_negative\",\"attempts\":1"), string::npos);
+
+    pass_manager.set_pass_profiling(false);
+    pass_manager.run_passes(f);
+    EXPECT_TRUE(pass_manager.get_pass_profile().empty());
+}
+
+TEST(pass_manager, incremental_validation)
+{
+    auto p = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto neg = make_shared<op::Negative>(p);
+    auto abs = make_shared<op::Abs>(neg);
+    auto f = make_shared<Function>(abs, ParameterVector{p});
+    EXPECT_FALSE(neg->get_needs_validation());
+
+    // Output type changes are propagated to the users of the changed node
+    p->set_partial_shape(PartialShape{3});
+    EXPECT_TRUE(p->get_needs_validation());
+    EXPECT_FALSE(neg->get_needs_validation());
+    f->validate_changed_nodes_and_infer_types();
+    EXPECT_EQ(abs->get_shape(), Shape{3});
+    EXPECT_EQ(f->get_output_shape(0), Shape{3});
+    for (auto& node : f->get_ops())
+    {
+        EXPECT_FALSE(node->get_needs_validation());
+    }
+
+    // Nothing changed, nothing to do
+    auto change_count = Node::get_change_count();
+    f->validate_changed_nodes_and_infer_types();
+    EXPECT_EQ(Node::get_change_count(), change_count);
+
+    // Replacing an input marks its node
+    auto convert = make_shared<op::Convert>(p, element::f64);
+    neg->input(0).replace_source_output(convert);
+    EXPECT_TRUE(neg->get_needs_validation());
+    f->validate_changed_nodes_and_infer_types();
+    EXPECT_EQ(f->get_output_element_type(0), element::f64);
+
+    // Changes to other functions are left to their own validation
+    auto other_p = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto other_neg = make_shared<op::Negative>(other_p);
+    auto other_f = make_shared<Function>(other_neg, ParameterVector{other_p});
+    other_p->set_partial_shape(PartialShape{4});
+    f->validate_changed_nodes_and_infer_types();
+    EXPECT_TRUE(other_p->get_needs_validation());
+    other_f->validate_changed_nodes_and_infer_types();
+    EXPECT_EQ(other_neg->get_shape(), Shape{4});
+
+    // Functions sharing a parameter only take the changed nodes they use
+    auto shared_abs = make_shared<op::Abs>(other_p);
+    auto shared_f = make_shared<Function>(shared_abs, ParameterVector{other_p});
+    shared_abs->set_needs_validation();
+    other_f->validate_changed_nodes_and_infer_types();
+    EXPECT_TRUE(shared_abs->get_needs_validation());
+    shared_f->validate_changed_nodes_and_infer_types();
+    EXPECT_FALSE(shared_abs->get_needs_validation());
+
+    auto undeclared = make_shared<op::Parameter>(element::f64, Shape{3});
+    abs->input(0).replace_source_output(undeclared);
+    EXPECT_THROW(f->validate_changed_nodes_and_infer_types(), ngraph_error);
+}
+
+namespace
+{
+    class InsertConvert : public pass::FunctionPass
+    {
+    public:
+        bool run_on_function(std::shared_ptr<ngraph::Function> f) override
+        {
+            auto p = f->get_parameters().at(0);
+            auto convert = make_shared<op::Convert>(p, element::f64);
+            for (auto& input : p->output(0).get_target_inputs())
+            {
+                if (input.get_node() != convert.get())
+                {
+                    input.replace_source_output(convert);
+                }
+            }
+            return true;
+        }
+    };
+}
+
+TEST(pass_manager, incremental_per_pass_validation)
+{
+    auto p = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto f = make_shared<Function>(make_shared<op::Abs>(make_shared<op::Negative>(p)),
+                                   ParameterVector{p});
+
+    pass::Manager pass_manager;
+    pass_manager.set_incremental_validation(true);
+    pass_manager.register_pass<InsertConvert>();
+    pass_manager.register_pass<DummyPass>();
+    pass_manager.run_passes(f);
+    EXPECT_EQ(f->get_output_element_type(0), element::f64);
+}
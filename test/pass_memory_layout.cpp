@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <chrono>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -232,3 +233,98 @@ TEST(memory_layout, constant)
     size_t temporary_pool_size = f->get_temporary_pool_size();
     EXPECT_EQ(4, temporary_pool_size);
 }
+
+TEST(memory_layout, report)
+{
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Liveness>();
+    auto memory_layout =
+        pass_manager.register_pass<pass::MemoryLayout>(1, false, chrono::seconds(1));
+
+    auto graph = make_test_graph();
+    pass_manager.run_passes(graph);
+    auto& report = memory_layout->get_report();
+    EXPECT_EQ(graph->get_temporary_pool_size(), report.peak);
+    EXPECT_GE(report.peak, report.lower_bound);
+    EXPECT_GE(report.heuristics_tried, 1);
+    EXPECT_FALSE(report.heuristic.empty());
+}
+
+TEST(static_memory_planner, beats_first_fit)
+{
+    // First fit in execution order puts c above b because the hole a leaves is too small,
+    // placing the largest buffer first reaches the lower bound
+    pass::StaticMemoryPlanner planner{1};
+    auto a = planner.add_buffer(10, 0);
+    auto b = planner.add_buffer(10, 0);
+    auto c = planner.add_buffer(20, 1);
+    planner.set_last_use(a, 0);
+    planner.set_last_use(b, 3);
+    planner.set_last_use(c, 2);
+    planner.plan();
+
+    EXPECT_EQ(30, planner.max_allocated());
+    EXPECT_EQ(30, planner.get_report().lower_bound);
+    EXPECT_EQ(0, planner.get_offset(c));
+    EXPECT_EQ(20, planner.get_offset(b));
+    EXPECT_EQ(0, planner.get_offset(a));
+}
+
+TEST(static_memory_planner, disjoint_when_live_together)
+{
+    // A time budget only cuts the search short, the plan must still be valid
+    for (auto budget : {chrono::microseconds::zero(), chrono::microseconds(1)})
+    {
+        pass::StaticMemoryPlanner planner{64, budget};
+        vector<size_t> first_use;
+        vector<size_t> last_use;
+        vector<size_t> sizes;
+        for (size_t i = 0; i < 200; i++)
+        {
+            first_use.push_back(i / 2);
+            last_use.push_back(i / 2 + (i * 7) % 13);
+            sizes.push_back((i * 37) % 1000);
+            planner.add_buffer(sizes.back(), first_use.back());
+            planner.set_last_use(i, last_use.back());
+        }
+        planner.plan();
+
+        auto& report = planner.get_report();
+        EXPECT_GE(report.peak, report.lower_bound);
+        EXPECT_GE(report.heuristics_tried, 1);
+        EXPECT_GE(report.mean_fragmentation, 0);
+        EXPECT_LE(report.mean_fragmentation, report.max_fragmentation);
+        EXPECT_LT(report.max_fragmentation, 1);
+        for (size_t i = 0; i < sizes.size(); i++)
+        {
+            size_t size_i = pass::MemoryManager::align(sizes[i], 64);
+            EXPECT_EQ(0, planner.get_offset(i) % 64);
+            EXPECT_LE(planner.get_offset(i) + size_i, planner.max_allocated());
+            for (size_t j = i + 1; j < sizes.size(); j++)
+            {
+                if (first_use[i] <= last_use[j] && first_use[j] <= last_use[i])
+                {
+                    size_t size_j = pass::MemoryManager::align(sizes[j], 64);
+                    EXPECT_TRUE(planner.get_offset(i) + size_i <= planner.get_offset(j) ||
+                                planner.get_offset(j) + size_j <= planner.get_offset(i))
+                        << "buffers " << i << " and " << j << " overlap";
+                }
+            }
+        }
+    }
+}
+
+TEST(static_memory_planner, no_reuse_without_last_use)
+{
+    pass::StaticMemoryPlanner planner{8};
+    auto a = planner.add_buffer(3, 0);
+    auto b = planner.add_buffer(0, 5);
+    planner.plan();
+
+    // Zero sized buffers take one alignment unit like MemoryManager
+    EXPECT_EQ(16, planner.max_allocated());
+    EXPECT_EQ("no_reuse", planner.get_report().heuristic);
+    EXPECT_NE(planner.get_offset(a), planner.get_offset(b));
+    EXPECT_THROW(planner.set_last_use(b, 4), runtime_error);
+    EXPECT_THROW(planner.get_offset(2), runtime_error);
+}
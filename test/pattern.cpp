@@ -37,6 +37,7 @@
 #include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pattern/matcher.hpp"
+#include "ngraph/pattern/matcher_index.hpp"
 #include "ngraph/pattern/op/branch.hpp"
 #include "ngraph/pattern/op/label.hpp"
 #include "ngraph/pattern/op/or.hpp"
@@ -295,6 +296,135 @@ TEST(pattern, graph_rewrite)
     }
 }
 
+TEST(pattern, graph_rewrite_registration_order)
+{
+    // Matchers rooted at a pattern op and matchers rooted at a concrete op are dispatched
+    // separately, the first registered matcher that succeeds must still win
+    Shape shape{};
+    auto a = make_shared<op::Parameter>(element::i32, shape);
+    auto b = make_shared<op::Parameter>(element::i32, shape);
+    auto sum = a + b;
+    auto product = sum * b;
+    auto f = make_shared<Function>(product, ParameterVector{a, b});
+
+    auto is_add = [](shared_ptr<Node> n) { return is_type<op::Add>(n); };
+    auto any_add = make_shared<pattern::op::Label>(element::i32, shape, is_add);
+    auto label_a = make_shared<pattern::op::Label>(element::i32, shape);
+    auto label_b = make_shared<pattern::op::Label>(element::i32, shape);
+
+    vector<string> fired;
+    auto record = [&fired](const string& name) {
+        return [&fired, name](pattern::Matcher& m) {
+            fired.push_back(name + ":" + m.get_match_root()->description());
+            return true;
+        };
+    };
+
+    {
+        pass::GraphRewrite rewrite;
+        rewrite.add_matcher(make_shared<TestMatcher>(label_a * label_b), record("multiply"));
+        rewrite.add_matcher(make_shared<TestMatcher>(any_add), record("label"));
+        rewrite.add_matcher(make_shared<TestMatcher>(label_a + label_b), record("add"));
+        rewrite.run_on_function(f);
+        EXPECT_EQ(fired, (vector<string>{"label:Add", "multiply:Multiply"}));
+    }
+
+    fired.clear();
+    {
+        pass::GraphRewrite rewrite;
+        rewrite.add_matcher(make_shared<TestMatcher>(label_a + label_b), record("add"));
+        rewrite.add_matcher(make_shared<TestMatcher>(any_add), record("label"));
+        rewrite.add_matcher(make_shared<TestMatcher>(label_a * label_b), record("multiply"));
+        rewrite.run_on_function(f);
+        EXPECT_EQ(fired, (vector<string>{"add:Add", "multiply:Multiply"}));
+    }
+}
+
+TEST(pattern, graph_rewrite_revisits_replacements)
+{
+    // 0 - x is rewritten to -x, which is only then a double negation
+    Shape shape{};
+    auto a = make_shared<op::Parameter>(element::i32, shape);
+    auto zero = op::Constant::create(element::i32, shape, {0});
+    auto f = make_shared<Function>(zero - make_shared<op::Negative>(a), ParameterVector{a});
+
+    auto label = make_shared<pattern::op::Label>(element::i32, shape);
+    auto label_zero = make_shared<pattern::op::Label>(
+        element::i32, shape, [](shared_ptr<Node> n) { return is_type<op::Constant>(n); });
+    pass::GraphRewrite rewrite;
+    rewrite.add_matcher(make_shared<TestMatcher>(label_zero - label),
+                        [label](pattern::Matcher& m) {
+                            auto negative = make_shared<op::Negative>(m.get_pattern_map()[label]);
+                            replace_node(m.get_match_root(), negative);
+                            return true;
+                        });
+    rewrite.add_matcher(
+        make_shared<TestMatcher>(make_shared<op::Negative>(make_shared<op::Negative>(label))),
+        [label](pattern::Matcher& m) {
+            replace_node(m.get_match_root(), m.get_pattern_map()[label]);
+            return true;
+        });
+    rewrite.run_on_function(f);
+
+    EXPECT_EQ(f->get_results().at(0)->get_argument(0), a);
+}
+
+TEST(pattern, matcher_index)
+{
+    Shape shape{};
+    auto a = make_shared<op::Parameter>(element::i32, shape);
+    auto b = make_shared<op::Parameter>(element::i32, shape);
+    auto c = make_shared<op::Parameter>(element::i32, shape);
+    auto abs_a = make_shared<op::Abs>(a);
+    auto sum = abs_a + b;
+    auto product = c * sum;
+    auto sqrt = make_shared<op::Sqrt>(product);
+
+    auto label_a = make_shared<pattern::op::Label>(element::i32, shape);
+    auto label_b = make_shared<pattern::op::Label>(element::i32, shape);
+    auto abs_label = make_shared<op::Abs>(label_a);
+
+    pattern::MatcherIndex index;
+    vector<Output<Node>> patterns{label_a + label_b,
+                                  abs_label + label_b,
+                                  (abs_label + label_b) * label_a,
+                                  make_shared<op::Sqrt>(label_a * (label_a + label_b)),
+                                  label_a,
+                                  make_shared<op::Sqrt>(label_a * label_b),
+                                  make_shared<op::Abs>(label_a + label_b)};
+    for (size_t i = 0; i < patterns.size(); i++)
+    {
+        EXPECT_EQ(index.add(patterns[i]), i);
+    }
+    EXPECT_EQ(index.get_pattern_count(), patterns.size());
+
+    // The same pattern must be found through the index exactly when its skeleton fits
+    vector<size_t> candidates;
+    index.find(sum, candidates);
+    EXPECT_EQ(candidates, (vector<size_t>{0, 1, 4}));
+    // Multiply is commutative, so the Add on its right fits a pattern that lists it first
+    index.find(product, candidates);
+    EXPECT_EQ(candidates, (vector<size_t>{2, 4}));
+    index.find(sqrt, candidates);
+    EXPECT_EQ(candidates, (vector<size_t>{3, 4, 5}));
+    index.find(abs_a, candidates);
+    EXPECT_EQ(candidates, (vector<size_t>{4}));
+
+    // Every candidate the index drops must also be rejected by the matcher
+    for (auto node : NodeVector{abs_a, sum, product, sqrt})
+    {
+        index.find(node, candidates);
+        for (size_t i = 0; i < patterns.size(); i++)
+        {
+            if (find(candidates.begin(), candidates.end(), i) == candidates.end())
+            {
+                pattern::Matcher m(patterns[i]);
+                EXPECT_FALSE(m.match(node)) << "pattern " << i << " on " << *node;
+            }
+        }
+    }
+}
+
 TEST(pattern, matcher)
 {
     Shape shape{};
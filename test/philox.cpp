@@ -0,0 +1,81 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/state/philox.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Known answer of Philox4x32-10 from the Random123 distribution
+TEST(philox, known_answer)
+{
+    vector<uint32_t> values(4);
+    Philox4x32(0).generate(values.data(), values.size(), 0);
+    EXPECT_EQ((vector<uint32_t>{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}), values);
+}
+
+TEST(philox, split_generation_matches)
+{
+    Philox4x32 generator(42, 7);
+    vector<uint32_t> whole(1000);
+    generator.generate(whole.data(), whole.size(), 3);
+
+    // Pieces that start and end in the middle of a counter
+    vector<uint32_t> pieces(whole.size());
+    for (size_t start = 0; start < pieces.size(); start += 37)
+    {
+        size_t count = min<size_t>(37, pieces.size() - start);
+        generator.generate(pieces.data() + start, count, 3 + start);
+    }
+    EXPECT_EQ(whole, pieces);
+
+    // Skipping ahead lands on the same values
+    vector<uint32_t> skipped(10);
+    generator.generate(skipped.data(), skipped.size(), 503);
+    EXPECT_TRUE(equal(skipped.begin(), skipped.end(), whole.begin() + 500));
+}
+
+TEST(philox, streams_differ)
+{
+    vector<uint32_t> stream0(64);
+    vector<uint32_t> stream1(64);
+    Philox4x32(42, 0).generate(stream0.data(), stream0.size(), 0);
+    Philox4x32(42, 1).generate(stream1.data(), stream1.size(), 0);
+    EXPECT_NE(stream0, stream1);
+}
+
+TEST(philox, bernoulli_threshold)
+{
+    EXPECT_EQ(0u, bernoulli_threshold(0.0));
+    EXPECT_EQ(uint64_t(1) << 32, bernoulli_threshold(1.0));
+    EXPECT_EQ(uint64_t(1) << 31, bernoulli_threshold(0.5));
+
+    const size_t count = 100000;
+    vector<uint32_t> values(count);
+    Philox4x32(1234).generate(values.data(), count, 0);
+    uint64_t threshold = bernoulli_threshold(0.3);
+    size_t ones = count_if(values.begin(), values.end(), [&](uint32_t v) { return v < threshold; });
+    EXPECT_NEAR(0.3, static_cast<double>(ones) / count, 0.01);
+    for (auto value : values)
+    {
+        ASSERT_LT(random_unit_float(value), 1.0f);
+    }
+}
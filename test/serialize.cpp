@@ -20,6 +20,7 @@
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
+#include "ngraph/cpio.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/op/constant.hpp"
@@ -194,6 +195,100 @@ TEST(serialize, constant)
     EXPECT_TRUE(found);
 }
 
+TEST(serialize, constant_cpio)
+{
+    const string tmp_file = "serialize_constant_cpio.cpio";
+    Shape shape{2, 2, 2};
+    auto A = op::Constant::create(element::f32, shape, {1, 2, 3, 4, 5, 6, 7, 8});
+    auto B = op::Constant::create(element::i8, Shape{3}, {1, 2, 3});
+    auto C = op::Constant::create(element::f32, shape, {8, 7, 6, 5, 4, 3, 2, 1});
+    auto f = make_shared<Function>(NodeVector{A, B, C}, ParameterVector{});
+
+    serialize_to_cpio(tmp_file, f);
+    {
+        // Constant data is aligned in the archive so that it can be mapped in place
+        cpio::Reader reader(tmp_file);
+        auto file_info = reader.get_file_info();
+        ASSERT_EQ(file_info.size(), 4);
+        for (size_t i = 1; i < file_info.size(); i++)
+        {
+            EXPECT_EQ(file_info[i].get_offset() % 64, 0);
+        }
+        // The values are only in the archive, so the deserialized constants must come from it
+        auto model = reader.read(file_info[0]);
+        EXPECT_EQ(string(model.begin(), model.end()).find("\"value\""), string::npos);
+    }
+    auto g = deserialize(tmp_file);
+    ASSERT_NE(g, nullptr);
+    file_util::remove_file(tmp_file);
+
+    auto results = g->get_results();
+    ASSERT_EQ(results.size(), 3);
+    auto a = as_type_ptr<op::Constant>(results[0]->get_argument(0));
+    auto b = as_type_ptr<op::Constant>(results[1]->get_argument(0));
+    auto c = as_type_ptr<op::Constant>(results[2]->get_argument(0));
+    ASSERT_TRUE(a && b && c);
+    EXPECT_EQ((vector<float>{1, 2, 3, 4, 5, 6, 7, 8}), a->get_vector<float>());
+    EXPECT_EQ((vector<int8_t>{1, 2, 3}), b->get_vector<int8_t>());
+    EXPECT_EQ((vector<float>{8, 7, 6, 5, 4, 3, 2, 1}), c->get_vector<float>());
+}
+
+TEST(serialize, binary)
+{
+    const string tmp_file = "serialize_binary.bin";
+    Shape shape{2, 4};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = op::Constant::create(element::f32, shape, {1, 2, 3, 4, 5, 6, 7, 8});
+    auto C = op::Constant::create(element::i8, Shape{3}, {1, 2, 3});
+    auto concat = make_shared<op::Concat>(NodeVector{A, B}, 1);
+    auto f = make_shared<Function>(NodeVector{concat, C}, ParameterVector{A});
+
+    auto check = [](shared_ptr<Function> g) {
+        ASSERT_NE(g, nullptr);
+        ASSERT_EQ(g->get_parameters().size(), 1);
+        EXPECT_EQ(g->get_parameters()[0]->get_shape(), (Shape{2, 4}));
+        auto results = g->get_results();
+        ASSERT_EQ(results.size(), 2);
+        auto concat = as_type_ptr<op::Concat>(results[0]->get_argument(0));
+        auto c = as_type_ptr<op::Constant>(results[1]->get_argument(0));
+        ASSERT_TRUE(concat && c);
+        EXPECT_EQ(concat->get_concatenation_axis(), 1);
+        EXPECT_EQ(concat->get_shape(), (Shape{2, 8}));
+        auto b = as_type_ptr<op::Constant>(concat->get_argument(1));
+        ASSERT_TRUE(b);
+        EXPECT_EQ((vector<float>{1, 2, 3, 4, 5, 6, 7, 8}), b->get_vector<float>());
+        EXPECT_EQ((vector<int8_t>{1, 2, 3}), c->get_vector<int8_t>());
+    };
+
+    serialize_binary(tmp_file, f);
+    check(deserialize(tmp_file));
+    file_util::remove_file(tmp_file);
+
+    stringstream ss;
+    serialize_binary(ss, f);
+    check(deserialize(ss));
+    check(deserialize(ss.str()));
+}
+
+TEST(serialize, binary_sizes_checked)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto B = op::Constant::create(element::f32, Shape{4}, {1, 2, 3, 4});
+    auto f = make_shared<Function>(make_shared<op::Add>(A, B), ParameterVector{A});
+    stringstream ss;
+    serialize_binary(ss, f);
+    const string model = ss.str();
+
+    // The graph size follows the magic, version and flags. A size beyond the input is rejected
+    // before anything is allocated for it.
+    string oversized = model;
+    oversized[16 + 7] = 0x40;
+    EXPECT_THROW(deserialize(oversized), ngraph_error);
+
+    string truncated = model.substr(0, model.size() - 1);
+    EXPECT_THROW(deserialize(truncated), ngraph_error);
+}
+
 TEST(benchmark, serialize)
 {
     stopwatch timer;
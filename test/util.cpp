@@ -29,6 +29,7 @@
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
 #include "ngraph/serializer.hpp"
+#include "ngraph/small_deque.hpp"
 #include "util/all_close.hpp"
 #include "util/autodiff/backprop_function.hpp"
 #include "util/ndarray.hpp"
@@ -712,3 +713,107 @@ TEST(util, topological_sort_replace)
 
     EXPECT_TRUE(custom_sorter_used);
 }
+
+TEST(util, topological_sort_cached)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto add = make_shared<op::Add>(A, B);
+    auto abs = make_shared<op::Abs>(add);
+    auto f = make_shared<Function>(abs, ParameterVector{A, B});
+    size_t sort_count = 0;
+    f->set_topological_sort(
+        [&sort_count](const std::vector<std::shared_ptr<Node>>& root_nodes) {
+            sort_count++;
+            return topological_sort(root_nodes);
+        });
+
+    auto ops = f->get_ordered_ops();
+    EXPECT_EQ(f->get_ordered_ops(), ops);
+    EXPECT_EQ(sort_count, 1);
+
+    // Creating nodes that are not connected to the graph keeps the order
+    auto neg = make_shared<op::Negative>(A);
+    EXPECT_EQ(f->get_ordered_ops(), ops);
+    EXPECT_EQ(sort_count, 1);
+
+    replace_node(add, neg);
+    ops = f->get_ordered_ops();
+    EXPECT_EQ(sort_count, 2);
+    ASSERT_EQ(ops.size(), 5);
+    EXPECT_TRUE(find(ops.begin(), ops.end(), neg) < find(ops.begin(), ops.end(), abs));
+
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    abs->add_control_dependency(C);
+    ops = f->get_ordered_ops();
+    EXPECT_EQ(sort_count, 3);
+    EXPECT_TRUE(find(ops.begin(), ops.end(), C) < find(ops.begin(), ops.end(), abs));
+}
+
+TEST(util, topological_sort_cached_per_graph)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Abs>(A + B), ParameterVector{A, B});
+    size_t sort_count = 0;
+    f->set_topological_sort(
+        [&sort_count](const std::vector<std::shared_ptr<Node>>& root_nodes) {
+            sort_count++;
+            return topological_sort(root_nodes);
+        });
+    auto ops = f->get_ordered_ops();
+    EXPECT_EQ(sort_count, 1);
+
+    // Destroying nodes that use nodes of the function keeps the order
+    {
+        auto neg = make_shared<op::Negative>(A);
+        auto sum = neg + B;
+    }
+    EXPECT_EQ(f->get_ordered_ops(), ops);
+    EXPECT_EQ(sort_count, 1);
+
+    // So do changes to another function
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto abs = make_shared<op::Abs>(C);
+    auto g = make_shared<Function>(make_shared<op::Negative>(abs), ParameterVector{C});
+    replace_node(abs, make_shared<op::Sqrt>(C));
+    EXPECT_EQ(g->get_ordered_ops().size(), 4);
+    EXPECT_EQ(f->get_ordered_ops(), ops);
+    EXPECT_EQ(sort_count, 1);
+
+    // Changes to the function itself still do
+    auto D = make_shared<op::Parameter>(element::f32, shape);
+    f->get_results().at(0)->get_argument(0)->input(0).replace_source_output(D);
+    ops = f->get_ordered_ops();
+    EXPECT_EQ(sort_count, 2);
+    EXPECT_NE(find(ops.begin(), ops.end(), D), ops.end());
+}
+
+TEST(util, small_deque)
+{
+    SmallDeque<string, 2> strings;
+    EXPECT_TRUE(strings.empty());
+    string* first = &strings.emplace_back("first");
+    strings.emplace_back(3, 'b');
+    string* third = &strings.emplace_back("third");
+    for (size_t i = 0; i < 100; ++i)
+    {
+        strings.emplace_back(to_string(i));
+    }
+    // Elements never move, inline or not
+    EXPECT_EQ(first, &strings[0]);
+    EXPECT_EQ(third, &strings.at(2));
+    EXPECT_EQ(strings.size(), 103);
+    EXPECT_EQ(strings[1], "bbb");
+    EXPECT_EQ(strings.at(102), "99");
+    EXPECT_THROW(strings.at(103), std::out_of_range);
+
+    size_t count = 0;
+    for (auto& s : strings)
+    {
+        EXPECT_EQ(&s, &strings[count++]);
+    }
+    EXPECT_EQ(count, strings.size());
+}